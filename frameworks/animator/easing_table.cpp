@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animator/easing_table.h"
+
+#include <cmath>
+
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t TABLE_INDEX_BITS = 8;    // 8: 256 segments
+constexpr uint8_t TIME_BITS = 16;          // 16: bits of the time in [0, 1)
+constexpr uint8_t BEZIER_SOLVE_LOOP = 32;  // 32: bisection steps, far below float precision
+constexpr double HALF = 0.5;
+
+double Cube(double t)
+{
+    return t * t * t;
+}
+
+double Quint(double t)
+{
+    return t * t * t * t * t;
+}
+
+uint32_t SqrtUint64(uint64_t value)
+{
+    /* bit by bit without branches, so the steep ends of the circle curves need no floating point */
+    uint64_t root = 0;
+    for (int8_t shift = 62; shift >= 0; shift -= 2) { // 62: highest even bit, 2: next even bit
+        uint64_t trial = root + (1ULL << shift);
+        uint64_t mask = 0 - static_cast<uint64_t>(value >= trial);
+        value -= trial & mask;
+        root = (root >> 1) + ((1ULL << shift) & mask);
+    }
+    return static_cast<uint32_t>(root);
+}
+
+/* x or y of the cubic-bezier from 0 to 1 with the control values p1 and p2 */
+double Bezier(double t, double p1, double p2)
+{
+    double u = 1 - t;
+    return 3 * u * u * t * p1 + 3 * u * t * t * p2 + t * t * t; // 3: bezier coefficient
+}
+} // namespace
+
+constexpr uint16_t EasingTable::TABLE_SEGMENT_NUM;
+constexpr uint8_t EasingTable::BEZIER_SLOT_NUM;
+constexpr uint8_t EasingTable::FRACTION_BITS;
+constexpr int32_t EasingTable::FRACTION_ONE;
+constexpr uint16_t EasingTable::CIRCLE_EDGE_SEGMENT_NUM;
+
+int16_t* EasingTable::tables_[CURVE_NUM] = {nullptr};
+double EasingTable::backOvershoot_ = 0;
+EasingTable::BezierSlot EasingTable::bezierSlots_[BEZIER_SLOT_NUM] = {};
+
+double EasingTable::GetCurveValue(uint8_t curve, double t)
+{
+    double s = EasingEquation::GetBackOvershoot();
+    switch (curve) {
+        case BACK_IN:
+            return t * t * ((s + 1) * t - s);
+        case BACK_OUT:
+            return 1 - GetCurveValue(BACK_IN, 1 - t);
+        case CIRC_IN:
+            return 1 - std::sqrt(1 - t * t);
+        case CIRC_OUT:
+            return 1 - GetCurveValue(CIRC_IN, 1 - t);
+        case CUBIC_IN:
+            return Cube(t);
+        case CUBIC_OUT:
+            return 1 - Cube(1 - t);
+        case QUAD_IN:
+            return t * t;
+        case QUAD_OUT:
+            return 1 - (1 - t) * (1 - t);
+        case QUINT_IN:
+            return Quint(t);
+        case QUINT_OUT:
+            return 1 - Quint(1 - t);
+        case SINE_IN:
+            return 1 - std::cos(t * UI_PI * HALF);
+        case SINE_OUT:
+            return std::sin(t * UI_PI * HALF);
+        case BACK_IN_OUT:
+        case CIRC_IN_OUT:
+        case CUBIC_IN_OUT:
+        case QUAD_IN_OUT:
+        case QUINT_IN_OUT:
+        case SINE_IN_OUT:
+            /* the in curve up to the half, then the out curve, as in EasingEquation */
+            if (t < HALF) {
+                return HALF * GetCurveValue(curve - 2, 2 * t);        // 2: in curve, 2: double speed
+            }
+            return HALF + HALF * GetCurveValue(curve - 1, 2 * t - 1); // 2: double speed
+        default:
+            return t;
+    }
+}
+
+const int16_t* EasingTable::GetTable(uint8_t curve)
+{
+    if ((curve <= BACK_IN_OUT) && (backOvershoot_ != EasingEquation::GetBackOvershoot())) {
+        /* the back curves follow the overshoot of EasingEquation, rebuild them after it changed */
+        for (uint8_t i = BACK_IN; i <= BACK_IN_OUT; i++) {
+            delete[] tables_[i];
+            tables_[i] = nullptr;
+        }
+        backOvershoot_ = EasingEquation::GetBackOvershoot();
+    }
+    if (tables_[curve] != nullptr) {
+        return tables_[curve];
+    }
+    int16_t* table = new int16_t[TABLE_SEGMENT_NUM + 1];
+    if (table == nullptr) {
+        GRAPHIC_LOGE("EasingTable::GetTable new table fail");
+        return nullptr;
+    }
+    for (uint16_t i = 0; i <= TABLE_SEGMENT_NUM; i++) {
+        double y = GetCurveValue(curve, static_cast<double>(i) / TABLE_SEGMENT_NUM);
+        table[i] = static_cast<int16_t>(std::floor(y * FRACTION_ONE + HALF));
+    }
+    tables_[curve] = table;
+    return table;
+}
+
+int32_t EasingTable::Lookup(const int16_t* table, uint32_t time)
+{
+    uint32_t index = time >> TABLE_INDEX_BITS;
+    int32_t frac = static_cast<int32_t>(time & ((1 << TABLE_INDEX_BITS) - 1));
+    return table[index] + (((table[index + 1] - table[index]) * frac) >> TABLE_INDEX_BITS);
+}
+
+bool EasingTable::IsCircleEdge(uint8_t curve, uint32_t time)
+{
+    uint32_t index = time >> TABLE_INDEX_BITS;
+    switch (curve) {
+        case CIRC_IN:
+            return index >= TABLE_SEGMENT_NUM - CIRCLE_EDGE_SEGMENT_NUM;
+        case CIRC_OUT:
+            return index < CIRCLE_EDGE_SEGMENT_NUM;
+        case CIRC_IN_OUT:
+            return (index + CIRCLE_EDGE_SEGMENT_NUM >= (TABLE_SEGMENT_NUM >> 1)) &&
+                   (index < (TABLE_SEGMENT_NUM >> 1) + CIRCLE_EDGE_SEGMENT_NUM);
+        default:
+            return false;
+    }
+}
+
+int32_t EasingTable::GetCircProgress(uint8_t curve, uint32_t curTime, uint32_t durationTime)
+{
+    switch (curve) {
+        case CIRC_IN:
+            return FRACTION_ONE - CircleY(curTime, durationTime);
+        case CIRC_OUT:
+            return CircleY(durationTime - curTime, durationTime);
+        default:
+            if ((curTime << 1) < durationTime) {
+                return GetCircProgress(CIRC_IN, curTime << 1, durationTime) >> 1;
+            }
+            return (FRACTION_ONE + GetCircProgress(CIRC_OUT, (curTime << 1) - durationTime, durationTime)) >> 1;
+    }
+}
+
+int32_t EasingTable::CircleY(uint32_t x, uint32_t radius)
+{
+    /* sqrt(radius^2 - x^2) / radius in fixed point, exact up to the rounding of the square root */
+    uint64_t square = static_cast<uint64_t>(radius * radius - x * x) << (FRACTION_BITS << 1);
+    return static_cast<int32_t>(SqrtUint64(square) / radius);
+}
+
+int16_t EasingTable::Move(int16_t startPos, int16_t endPos, int32_t progress)
+{
+    int64_t move = static_cast<int64_t>(static_cast<int32_t>(endPos) - startPos) * progress;
+    return static_cast<int16_t>(((move + (FRACTION_ONE >> 1)) >> FRACTION_BITS) + startPos);
+}
+
+int16_t EasingTable::Ease(uint8_t curve, int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    if (curTime >= durationTime) {
+        return endPos;
+    }
+    uint32_t time = (static_cast<uint32_t>(curTime) << TIME_BITS) / durationTime;
+    if (IsCircleEdge(curve, time)) {
+        return Move(startPos, endPos, GetCircProgress(curve, curTime, durationTime));
+    }
+    const int16_t* table = tables_[curve];
+    if ((table == nullptr) || ((curve <= BACK_IN_OUT) && (backOvershoot_ != EasingEquation::GetBackOvershoot()))) {
+        table = GetTable(curve);
+    }
+    if (table == nullptr) {
+        double y = GetCurveValue(curve, static_cast<double>(curTime) / durationTime);
+        return static_cast<int16_t>(std::floor(y * (static_cast<int32_t>(endPos) - startPos) + HALF) + startPos);
+    }
+    return Move(startPos, endPos, Lookup(table, time));
+}
+
+template<uint8_t SLOT>
+int16_t EasingTable::BezierEase(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    const int16_t* table = bezierSlots_[SLOT].table;
+    if ((curTime >= durationTime) || (table == nullptr)) {
+        return endPos;
+    }
+    return Move(startPos, endPos, Lookup(table, (static_cast<uint32_t>(curTime) << TIME_BITS) / durationTime));
+}
+
+const EasingFunc EasingTable::BEZIER_FUNCS[BEZIER_SLOT_NUM] = {
+    BezierEase<0>, BezierEase<1>, BezierEase<2>, BezierEase<3>, // 1, 2, 3: slot
+    BezierEase<4>, BezierEase<5>, BezierEase<6>, BezierEase<7>, // 4, 5, 6, 7: slot
+};
+
+int16_t* EasingTable::BuildBezierTable(float x1, float y1, float x2, float y2)
+{
+    int16_t* table = new int16_t[TABLE_SEGMENT_NUM + 1];
+    if (table == nullptr) {
+        GRAPHIC_LOGE("EasingTable::BuildBezierTable new table fail");
+        return nullptr;
+    }
+    /* x(t) grows with t as x1 and x2 are in [0, 1], so t of each x is found by bisection */
+    for (uint16_t i = 0; i <= TABLE_SEGMENT_NUM; i++) {
+        double x = static_cast<double>(i) / TABLE_SEGMENT_NUM;
+        double low = 0;
+        double high = 1;
+        for (uint8_t j = 0; j < BEZIER_SOLVE_LOOP; j++) {
+            double mid = (low + high) * HALF;
+            if (Bezier(mid, x1, x2) < x) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        double y = Bezier((low + high) * HALF, y1, y2);
+        table[i] = static_cast<int16_t>(std::floor(y * FRACTION_ONE + HALF));
+    }
+    return table;
+}
+
+EasingFunc EasingTable::CreateBezier(float x1, float y1, float x2, float y2)
+{
+    x1 = MATH_MIN(MATH_MAX(x1, 0.0f), 1.0f);
+    x2 = MATH_MIN(MATH_MAX(x2, 0.0f), 1.0f);
+    uint8_t freeSlot = BEZIER_SLOT_NUM;
+    for (uint8_t i = 0; i < BEZIER_SLOT_NUM; i++) {
+        BezierSlot& slot = bezierSlots_[i];
+        if (slot.refCount == 0) {
+            if (freeSlot == BEZIER_SLOT_NUM) {
+                freeSlot = i;
+            }
+            continue;
+        }
+        if ((slot.x1 == x1) && (slot.y1 == y1) && (slot.x2 == x2) && (slot.y2 == y2)) {
+            slot.refCount++;
+            return BEZIER_FUNCS[i];
+        }
+    }
+    if (freeSlot == BEZIER_SLOT_NUM) {
+        GRAPHIC_LOGE("EasingTable::CreateBezier no free slot");
+        return nullptr;
+    }
+    int16_t* table = BuildBezierTable(x1, y1, x2, y2);
+    if (table == nullptr) {
+        return nullptr;
+    }
+    bezierSlots_[freeSlot] = {x1, y1, x2, y2, table, 1};
+    return BEZIER_FUNCS[freeSlot];
+}
+
+void EasingTable::ReleaseBezier(EasingFunc func)
+{
+    for (uint8_t i = 0; i < BEZIER_SLOT_NUM; i++) {
+        BezierSlot& slot = bezierSlots_[i];
+        if ((BEZIER_FUNCS[i] != func) || (slot.refCount == 0)) {
+            continue;
+        }
+        slot.refCount--;
+        if (slot.refCount == 0) {
+            delete[] slot.table;
+            slot.table = nullptr;
+        }
+        return;
+    }
+}
+
+void EasingTable::ReleaseTables()
+{
+    for (uint8_t i = 0; i < CURVE_NUM; i++) {
+        delete[] tables_[i];
+        tables_[i] = nullptr;
+    }
+}
+
+uint32_t EasingTable::GetTableSize()
+{
+    uint32_t size = 0;
+    for (uint8_t i = 0; i < CURVE_NUM; i++) {
+        if (tables_[i] != nullptr) {
+            size += GetCurveTableSize();
+        }
+    }
+    for (uint8_t i = 0; i < BEZIER_SLOT_NUM; i++) {
+        if (bezierSlots_[i].table != nullptr) {
+            size += GetCurveTableSize();
+        }
+    }
+    return size;
+}
+
+int16_t EasingTable::BackEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(BACK_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::BackEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(BACK_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::BackEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(BACK_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CircEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CIRC_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CircEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CIRC_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CircEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CIRC_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CubicEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CUBIC_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CubicEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CUBIC_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::CubicEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(CUBIC_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuadEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUAD_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuadEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUAD_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuadEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUAD_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuintEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUINT_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuintEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUINT_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::QuintEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(QUINT_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::SineEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(SINE_IN, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::SineEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(SINE_OUT, startPos, endPos, curTime, durationTime);
+}
+
+int16_t EasingTable::SineEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime)
+{
+    return Ease(SINE_IN_OUT, startPos, endPos, curTime, durationTime);
+}
+} // namespace OHOS
@@ -242,12 +242,13 @@ void Image::DrawImage(BufferInfo& gfxDstBuffer,
                       const Rect& coords,
                       const Rect& mask,
                       const Style& style,
-                      uint8_t opaScale) const
+                      uint8_t opaScale,
+                      const ClipMask* clipMask) const
 {
     if (srcType_ == IMG_SRC_VARIABLE) {
-        DrawImage::DrawCommon(gfxDstBuffer, coords, mask, imageInfo_, style, opaScale);
+        DrawImage::DrawCommon(gfxDstBuffer, coords, mask, imageInfo_, style, opaScale, clipMask);
     } else if (srcType_ == IMG_SRC_FILE) {
-        DrawImage::DrawCommon(gfxDstBuffer, coords, mask, path_, style, opaScale);
+        DrawImage::DrawCommon(gfxDstBuffer, coords, mask, path_, style, opaScale, clipMask);
     } else {
         GRAPHIC_LOGE("Image::DrawImage:: failed with error srctype!\n");
     }
@@ -65,6 +65,15 @@ void InputDeviceManager::Callback()
     }
 }
 
+void InputDeviceManager::FlushEvents()
+{
+    ListNode<InputDevice*>* node = deviceList_.Begin();
+    while (node != deviceList_.End()) {
+        node->data_->FlushEvent();
+        node = node->next_;
+    }
+}
+
 void InputDeviceManager::Clear()
 {
     deviceList_.Clear();
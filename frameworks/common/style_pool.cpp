@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/style_pool.h"
+#include "gfx_utils/graphic_log.h"
+
+namespace OHOS {
+namespace {
+/* every key of Style, two styles are equal when all of them are */
+const uint8_t STYLE_KEYS[] = {
+    STYLE_BACKGROUND_COLOR, STYLE_BACKGROUND_OPA, STYLE_BORDER_RADIUS, STYLE_BORDER_COLOR, STYLE_BORDER_OPA,
+    STYLE_BORDER_WIDTH,     STYLE_PADDING_LEFT,   STYLE_PADDING_RIGHT, STYLE_PADDING_TOP,  STYLE_PADDING_BOTTOM,
+    STYLE_MARGIN_LEFT,      STYLE_MARGIN_RIGHT,   STYLE_MARGIN_TOP,    STYLE_MARGIN_BOTTOM, STYLE_TEXT_COLOR,
+    STYLE_TEXT_FONT,        STYLE_TEXT_OPA,       STYLE_LETTER_SPACE,  STYLE_LINE_SPACE,   STYLE_LINE_HEIGHT,
+    STYLE_LINE_COLOR,       STYLE_LINE_WIDTH,     STYLE_LINE_OPA,      STYLE_LINE_CAP,
+};
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261;
+constexpr uint32_t FNV_PRIME = 16777619;
+} // namespace
+
+StylePool& StylePool::GetInstance()
+{
+    static StylePool instance;
+    return instance;
+}
+
+StylePool::~StylePool()
+{
+    for (uint8_t i = 0; i < BUCKET_NUM; i++) {
+        Entry* entry = buckets_[i];
+        while (entry != nullptr) {
+            Entry* next = entry->next;
+            delete entry;
+            entry = next;
+        }
+        buckets_[i] = nullptr;
+    }
+}
+
+bool StylePool::IsEqual(const Style& style1, const Style& style2)
+{
+    for (uint8_t key : STYLE_KEYS) {
+        if (style1.GetStyle(key) != style2.GetStyle(key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t StylePool::Hash(const Style& style)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (uint8_t key : STYLE_KEYS) {
+        uint64_t value = static_cast<uint64_t>(style.GetStyle(key));
+        hash = (hash ^ static_cast<uint32_t>(value)) * FNV_PRIME;
+        hash = (hash ^ static_cast<uint32_t>(value >> 32)) * FNV_PRIME; // 32: high word
+    }
+    return hash;
+}
+
+Style* StylePool::Acquire(const Style& style)
+{
+    uint32_t hash = Hash(style);
+    Entry*& bucket = buckets_[hash % BUCKET_NUM];
+    for (Entry* entry = bucket; entry != nullptr; entry = entry->next) {
+        if ((entry->hash == hash) && IsEqual(entry->style, style)) {
+            entry->refCount++;
+            refNum_++;
+            return &entry->style;
+        }
+    }
+
+    Entry* entry = new Entry();
+    if (entry == nullptr) {
+        GRAPHIC_LOGE("StylePool::Acquire new Entry fail");
+        return nullptr;
+    }
+    entry->style = style;
+    entry->hash = hash;
+    entry->refCount = 1;
+    entry->next = bucket;
+    bucket = entry;
+    entryNum_++;
+    refNum_++;
+    return &entry->style;
+}
+
+void StylePool::Release(const Style* style)
+{
+    if (style == nullptr) {
+        return;
+    }
+    Entry** link = &buckets_[Hash(*style) % BUCKET_NUM];
+    while (*link != nullptr) {
+        Entry* entry = *link;
+        if (&entry->style == style) {
+            refNum_--;
+            if (--entry->refCount == 0) {
+                *link = entry->next;
+                delete entry;
+                entryNum_--;
+            }
+            return;
+        }
+        link = &entry->next;
+    }
+    GRAPHIC_LOGE("StylePool::Release style not in pool");
+}
+} // namespace OHOS
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_STYLE_POOL_H
+#define GRAPHIC_LITE_STYLE_POOL_H
+
+#include "gfx_utils/heap_base.h"
+#include "gfx_utils/style.h"
+
+namespace OHOS {
+/**
+ * Interns the styles views change with UIView::SetStyle(key, value). Views whose styles end up with the same values
+ * share one refcounted entry instead of keeping a private copy each. An entry must not be changed once it is shared,
+ * a view that changes its style again acquires another entry and releases the old one.
+ */
+class StylePool : public HeapBase {
+public:
+    static StylePool& GetInstance();
+
+    /* Returns the entry equal to style with one more reference, creating it if needed, or nullptr if out of memory. */
+    Style* Acquire(const Style& style);
+
+    /* Drops one reference of an entry returned by Acquire, and frees the entry with its last reference. */
+    void Release(const Style* style);
+
+    uint16_t GetEntryCount() const
+    {
+        return entryNum_;
+    }
+
+    uint32_t GetReferenceCount() const
+    {
+        return refNum_;
+    }
+
+    static bool IsEqual(const Style& style1, const Style& style2);
+
+private:
+    static constexpr uint8_t BUCKET_NUM = 64;
+
+    struct Entry : public HeapBase {
+        Style style;
+        uint32_t hash;
+        uint32_t refCount;
+        Entry* next;
+    };
+
+    StylePool() : buckets_{nullptr}, entryNum_(0), refNum_(0) {}
+    ~StylePool();
+
+    StylePool(const StylePool&) = delete;
+    StylePool& operator=(const StylePool&) = delete;
+    StylePool(StylePool&&) = delete;
+    StylePool& operator=(StylePool&&) = delete;
+
+    static uint32_t Hash(const Style& style);
+
+    Entry* buckets_[BUCKET_NUM];
+    uint16_t entryNum_;
+    uint32_t refNum_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_STYLE_POOL_H
@@ -17,6 +17,9 @@
 
 #include "common/screen.h"
 #include "core/render_manager.h"
+#include "dfx/ui_frame_timeline.h"
+#include "dfx/ui_input_latency.h"
+#include "dfx/ui_render_profiler.h"
 #include "draw/draw_utils.h"
 #include "gfx_utils/graphic_log.h"
 #if ENABLE_WINDOW
@@ -52,6 +55,10 @@ RootView* RootView::GetInstance()
 
 RootView::~RootView()
 {
+    if (screenRowBounds_ != nullptr) {
+        delete[] screenRowBounds_;
+        screenRowBounds_ = nullptr;
+    }
     DestroyDrawContext();
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_destroy(&lock_);
@@ -74,6 +81,88 @@ Rect RootView::GetScreenRect()
     return screenRect;
 }
 
+bool RootView::UpdateScreenRowBounds()
+{
+#if ENABLE_WINDOW
+    return false;
+#else
+    if (BaseGfxEngine::GetInstance()->GetScreenShape() != ScreenShape::CIRCLE) {
+        return false;
+    }
+    Rect screenRect = GetScreenRect();
+    int16_t width = screenRect.GetWidth();
+    int16_t height = screenRect.GetHeight();
+    if ((screenRowBounds_ != nullptr) && (width == screenBoundWidth_) && (height == screenBoundHeight_)) {
+        return true;
+    }
+    if (screenRowBounds_ != nullptr) {
+        delete[] screenRowBounds_;
+    }
+    screenRowBounds_ = new int16_t[height * 2]; // 2: left and right bound of each row
+    if (screenRowBounds_ == nullptr) {
+        GRAPHIC_LOGE("RootView::UpdateScreenRowBounds new screenRowBounds_ fail");
+        return false;
+    }
+    screenBoundWidth_ = width;
+    screenBoundHeight_ = height;
+
+    /* keeps every pixel the inscribed circle touches, one more on each side makes up for the error of Sqrt */
+    float centerX = width / 2.0f;  // 2.0: half
+    float centerY = height / 2.0f; // 2.0: half
+    float radius = MATH_MIN(width, height) / 2.0f; // 2.0: half
+    for (int16_t y = 0; y < height; y++) {
+        float dy = 0;
+        if (y + 1 < centerY) {
+            dy = centerY - (y + 1);
+        } else if (y > centerY) {
+            dy = y - centerY;
+        }
+        int16_t* bounds = screenRowBounds_ + y * 2; // 2: left and right bound of each row
+        if (dy >= radius) {
+            bounds[0] = 0;
+            bounds[1] = -1;
+            continue;
+        }
+        float halfWidth = Sqrt(radius * radius - dy * dy);
+        bounds[0] = MATH_MAX(static_cast<int16_t>(centerX - halfWidth) - 1, 0);
+        bounds[1] = MATH_MIN(static_cast<int16_t>(centerX + halfWidth) + 1, width - 1);
+    }
+    return true;
+#endif
+}
+
+bool RootView::ClipToScreenShape(Rect& rect)
+{
+    if (!UpdateScreenRowBounds()) {
+        return true;
+    }
+    int16_t top = MATH_MAX(rect.GetTop(), 0);
+    int16_t bottom = MATH_MIN(rect.GetBottom(), static_cast<int16_t>(screenBoundHeight_ - 1));
+    int16_t clipTop = -1;
+    int16_t clipBottom = -1;
+    int16_t clipLeft = COORD_MAX;
+    int16_t clipRight = COORD_MIN;
+    for (int16_t y = top; y <= bottom; y++) {
+        int16_t left = MATH_MAX(rect.GetLeft(), screenRowBounds_[y * 2]);       // 2: left and right bound
+        int16_t right = MATH_MIN(rect.GetRight(), screenRowBounds_[y * 2 + 1]); // 2: left and right bound
+        if (left > right) {
+            continue;
+        }
+        if (clipTop < 0) {
+            clipTop = y;
+        }
+        clipBottom = y;
+        clipLeft = MATH_MIN(clipLeft, left);
+        clipRight = MATH_MAX(clipRight, right);
+    }
+    if (clipTop < 0) {
+        /* the rect only covers corners that cannot be seen */
+        return false;
+    }
+    rect.SetRect(clipLeft, clipTop, clipRight, clipBottom);
+    return true;
+}
+
 #if LOCAL_RENDER
 using namespace Graphic;
 static void DivideInvalidateRect(const Rect& originRect, Rect& leftoverRect, Vector<Rect>& splitRects)
@@ -394,7 +483,9 @@ void RootView::DrawInvalidMap(const Rect& buffRect)
         Vector<Rect>& viewRenderRect = viewEntry.second;
         for (uint16_t i = 0; i < viewRenderRect.Size(); i++) {
             rect.Intersect(viewRenderRect[i], buffRect);
-            DrawTop(viewEntry.first, rect);
+            if (ClipToScreenShape(rect)) {
+                DrawTop(viewEntry.first, rect);
+            }
         }
     }
 }
@@ -444,6 +535,48 @@ void RootView::OptimizeInvalidateRects()
         }
     }
 }
+
+#if (FULLY_RENDER != 1)
+void RootView::AddBufferAgeDamage()
+{
+    uint8_t bufferAge = BaseGfxEngine::GetInstance()->GetFBBufferAge();
+
+    /* record the damage of this frame before the history is merged into it */
+    damageHead_ = (damageHead_ + 1) % MAX_BUFFER_AGE;
+    FrameDamage& current = damageHistory_[damageHead_];
+    current.rectNum = 0;
+    for (ListNode<Rect>* iter = invalidateRects_.Begin(); iter != invalidateRects_.End(); iter = iter->next_) {
+        if (current.rectNum < MAX_FRAME_DAMAGE_SIZE) {
+            current.rects[current.rectNum++] = iter->data_;
+        } else {
+            Rect& last = current.rects[MAX_FRAME_DAMAGE_SIZE - 1];
+            last.Join(last, iter->data_);
+        }
+    }
+    if (damageFrameNum_ < MAX_BUFFER_AGE) {
+        damageFrameNum_++;
+    }
+
+    if (bufferAge == 1) {
+        return;
+    }
+    if ((bufferAge == 0) || (bufferAge > damageFrameNum_)) {
+        /* contents unknown or older than the history, the whole buffer has to be drawn */
+        invalidateRects_.Clear();
+        invalidateRects_.PushBack(GetScreenRect());
+        return;
+    }
+    /* the buffer holds the frame presented bufferAge frames ago, add everything changed since then */
+    for (uint8_t i = 1; i < bufferAge; i++) {
+        const FrameDamage& damage = damageHistory_[(damageHead_ + MAX_BUFFER_AGE - i) % MAX_BUFFER_AGE];
+        for (uint8_t j = 0; j < damage.rectNum; j++) {
+            Rect rect = damage.rects[j];
+            OptimizeAddRect(rect);
+        }
+    }
+    OptimizeInvalidateRects();
+}
+#endif
 #endif
 
 void RootView::AddInvalidateRect(Rect& rect, UIView* view)
@@ -478,25 +611,31 @@ void RootView::AddInvalidateRectWithLock(Rect& rect, UIView* view)
 
 void RootView::Measure()
 {
+    DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_MEASURE);
 #if LOCAL_RENDER
-    if (!invalidateMap_.empty()) {
-        MeasureView(childrenHead_);
-    }
+    if (!invalidateMap_.empty() && needMeasure_) {
 #else
-    if (invalidateRects_.Size() > 0) {
+    if ((invalidateRects_.Size() > 0) && needMeasure_) {
+#endif
+        needMeasure_ = false;
         MeasureView(childrenHead_);
+    } else {
+        measuredViewCount_ = 0;
     }
-#endif
 }
 
 void RootView::MeasureView(UIView* view)
 {
+    measuredViewCount_ = 0;
     int16_t stackCount = 0;
     UIView* curView = view;
     while (stackCount >= 0) {
         while (curView != nullptr) {
-            if (curView->IsVisible()) {
+            /* only walk into the subtrees that contain views waiting for a measure pass */
+            if (curView->IsVisible() && curView->needMeasure_) {
+                curView->needMeasure_ = false;
                 curView->ReMeasure();
+                measuredViewCount_++;
                 if (curView->IsViewGroup() && stackCount < COMPONENT_NESTING_DEPTH) {
                     g_viewStack[stackCount++] = curView;
                     curView = static_cast<UIViewGroup*>(curView)->GetChildrenHead();
@@ -517,7 +656,10 @@ void RootView::Render()
     pthread_mutex_lock(&lock_);
 #endif
 #if !LOCAL_RENDER
-   OptimizeInvalidateRects();
+    {
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_MERGE_RECTS);
+        OptimizeInvalidateRects();
+    }
 #endif
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_unlock(&lock_);
@@ -525,25 +667,39 @@ void RootView::Render()
 
 #if LOCAL_RENDER
     if (!invalidateMap_.empty()) {
-        RenderManager::RenderRect(GetRect(), this);
+        {
+            DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_DRAW_TOP);
+            RenderManager::RenderRect(GetRect(), this);
+        }
         invalidateMap_.clear();
 #else
     if ( invalidateRects_.Size() > 0) {
 #if (FULLY_RENDER != 1)
-        // only draw invalid rects. in this case, buffers (if there are two buffers or more to display) should keep
-        // same with each others, because only delta changes write to the buffer between each frames, so it fits one
-        // buffer to display.
+        // only draw invalid rects. if there are two buffers or more to display, the damage of the frames presented
+        // since the current buffer was last shown is drawn as well, according to the age reported by the engine.
+        AddBufferAgeDamage();
         for (ListNode<Rect>* iter = invalidateRects_.Begin(); iter != invalidateRects_.End(); iter = iter->next_) {
-            RenderManager::RenderRect(iter->data_, this);
+            DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_DRAW_TOP);
+            Rect rect = iter->data_;
+            if (ClipToScreenShape(rect)) {
+                RenderManager::RenderRect(rect, this);
+            }
         }
 #else
         // fully draw whole reacts. in this case, buffers (if there are two buffers or more to display) could be
         // independent on each others, so it fits two buffers or more to display.
-        RenderManager::RenderRect(GetScreenRect(), this);
+        {
+            DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_DRAW_TOP);
+            Rect rect = GetScreenRect();
+            if (ClipToScreenShape(rect)) {
+                RenderManager::RenderRect(rect, this);
+            }
+        }
 #endif
         invalidateRects_.Clear();
 #endif
 
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_FLUSH);
 #if ENABLE_WINDOW
         if (boundWindow_) {
             boundWindow_->Flush();
@@ -551,6 +707,7 @@ void RootView::Render()
         }
 #endif
         BaseGfxEngine::GetInstance()->Flush();
+        DEBUG_INPUT_LATENCY_RECORD_FLUSH();
     }
 }
 
@@ -629,6 +786,12 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
     BufferInfo* gfxDstBuffer = boundWin->GetBufferInfo();
     UpdateBufferInfo(gfxDstBuffer);
 #endif
+    bool rowBounded = UpdateScreenRowBounds();
+    if (rowBounded) {
+        DrawUtils::GetInstance()->SetRowBounds(dc_.bufferInfo->virAddr, screenRowBounds_, screenBoundHeight_);
+    }
+    BaseGfxEngine::GetInstance()->BeginDeferred(*dc_.bufferInfo);
+    DEBUG_RENDER_PROFILER_BEGIN_OVERDRAW(*dc_.bufferInfo, rect);
 
     while (par != nullptr) {
         if (curView != nullptr) {
@@ -656,13 +819,14 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
                             UpdateMapBufferInfo(invalidatedArea);
                             updateMapBufferInfo = true;
                         }
-                        curView->OnDraw(*dc_.mapBufferInfo, invalidatedArea);
+                        DrawView(curView, *dc_.mapBufferInfo, invalidatedArea, false);
                         curViewRect = invalidatedArea;
                     } else {
-                        curView->OnDraw(*dc_.bufferInfo, curViewRect);
+                        DrawView(curView, *dc_.bufferInfo, curViewRect, false);
                     }
 
-                    if ((curView->IsViewGroup()) && (stackCount < COMPONENT_NESTING_DEPTH)) {
+                    if ((curView->IsViewGroup()) && (stackCount < COMPONENT_NESTING_DEPTH) &&
+                        !static_cast<UIViewGroup*>(curView)->IsChildrenDrawnByGroup()) {
                         if (enableAnimator && (transViewGroup == nullptr)) {
                             transViewGroup = curView;
                         }
@@ -677,9 +841,9 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
                     }
 
                     if (enableAnimator) {
-                        curView->OnPostDraw(*dc_.mapBufferInfo, curViewRect);
+                        DrawView(curView, *dc_.mapBufferInfo, curViewRect, true);
                     } else {
-                        curView->OnPostDraw(*dc_.bufferInfo, curViewRect);
+                        DrawView(curView, *dc_.bufferInfo, curViewRect, true);
                     }
 
                     if (enableAnimator && (transViewGroup == nullptr)) {
@@ -702,9 +866,9 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
             curViewRect = par->GetMaskedRect();
             mask = g_maskStack[stackCount];
             if (enableAnimator) {
-                par->OnPostDraw(*dc_.mapBufferInfo, curViewRect);
+                DrawView(par, *dc_.mapBufferInfo, curViewRect, true);
             } else if (curViewRect.Intersect(curViewRect, mask)) {
-                par->OnPostDraw(*dc_.bufferInfo, curViewRect);
+                DrawView(par, *dc_.bufferInfo, curViewRect, true);
             }
 
             if (enableAnimator && transViewGroup == g_viewStack[stackCount]) {
@@ -726,12 +890,40 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
         stackCount = 0;
         curView = par->GetNextSibling();
         if (enableAnimator) {
-            par->OnPostDraw(*dc_.mapBufferInfo, rect);
+            DrawView(par, *dc_.mapBufferInfo, rect, true);
         } else {
-            par->OnPostDraw(*dc_.bufferInfo, rect);
+            DrawView(par, *dc_.bufferInfo, rect, true);
         }
         par = par->GetParent();
     }
+    BaseGfxEngine::GetInstance()->EndDeferred();
+    DEBUG_RENDER_PROFILER_END_OVERDRAW(*dc_.bufferInfo, rect);
+    if (rowBounded) {
+        DrawUtils::GetInstance()->SetRowBounds(nullptr, nullptr, 0);
+    }
+}
+
+void RootView::DrawView(UIView* view, BufferInfo& gfxDstBuffer, const Rect& rect, bool postDraw)
+{
+    /*
+     * Views of these types draw only through BaseGfxEngine, so their fills can stay in the deferred queue. Any other
+     * view may write pixels itself, and the queue is executed before it draws.
+     */
+    UIViewType type = view->GetViewType();
+    bool deferrable = (type == UI_ROOT_VIEW) || (type == UI_VIEW_GROUP) || (type == UI_IMAGE_VIEW);
+    BaseGfxEngine* engine = BaseGfxEngine::GetInstance();
+    if (!deferrable) {
+        engine->PauseDeferred();
+    }
+    DEBUG_RENDER_PROFILER_SCOPE(view, gfxDstBuffer, rect, postDraw);
+    if (postDraw) {
+        view->OnPostDraw(gfxDstBuffer, rect);
+    } else {
+        view->OnDraw(gfxDstBuffer, rect);
+    }
+    if (!deferrable) {
+        engine->ResumeDeferred();
+    }
 }
 
 UIView* RootView::GetTopUIView(const Rect& rect)
@@ -747,7 +939,8 @@ UIView* RootView::GetTopUIView(const Rect& rect)
                     currentView->GetOpaScale() == OPA_OPAQUE) {
                     topView = currentView;
                 }
-                if (currentView->IsViewGroup() && stackCount < COMPONENT_NESTING_DEPTH) {
+                if (currentView->IsViewGroup() && stackCount < COMPONENT_NESTING_DEPTH &&
+                    !static_cast<UIViewGroup*>(currentView)->IsChildrenDrawnByGroup()) {
                     g_viewStack[stackCount++] = currentView;
                     currentView = static_cast<UIViewGroup*>(currentView)->GetChildrenHead();
                     continue;
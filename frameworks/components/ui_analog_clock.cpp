@@ -17,18 +17,38 @@
 
 #include "components/ui_image_view.h"
 #include "draw/draw_image.h"
+#include "draw/draw_utils.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
 #include "gfx_utils/style.h"
 #include "imgdecode/cache_manager.h"
+#include "imgdecode/image_load.h"
+#include "securec.h"
 #include "themes/theme.h"
 
 namespace OHOS {
+uint32_t UIAnalogClock::dialCacheSize_ = 0;
+constexpr uint32_t UIAnalogClock::DIAL_CACHE_MAX_SIZE;
+constexpr uint8_t UIAnalogClock::HAND_PIECE_NUM;
+constexpr int16_t UIAnalogClock::HAND_PIECE_MARGIN;
+
 UIAnalogClock::UIAnalogClock()
+    : dialCache_(nullptr),
+      dialCacheWidth_(0),
+      dialCacheHeight_(0),
+      dialCacheOpa_(OPA_OPAQUE),
+      dialCacheValid_(false),
+      useDialCache_(false)
 {
     touchable_ = true;
 }
 
+UIAnalogClock::~UIAnalogClock()
+{
+    ReleaseDialCache();
+}
+
 void UIAnalogClock::SetHandImage(HandType type, const UIImageView& img, Point position, Point center)
 {
     Hand* hand = nullptr;
@@ -211,6 +231,9 @@ void UIAnalogClock::UpdateClock(bool clockInit)
 
 void UIAnalogClock::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
 {
+    if (DrawDialCache(gfxDstBuffer, invalidatedArea)) {
+        return;
+    }
     BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, GetRect(), invalidatedArea, *style_, opaScale_);
 }
 
@@ -248,13 +271,71 @@ void UIAnalogClock::CalculateRedrawArea(const Rect& current, Hand& hand, bool cl
     /* Rotate the specified angle,  */
     backwardMap.Rotate(hand.nextAngle_ - hand.initAngle_, pivot);
     Rect redraw = hand.target_;
+    uint16_t preAngle = hand.preAngle_;
     hand.target_ = backwardMap.GetBoxRect();
     hand.trans_ = backwardMap;
     hand.preAngle_ = hand.nextAngle_;
-    if (!clockInit) {
-        /* Prevent old images from being residued */
-        redraw.Join(redraw, hand.target_);
-        InvalidateRect(redraw);
+    if (clockInit) {
+        return;
+    }
+    if (IsDialCacheReady()) {
+        /*
+         * With the dial in a layer, redrawing is cheap but proportional to the area. A slanted hand covers only a
+         * small part of its bounding box, so only the strips along its old and new position are invalidated.
+         */
+        if (preAngle != hand.nextAngle_) {
+            InvalidateHand(current, hand, preAngle);
+            InvalidateHand(current, hand, hand.nextAngle_);
+        }
+        return;
+    }
+    /* Prevent old images from being residued */
+    redraw.Join(redraw, hand.target_);
+    InvalidateRect(redraw);
+}
+
+void UIAnalogClock::InvalidateHand(const Rect& current, const Hand& hand, uint16_t angle)
+{
+    if (hand.drawtype_ == DrawType::DRAW_LINE) {
+        Point start;
+        Point end;
+        GetHandLine(current, hand, angle, start, end);
+        /* 2: half of the line on each side */
+        int16_t margin = hand.width_ / 2 + HAND_PIECE_MARGIN;
+        for (uint8_t i = 0; i < HAND_PIECE_NUM; i++) {
+            int16_t x1 = start.x + (end.x - start.x) * i / HAND_PIECE_NUM;
+            int16_t y1 = start.y + (end.y - start.y) * i / HAND_PIECE_NUM;
+            int16_t x2 = start.x + (end.x - start.x) * (i + 1) / HAND_PIECE_NUM;
+            int16_t y2 = start.y + (end.y - start.y) * (i + 1) / HAND_PIECE_NUM;
+            InvalidateRect(Rect(MATH_MIN(x1, x2) - margin, MATH_MIN(y1, y2) - margin, MATH_MAX(x1, x2) + margin,
+                                MATH_MAX(y1, y2) + margin));
+        }
+        return;
+    }
+
+    if (hand.imageInfo_.data == nullptr) {
+        return;
+    }
+    int16_t imgWidth = hand.imageInfo_.header.width;
+    int16_t imgHeight = hand.imageInfo_.header.height;
+    int16_t left = hand.position_.x + current.GetLeft();
+    int16_t top = hand.position_.y + current.GetTop();
+    for (uint8_t i = 0; i < HAND_PIECE_NUM; i++) {
+        int16_t rowStart = imgHeight * i / HAND_PIECE_NUM;
+        int16_t rowEnd = imgHeight * (i + 1) / HAND_PIECE_NUM - 1;
+        if (rowEnd < rowStart) {
+            continue;
+        }
+        /* each strip of rows turns around the same center as the whole image */
+        TransformMap pieceMap(Rect(left, top + rowStart, left + imgWidth - 1, top + rowEnd));
+        Vector2<float> pivot;
+        pivot.x_ = hand.center_.x;
+        pivot.y_ = hand.center_.y - rowStart;
+        pieceMap.Rotate(angle - hand.initAngle_, pivot);
+        Rect piece = pieceMap.GetBoxRect();
+        /* the bilinear filter and the rounding of the rotated edges reach beyond the strip */
+        InvalidateRect(Rect(piece.GetLeft() - HAND_PIECE_MARGIN, piece.GetTop() - HAND_PIECE_MARGIN,
+                            piece.GetRight() + HAND_PIECE_MARGIN, piece.GetBottom() + HAND_PIECE_MARGIN));
     }
 }
 
@@ -275,6 +356,10 @@ void UIAnalogClock::DrawHandImage(BufferInfo& gfxDstBuffer,
     if (hand.imageInfo_.data == nullptr) {
         return;
     }
+    if (hand.imageInfo_.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+        GRAPHIC_LOGE("UIAnalogClock::DrawHandImage row-indexed images can not be rotated");
+        return;
+    }
     uint8_t pxSize = DrawUtils::GetPxSizeByColorMode(hand.imageInfo_.header.colorMode);
     TransformDataInfo imageTranDataInfo = {hand.imageInfo_.header, hand.imageInfo_.data, pxSize, BlurLevel::LEVEL0,
                                            TransformAlgorithm::BILINEAR};
@@ -284,15 +369,21 @@ void UIAnalogClock::DrawHandImage(BufferInfo& gfxDstBuffer,
 
 void UIAnalogClock::DrawHandLine(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea, Hand& hand)
 {
-    float sinma = Sin(hand.nextAngle_);
-    float cosma = Sin(hand.nextAngle_ + THREE_QUARTER_IN_DEGREE);
-    int32_t handLength = hand.height_;
-    Rect rect = GetRect();
     Point start;
     Point end;
+    GetHandLine(GetRect(), hand, hand.nextAngle_, start, end);
+    BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, start, end, invalidatedArea, hand.width_, hand.color_,
+                                           hand.opacity_);
+}
+
+void UIAnalogClock::GetHandLine(const Rect& current, const Hand& hand, uint16_t angle, Point& start, Point& end) const
+{
+    float sinma = Sin(angle);
+    float cosma = Sin(angle + THREE_QUARTER_IN_DEGREE);
+    int32_t handLength = hand.height_;
     Point curCenter;
-    curCenter.x = hand.position_.x + hand.center_.x + rect.GetLeft();
-    curCenter.y = hand.position_.y + hand.center_.y + rect.GetTop();
+    curCenter.x = hand.position_.x + hand.center_.x + current.GetLeft();
+    curCenter.y = hand.position_.y + hand.center_.y + current.GetTop();
 
     int32_t startToCenterLength = hand.center_.y;
 
@@ -312,9 +403,6 @@ void UIAnalogClock::DrawHandLine(BufferInfo& gfxDstBuffer, const Rect& invalidat
     int32_t ylength = static_cast<int32_t>((startToCenterLength - handLength) * cosma);
     end.x = xlength + curCenter.x;
     end.y = ylength + curCenter.y;
-
-    BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, start, end, invalidatedArea, hand.width_, hand.color_,
-                                           hand.opacity_);
 }
 
 void UIAnalogClock::SetWorkMode(WorkMode newMode)
@@ -328,7 +416,135 @@ void UIAnalogClock::SetWorkMode(WorkMode newMode)
          */
         isViewGroup_ = (newMode == ALWAYS_ON) ? false : true;
         mode_ = newMode;
+        if (newMode == ALWAYS_ON) {
+            ReleaseDialCache();
+        }
+        Invalidate();
+    }
+}
+
+void UIAnalogClock::InvalidateTimeChange()
+{
+    /*
+     * UpdateClock has already invalidated the strips swept by the hands. Without a layer, because it was never built,
+     * could not be allocated or does not fit in DIAL_CACHE_MAX_SIZE, the whole clock is redrawn.
+     */
+    if (!IsDialCacheReady()) {
         Invalidate();
     }
 }
+
+void UIAnalogClock::SetDialCacheEnable(bool enable)
+{
+    useDialCache_ = enable;
+    if (!enable) {
+        ReleaseDialCache();
+    }
+    Invalidate();
+}
+
+void UIAnalogClock::RefreshDial()
+{
+    dialCacheValid_ = false;
+    Invalidate();
+}
+
+uint32_t UIAnalogClock::GetDialCacheSize()
+{
+    return dialCacheSize_;
+}
+
+void UIAnalogClock::OnChildChanged()
+{
+    dialCacheValid_ = false;
+}
+
+bool UIAnalogClock::DrawDialCache(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
+{
+    /* a transformed clock is drawn through the map buffer of the root view, which the layer does not fit */
+    bool transformed = !IsTransInvalid();
+    for (UIView* view = childrenHead_; (view != nullptr) && !transformed; view = view->GetNextSibling()) {
+        transformed = IsViewTreeTransformed(view);
+    }
+    if (!useDialCache_ || (mode_ != NORMAL) || transformed) {
+        ReleaseDialCache();
+        return false;
+    }
+    Rect rect = GetRect();
+    if (!dialCacheValid_ || (dialCacheWidth_ != rect.GetWidth()) || (dialCacheHeight_ != rect.GetHeight()) ||
+        (dialCacheOpa_ != opaScale_)) {
+        if (!BuildDialCache(rect)) {
+            ReleaseDialCache();
+            return false;
+        }
+    }
+    /* the root view must not draw the children over the layer again */
+    childrenDrawnByGroup_ = true;
+    DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, rect, invalidatedArea, dialCache_, OPA_OPAQUE,
+                                        DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+    return true;
+}
+
+bool UIAnalogClock::BuildDialCache(const Rect& rect)
+{
+    int16_t width = rect.GetWidth();
+    int16_t height = rect.GetHeight();
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    uint32_t size = static_cast<uint32_t>(width) * height * sizeof(Color32);
+    if ((dialCache_ == nullptr) || (width != dialCacheWidth_) || (height != dialCacheHeight_)) {
+        ReleaseDialCache();
+        if (dialCacheSize_ + size > DIAL_CACHE_MAX_SIZE) {
+            return false;
+        }
+        dialCache_ = new uint8_t[size];
+        if (dialCache_ == nullptr) {
+            GRAPHIC_LOGE("UIAnalogClock::BuildDialCache new data fail");
+            return false;
+        }
+        dialCacheWidth_ = width;
+        dialCacheHeight_ = height;
+        dialCacheSize_ += size;
+    }
+    (void)memset_s(dialCache_, size, 0, size);
+
+    BufferInfo buffer;
+    buffer.rect = Rect(0, 0, width - 1, height - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = dialCache_;
+    buffer.stride = width * sizeof(Color32);
+    buffer.width = width;
+    buffer.height = height;
+    /* the clock is moved to the origin of the layer while the dial is drawn */
+    int16_t x = GetX();
+    int16_t y = GetY();
+    SetPosition(x - rect.GetLeft(), y - rect.GetTop());
+    BaseGfxEngine::GetInstance()->DrawRect(buffer, GetRect(), buffer.rect, *style_, opaScale_);
+    Rect mask = GetContentRect();
+    if (mask.Intersect(mask, buffer.rect)) {
+        for (UIView* view = childrenHead_; view != nullptr; view = view->GetNextSibling()) {
+            DrawViewTree(buffer, view, mask);
+        }
+    }
+    SetPosition(x, y);
+
+    dialCacheOpa_ = opaScale_;
+    dialCacheValid_ = true;
+    return true;
+}
+
+void UIAnalogClock::ReleaseDialCache()
+{
+    if (dialCache_ != nullptr) {
+        delete[] dialCache_;
+        dialCache_ = nullptr;
+        dialCacheSize_ -= static_cast<uint32_t>(dialCacheWidth_) * dialCacheHeight_ * sizeof(Color32);
+    }
+    dialCacheWidth_ = 0;
+    dialCacheHeight_ = 0;
+    dialCacheValid_ = false;
+    childrenDrawnByGroup_ = false;
+}
 } // namespace OHOS
@@ -18,19 +18,151 @@
 #include "draw/draw_label.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "font/ui_font.h"
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
 #include "themes/theme_manager.h"
 
 namespace OHOS {
+namespace {
+/* the cache is rendered in bands of rows, each band is at most this many bytes */
+constexpr uint32_t TEXT_CACHE_BAND_SIZE = 16 * 1024; // 16 * 1024: 16KB
+} // namespace
+
+/* The coverage of the whole arc text of a label, relative to the rect of the label. */
+class ArcTextCache : public HeapBase {
+public:
+    /* Everything that moves a letter of the arc text. */
+    struct Key {
+        uint8_t fontId;
+        uint8_t fontSize;
+        int16_t letterSpace;
+        uint16_t radius;
+        float startAngle;
+        Point arcCenter;
+        uint32_t lineStart;
+        uint32_t lineEnd;
+        UIArcLabel::TextOrientation orientation;
+        int16_t width;
+        int16_t height;
+    };
+
+    ArcTextCache() : data_(nullptr), key_{}, valid_(false) {}
+    ~ArcTextCache()
+    {
+        delete[] data_;
+        data_ = nullptr;
+    }
+
+    bool IsValid(const Key& key) const
+    {
+        return valid_ && (key.fontId == key_.fontId) && (key.fontSize == key_.fontSize) &&
+               (key.letterSpace == key_.letterSpace) && (key.radius == key_.radius) &&
+               (key.startAngle == key_.startAngle) && (key.arcCenter.x == key_.arcCenter.x) &&
+               (key.arcCenter.y == key_.arcCenter.y) && (key.lineStart == key_.lineStart) &&
+               (key.lineEnd == key_.lineEnd) && (key.orientation == key_.orientation) && (key.width == key_.width) &&
+               (key.height == key_.height);
+    }
+
+    void Invalidate()
+    {
+        valid_ = false;
+    }
+
+    uint32_t GetSize() const
+    {
+        return (data_ == nullptr) ? 0 : static_cast<uint32_t>(key_.width) * key_.height;
+    }
+
+    bool Render(const char* text, const UIArcLabel::ArcTextInfo& arcTextInfo, const Style& style, const Key& key);
+
+    void Draw(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& mask, const ColorType& color,
+              OpacityType opa) const
+    {
+        Rect subRect = mask;
+        if (subRect.Intersect(subRect, rect)) {
+            DrawUtils::GetInstance()->DrawLetter(gfxDstBuffer, data_, rect, subRect, FONT_WEIGHT_8, color, opa);
+        }
+    }
+
+private:
+    uint8_t* data_;
+    Key key_;
+    bool valid_;
+};
+
+bool ArcTextCache::Render(const char* text,
+                          const UIArcLabel::ArcTextInfo& arcTextInfo,
+                          const Style& style,
+                          const Key& key)
+{
+    uint32_t size = static_cast<uint32_t>(key.width) * key.height;
+    if ((key.width <= 0) || (key.height <= 0) || (size > UIArcLabel::TEXT_CACHE_MAX_SIZE)) {
+        return false;
+    }
+    if ((data_ == nullptr) || (size != GetSize())) {
+        delete[] data_;
+        data_ = new uint8_t[size];
+        if (data_ == nullptr) {
+            GRAPHIC_LOGE("ArcTextCache::Render new data fail");
+            return false;
+        }
+    }
+    key_ = key;
+    int16_t bandRows = static_cast<int16_t>(TEXT_CACHE_BAND_SIZE / (key.width * sizeof(Color32)));
+    bandRows = MATH_MAX(MATH_MIN(bandRows, key.height), 1);
+    uint32_t bandSize = static_cast<uint32_t>(key.width) * bandRows * sizeof(Color32);
+    uint8_t* band = new uint8_t[bandSize];
+    if (band == nullptr) {
+        GRAPHIC_LOGE("ArcTextCache::Render new band fail");
+        delete[] data_;
+        data_ = nullptr;
+        return false;
+    }
+    BufferInfo bandBuffer;
+    bandBuffer.rect = Rect(0, 0, key.width - 1, bandRows - 1);
+    bandBuffer.mode = ARGB8888;
+    bandBuffer.color = 0;
+    bandBuffer.phyAddr = bandBuffer.virAddr = band;
+    bandBuffer.stride = key.width * sizeof(Color32);
+    bandBuffer.width = key.width;
+    bandBuffer.height = bandRows;
+
+    /* opaque white letters on a transparent band leave the coverage in the alpha channel */
+    Style coverStyle = style;
+    coverStyle.textColor_ = Color::White();
+    coverStyle.textOpa_ = OPA_OPAQUE;
+    uint8_t* coverage = data_;
+    for (int16_t top = 0; top < key.height; top += bandRows) {
+        int16_t rows = MATH_MIN(bandRows, static_cast<int16_t>(key.height - top));
+        (void)memset_s(band, bandSize, 0, bandSize);
+        /* moving the center up by top draws the rows of this band at the top of the buffer */
+        Point center = {key.arcCenter.x, static_cast<int16_t>(key.arcCenter.y - top)};
+        DrawLabel::DrawArcText(bandBuffer, Rect(0, 0, key.width - 1, rows - 1), text, center, key.fontId,
+                               arcTextInfo, key.orientation, coverStyle, OPA_OPAQUE);
+        const Color32* pixel = reinterpret_cast<const Color32*>(band);
+        for (uint32_t i = 0; i < static_cast<uint32_t>(key.width) * rows; i++) {
+            *coverage++ = pixel[i].alpha;
+        }
+    }
+    delete[] band;
+    valid_ = true;
+    return true;
+}
+
+constexpr uint32_t UIArcLabel::TEXT_CACHE_MAX_SIZE;
+
 UIArcLabel::UIArcLabel()
     : arcLabelText_(nullptr),
       needRefresh_(false),
+      useTextCache_(false),
       textSize_({0, 0}),
       radius_(0),
       startAngle_(0),
       endAngle_(0),
       arcCenter_({0, 0}),
       orientation_(TextOrientation::INSIDE),
-      arcTextInfo_{0}
+      arcTextInfo_{0},
+      textCache_(nullptr)
 {
     Theme* theme = ThemeManager::GetInstance().GetCurrent();
     style_ = (theme != nullptr) ? &(theme->GetLabelStyle()) : &(StyleDefault::GetLabelStyle());
@@ -42,6 +174,7 @@ UIArcLabel::~UIArcLabel()
         delete arcLabelText_;
         arcLabelText_ = nullptr;
     }
+    ReleaseTextCache();
 }
 
 void UIArcLabel::SetStyle(uint8_t key, int64_t value)
@@ -135,12 +268,75 @@ void UIArcLabel::DrawArcText(BufferInfo& gfxDstBuffer, const Rect& mask, Opacity
     center.y = arcTextInfo_.arcCenter.y + GetRect().GetY();
     InitArcLabelText();
     UIFont::GetInstance()->SetCurrentFontId(arcLabelText_->GetFontId(), arcLabelText_->GetFontSize());
+    if (useTextCache_ && DrawTextCache(gfxDstBuffer, mask, opaScale)) {
+        return;
+    }
     DrawLabel::DrawArcText(gfxDstBuffer, mask, arcLabelText_->GetText(), center, arcLabelText_->GetFontId(),
                            arcTextInfo_, orientation_, *style_, opaScale);
 }
 
+bool UIArcLabel::DrawTextCache(BufferInfo& gfxDstBuffer, const Rect& mask, OpacityType opaScale)
+{
+    if ((arcTextInfo_.lineStart == arcTextInfo_.lineEnd) || (arcTextInfo_.radius == 0)) {
+        return false;
+    }
+    if (DrawUtils::GetMixOpacity(opaScale, style_->textOpa_) == OPA_TRANSPARENT) {
+        return true;
+    }
+    Rect rect = GetRect();
+    if (static_cast<uint32_t>(rect.GetWidth()) * rect.GetHeight() > TEXT_CACHE_MAX_SIZE) {
+        ReleaseTextCache();
+        return false;
+    }
+    if (textCache_ == nullptr) {
+        textCache_ = new ArcTextCache();
+        if (textCache_ == nullptr) {
+            GRAPHIC_LOGE("new ArcTextCache fail");
+            return false;
+        }
+    }
+    ArcTextCache::Key key = {arcLabelText_->GetFontId(), arcLabelText_->GetFontSize(), style_->letterSpace_,
+                             arcTextInfo_.radius, arcTextInfo_.startAngle, arcTextInfo_.arcCenter,
+                             arcTextInfo_.lineStart, arcTextInfo_.lineEnd, orientation_, rect.GetWidth(),
+                             rect.GetHeight()};
+    if (!textCache_->IsValid(key) && !textCache_->Render(arcLabelText_->GetText(), arcTextInfo_, *style_, key)) {
+        ReleaseTextCache();
+        return false;
+    }
+    textCache_->Draw(gfxDstBuffer, rect, mask, style_->textColor_, opaScale);
+    return true;
+}
+
+void UIArcLabel::SetTextCacheEnable(bool enable)
+{
+    if (useTextCache_ == enable) {
+        return;
+    }
+    useTextCache_ = enable;
+    if (!enable) {
+        ReleaseTextCache();
+    }
+    Invalidate();
+}
+
+uint32_t UIArcLabel::GetTextCacheSize() const
+{
+    return (textCache_ == nullptr) ? 0 : textCache_->GetSize();
+}
+
+void UIArcLabel::ReleaseTextCache()
+{
+    if (textCache_ != nullptr) {
+        delete textCache_;
+        textCache_ = nullptr;
+    }
+}
+
 void UIArcLabel::RefreshArcLabel()
 {
+    if (textCache_ != nullptr) {
+        textCache_->Invalidate();
+    }
     Invalidate();
     if (!needRefresh_) {
         needRefresh_ = true;
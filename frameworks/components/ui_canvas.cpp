@@ -15,11 +15,15 @@
 
 #include "components/ui_canvas.h"
 
+#include <cfloat>
+#include <cmath>
 #include "draw/clip_utils.h"
 #include "draw/draw_arc.h"
 #include "draw/draw_image.h"
 #include "draw/draw_utils.h"
+#include "draw/shadow_mask_cache.h"
 #include "gfx_utils/graphic_log.h"
+#include "render/render_blur.h"
 #include "render/render_buffer.h"
 #include "render/render_pixfmt_rgba_blend.h"
 #include "render/render_scanline.h"
@@ -37,6 +41,21 @@ void RenderSolid(const Paint& paint,
                  RenderBase& renBase,
                  const bool& isStroke);
 
+#if GRAPHIC_ENABLE_SHADOW_EFFECT_FLAG && GRAPHIC_ENABLE_BLUR_EFFECT_FLAG
+namespace {
+constexpr uint8_t MATRIX_SIZE = 6;
+constexpr uint8_t MATRIX_TRANSLATE_X = 2;
+constexpr uint8_t MATRIX_TRANSLATE_Y = 5;
+} // namespace
+
+void BlendShadowMask(RenderBase& renBase,
+                     const ShadowMask& mask,
+                     int32_t originX,
+                     int32_t originY,
+                     const Rect& invalidatedArea,
+                     const Rgba8T& color);
+#endif
+
 void UICanvas::BeginPath()
 {
     /* If the previous path is not added to the drawing linked list, it should be destroyed directly. */
@@ -1171,13 +1190,7 @@ void UICanvas::DoDrawShadow(BufferInfo& gfxDstBuffer,
 
     transform.Translate(paint.GetShadowOffsetX(), paint.GetShadowOffsetY());
 
-    RasterizerScanlineAntialias rasterizer;
-    GeometryScanline scanline;
     PathParam* pathParam = static_cast<PathParam*>(param);
-    rasterizer.ClipBox(0, 0, gfxDstBuffer.width, gfxDstBuffer.height);
-    SetRasterizer(*pathParam->vertices, paint, rasterizer, transform, isStroke);
-    Rect bbox(rasterizer.GetMinX(), rasterizer.GetMinY(), rasterizer.GetMaxX(), rasterizer.GetMaxY());
-
     RenderPixfmtRgbaBlend pixFormat(renderBuffer);
     RenderBase renBase(pixFormat);
     FillBase allocator;
@@ -1188,6 +1201,19 @@ void UICanvas::DoDrawShadow(BufferInfo& gfxDstBuffer,
 
     Rgba8T shadowColor;
     ChangeColor(shadowColor, paint.GetShadowColor(), paint.GetShadowColor().alpha * paint.GetGlobalAlpha());
+#if GRAPHIC_ENABLE_BLUR_EFFECT_FLAG
+    if ((paint.GetShadowBlur() > 0) &&
+        DrawShadowMask(renBase, *pathParam, paint, transform, invalidatedArea, shadowColor, isStroke)) {
+        return;
+    }
+#endif
+
+    /* shadows without blur, and blurred shadows too large for the mask cache, are drawn in the frame buffer */
+    RasterizerScanlineAntialias rasterizer;
+    GeometryScanline scanline;
+    rasterizer.ClipBox(0, 0, gfxDstBuffer.width, gfxDstBuffer.height);
+    SetRasterizer(*pathParam->vertices, paint, rasterizer, transform, isStroke);
+    Rect bbox(rasterizer.GetMinX(), rasterizer.GetMinY(), rasterizer.GetMaxX(), rasterizer.GetMaxY());
 
     RenderScanlinesAntiAliasSolid(rasterizer, scanline, renBase, shadowColor);
 #if GRAPHIC_ENABLE_BLUR_EFFECT_FLAG
@@ -1211,6 +1237,157 @@ void UICanvas::DoDrawShadow(BufferInfo& gfxDstBuffer,
 #endif
 }
 #endif
+
+#if GRAPHIC_ENABLE_SHADOW_EFFECT_FLAG && GRAPHIC_ENABLE_BLUR_EFFECT_FLAG
+bool UICanvas::DrawShadowMask(RenderBase& renBase,
+                              const PathParam& pathParam,
+                              const Paint& paint,
+                              const TransAffine& shadowTransform,
+                              const Rect& invalidatedArea,
+                              const Rgba8T& shadowColor,
+                              const bool& isStroke)
+{
+    /* The mask is kept relative to the integer translation, so it stays valid while the canvas moves. */
+    TransAffine transform = shadowTransform;
+    int32_t originX = static_cast<int32_t>(floorf(transform.GetData()[MATRIX_TRANSLATE_X]));
+    int32_t originY = static_cast<int32_t>(floorf(transform.GetData()[MATRIX_TRANSLATE_Y]));
+    transform.SetData(MATRIX_TRANSLATE_X, transform.GetData()[MATRIX_TRANSLATE_X] - originX);
+    transform.SetData(MATRIX_TRANSLATE_Y, transform.GetData()[MATRIX_TRANSLATE_Y] - originY);
+
+    UICanvasVertices& vertices = *pathParam.vertices;
+    ShadowMaskKey key;
+    key.vertexNum = vertices.GetTotalVertices();
+    key.pathHash = ShadowMaskCache::Hash(&key.vertexNum, sizeof(key.vertexNum));
+    key.minX = key.minY = FLT_MAX;
+    key.maxX = key.maxY = -FLT_MAX;
+    vertices.Rewind(0);
+    for (uint32_t i = 0; i < key.vertexNum; i++) {
+        float point[2]; // 2: x and y
+        uint32_t cmd = vertices.GenerateVertex(&point[0], &point[1]);
+        key.pathHash = ShadowMaskCache::Hash(&cmd, sizeof(cmd), key.pathHash);
+        key.pathHash = ShadowMaskCache::Hash(point, sizeof(point), key.pathHash);
+        key.minX = MATH_MIN(key.minX, point[0]);
+        key.minY = MATH_MIN(key.minY, point[1]);
+        key.maxX = MATH_MAX(key.maxX, point[0]);
+        key.maxY = MATH_MAX(key.maxY, point[1]);
+    }
+    key.paramHash = GetShadowParamHash(paint, transform.GetData(), isStroke);
+    key.radius = paint.GetShadowBlur();
+
+    ShadowMaskCache& cache = ShadowMaskCache::GetInstance();
+    const ShadowMask* mask = cache.Get(key);
+    if (mask != nullptr) {
+        BlendShadowMask(renBase, *mask, originX, originY, invalidatedArea, shadowColor);
+        return true;
+    }
+
+    RasterizerScanlineAntialias rasterizer;
+    GeometryScanline scanline;
+    SetRasterizer(vertices, paint, rasterizer, transform, isStroke);
+    if (!rasterizer.RewindScanlines()) {
+        return true;
+    }
+    int32_t extent = RenderBlur::GetBoxBlurExtent(key.radius);
+    int32_t left = rasterizer.GetMinX() - extent;
+    int32_t top = rasterizer.GetMinY() - extent;
+    int32_t width = rasterizer.GetMaxX() - rasterizer.GetMinX() + 1 + 2 * extent;  // 2: both sides
+    int32_t height = rasterizer.GetMaxY() - rasterizer.GetMinY() + 1 + 2 * extent; // 2: both sides
+    if ((left < INT16_MIN) || (top < INT16_MIN) || (width > INT16_MAX) || (height > INT16_MAX) ||
+        (static_cast<uint32_t>(width) * height > ShadowMaskCache::MAX_CACHE_SIZE)) {
+        return false;
+    }
+    uint32_t size = static_cast<uint32_t>(width) * height;
+    ShadowMask newMask = {nullptr, static_cast<int16_t>(left), static_cast<int16_t>(top),
+                          static_cast<int16_t>(width), static_cast<int16_t>(height)};
+    newMask.alpha = new uint8_t[size];
+    if (newMask.alpha == nullptr) {
+        GRAPHIC_LOGE("new shadow mask fail");
+        return false;
+    }
+    (void)memset_s(newMask.alpha, size, 0, size);
+
+    scanline.Reset(rasterizer.GetMinX(), rasterizer.GetMaxX());
+    while (rasterizer.SweepScanline(scanline)) {
+        uint8_t* row = newMask.alpha + (scanline.GetYLevel() - top) * width;
+        uint32_t numSpans = scanline.NumSpans();
+        GeometryScanline::ConstIterator span = scanline.Begin();
+        while (true) {
+            int32_t x = span->x - left;
+            if (span->spanLength > 0) {
+                (void)memcpy_s(row + x, width - x, span->covers, span->spanLength);
+            } else {
+                (void)memset_s(row + x, width - x, *(span->covers), -span->spanLength);
+            }
+            if (--numSpans == 0) {
+                break;
+            }
+            ++span;
+        }
+    }
+    if (!RenderBlur::BoxBlurAlpha(newMask.alpha, newMask.width, newMask.height, key.radius)) {
+        delete[] newMask.alpha;
+        return false;
+    }
+
+    BlendShadowMask(renBase, newMask, originX, originY, invalidatedArea, shadowColor);
+    if (!cache.Put(key, newMask)) {
+        delete[] newMask.alpha;
+    }
+    return true;
+}
+
+uint64_t UICanvas::GetShadowParamHash(const Paint& paint, const float* matrix, const bool& isStroke)
+{
+    uint64_t hash = ShadowMaskCache::Hash(matrix, MATRIX_SIZE * sizeof(float));
+    hash = ShadowMaskCache::Hash(&isStroke, sizeof(isStroke), hash);
+    if (!isStroke) {
+        return hash;
+    }
+    uint16_t strokeWidth = paint.GetStrokeWidth();
+    hash = ShadowMaskCache::Hash(&strokeWidth, sizeof(strokeWidth), hash);
+#if GRAPHIC_ENABLE_LINECAP_FLAG
+    LineCap lineCap = paint.GetLineCap();
+    hash = ShadowMaskCache::Hash(&lineCap, sizeof(lineCap), hash);
+#endif
+#if GRAPHIC_ENABLE_LINEJOIN_FLAG
+    LineJoin lineJoin = paint.GetLineJoin();
+    float miterLimit = paint.GetMiterLimit();
+    hash = ShadowMaskCache::Hash(&lineJoin, sizeof(lineJoin), hash);
+    hash = ShadowMaskCache::Hash(&miterLimit, sizeof(miterLimit), hash);
+#endif
+#if GRAPHIC_ENABLE_DASH_GENERATE_FLAG
+    if (paint.IsLineDash() && (paint.GetLineDash() != nullptr)) {
+        float dashOffset = paint.GetLineDashOffset();
+        hash = ShadowMaskCache::Hash(paint.GetLineDash(), paint.GetLineDashCount() * sizeof(float), hash);
+        hash = ShadowMaskCache::Hash(&dashOffset, sizeof(dashOffset), hash);
+    }
+#endif
+    return hash;
+}
+
+void BlendShadowMask(RenderBase& renBase,
+                     const ShadowMask& mask,
+                     int32_t originX,
+                     int32_t originY,
+                     const Rect& invalidatedArea,
+                     const Rgba8T& color)
+{
+    int32_t left = originX + mask.left;
+    int32_t top = originY + mask.top;
+    int32_t startX = MATH_MAX(left, static_cast<int32_t>(invalidatedArea.GetLeft()));
+    int32_t endX = MATH_MIN(left + mask.width - 1, static_cast<int32_t>(invalidatedArea.GetRight()));
+    int32_t startY = MATH_MAX(top, static_cast<int32_t>(invalidatedArea.GetTop()));
+    int32_t endY = MATH_MIN(top + mask.height - 1, static_cast<int32_t>(invalidatedArea.GetBottom()));
+    if ((startX > endX) || (startY > endY)) {
+        return;
+    }
+    for (int32_t y = startY; y <= endY; y++) {
+        const uint8_t* covers = mask.alpha + (y - top) * mask.width + (startX - left);
+        renBase.BlendSolidHSpan(startX, y, static_cast<uint32_t>(endX - startX + 1), color, covers);
+    }
+}
+#endif
+
 /**
  * Renders monochrome polygon paths and fills
  */
@@ -535,17 +535,19 @@ void UIChartPolyline::DrawSmoothPolyLine(BufferInfo& gfxDstBuffer,
     if (data == nullptr) {
         return;
     }
+    /* the first point, one point per turn and the last point */
+    Point* points = static_cast<Point*>(UIMalloc(sizeof(Point) * (endIndex - startIndex + 2))); // 2: first, last
+    if (points == nullptr) {
+        return;
+    }
     Point start;
     Point end;
-    ColorType color = data->GetLineColor();
-    Style style = *style_;
-    style.lineColor_ = color;
-    style.lineOpa_ = OPA_OPAQUE;
-
     uint16_t slope;
     data->GetPoint(startIndex, start);
     data->GetPoint(startIndex + 1, end);
     uint16_t preSlope = (start.x == end.x) ? QUARTER_IN_DEGREE : FastAtan2(end.x - start.x, end.y - start.y);
+    uint16_t pointNum = 0;
+    points[pointNum++] = start;
     Point current;
     for (uint16_t i = startIndex; i < endIndex; i++) {
         data->GetPoint(i + 1, current);
@@ -558,34 +560,16 @@ void UIChartPolyline::DrawSmoothPolyLine(BufferInfo& gfxDstBuffer,
             }
         }
         preSlope = (current.x == end.x) ? QUARTER_IN_DEGREE : FastAtan2(current.x - end.x, current.y - end.y);
-        Rect rect;
-        rect.SetLeft(MATH_MIN(start.x, end.x) - style_->lineWidth_);
-        rect.SetRight(MATH_MAX(start.x, end.x) + style_->lineWidth_);
-        rect.SetTop(MATH_MIN(start.y, end.y) - style_->lineWidth_);
-        rect.SetBottom(MATH_MAX(start.y, end.y) + style_->lineWidth_);
-        if (!invalidatedArea.IsIntersect(rect)) {
-            start = end;
-            end = current;
-            continue;
-        }
-
-        BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, start, end, invalidatedArea,
-            style_->lineWidth_, color, OPA_OPAQUE);
-        ArcInfo arcinfo = {{0}};
-        arcinfo.center = end;
-        arcinfo.imgPos = Point{0, 0};
-        arcinfo.radius = (style_->lineWidth_ + 1) >> 1;
-        arcinfo.startAngle = 0;
-        arcinfo.endAngle = CIRCLE_IN_DEGREE;
-
-        BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcinfo, invalidatedArea,
-            style, OPA_OPAQUE, CapType::CAP_NONE);
-
+        points[pointNum++] = end;
         start = end;
         end = current;
     }
-    BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, start, end, invalidatedArea,
-        style_->lineWidth_, color, OPA_OPAQUE);
+    points[pointNum++] = end;
+
+    /* stroked as one polyline, so the joints are round and blended once */
+    BaseGfxEngine::GetInstance()->DrawPolyline(gfxDstBuffer, points, pointNum, invalidatedArea,
+        style_->lineWidth_, data->GetLineColor(), OPA_OPAQUE);
+    UIFree(points);
 }
 
 void UIChartPolyline::DrawPolyLine(BufferInfo& gfxDstBuffer,
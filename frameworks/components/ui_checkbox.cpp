@@ -16,8 +16,11 @@
 #include "components/ui_checkbox.h"
 #include "default_resource/check_box_res.h"
 #include "draw/draw_image.h"
+#include "draw/state_sprite_cache.h"
 #include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/graphic_log.h"
 #include "imgdecode/cache_manager.h"
+#include "securec.h"
 
 namespace OHOS {
 namespace {
@@ -241,23 +244,96 @@ void UICheckBox::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
             return;
         }
         CalculateSize();
-        int16_t rectLineWidth = borderWidth_ / DEFAULT_BORDER_WIDTH;
-        int16_t borderRadius = rectLineWidth * DEFAULT_RATIO_BORDER_RADIUS_LINE_WIDTH;
         BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, GetRect(), invalidatedArea, *style_, opaScale_);
-        int16_t x = contentRect.GetX() + (width_ - borderWidth_) / 2;  // 2: half
-        int16_t y = contentRect.GetY() + (height_ - borderWidth_) / 2; // 2: half
-        Rect rect(x, y, x + borderWidth_, y + borderWidth_);
+        DrawSoftwareStateSprite(gfxDstBuffer, trunc);
+    }
+}
+
+void UICheckBox::DrawSoftwareState(BufferInfo& gfxDstBuffer, const Rect& contentRect, const Rect& trunc)
+{
+    int16_t rectLineWidth = borderWidth_ / DEFAULT_BORDER_WIDTH;
+    int16_t borderRadius = rectLineWidth * DEFAULT_RATIO_BORDER_RADIUS_LINE_WIDTH;
+    int16_t x = contentRect.GetX() + (width_ - borderWidth_) / 2;  // 2: half
+    int16_t y = contentRect.GetY() + (height_ - borderWidth_) / 2; // 2: half
+    Rect rect(x, y, x + borderWidth_, y + borderWidth_);
 #if DEFAULT_ANIMATION
-        UnSelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
-        SelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
+    UnSelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
+    SelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
 #else
-        if (state_ == SELECTED) {
-            SelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
-        } else {
-            UnSelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
-        }
+    if (state_ == SELECTED) {
+        SelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
+    } else {
+        UnSelectedStateSoftwareDrawing(gfxDstBuffer, rect, trunc, borderRadius, rectLineWidth);
+    }
 #endif
+}
+
+void UICheckBox::GetSoftwareStateKey(uint32_t& color, uint32_t& step) const
+{
+    color = Color::ColorTo32(selectedStateColor_);
+    step = (static_cast<uint32_t>(state_) << 8) | backgroundOpacity_; // 8: above the opacity
+}
+
+void UICheckBox::DrawSoftwareStateSprite(BufferInfo& gfxDstBuffer, const Rect& trunc)
+{
+    Rect contentRect = GetContentRect();
+    StateSpriteCache& cache = StateSpriteCache::GetInstance();
+    if (!cache.IsEnabled()) {
+        DrawSoftwareState(gfxDstBuffer, contentRect, trunc);
+        return;
+    }
+    /* width_ and height_ are the sizes CalculateSize derived the geometry of the state from */
+    StateSpriteKey key = {static_cast<uint8_t>(GetViewType()), contentRect.GetWidth(), contentRect.GetHeight(),
+                          width_, height_, 0, 0};
+    GetSoftwareStateKey(key.color, key.step);
+    const uint8_t* sprite = cache.Get(key);
+    if (sprite == nullptr) {
+        uint8_t* data = RasterizeSoftwareState(key.width, key.height);
+        if ((data == nullptr) || !cache.Put(key, data)) {
+            /* too large for the cache or out of memory, draw the state as it is */
+            delete[] data;
+            DrawSoftwareState(gfxDstBuffer, contentRect, trunc);
+            return;
+        }
+        sprite = data;
     }
+    DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, contentRect, trunc, sprite, opaScale_,
+                                        DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+}
+
+uint8_t* UICheckBox::RasterizeSoftwareState(int16_t width, int16_t height)
+{
+    if ((width <= 0) || (height <= 0)) {
+        return nullptr;
+    }
+    uint32_t size = static_cast<uint32_t>(width) * height * sizeof(Color32);
+    if (size > StateSpriteCache::MAX_CACHE_SIZE) {
+        return nullptr;
+    }
+    uint8_t* data = new uint8_t[size];
+    if (data == nullptr) {
+        GRAPHIC_LOGE("UICheckBox::RasterizeSoftwareState new buffer fail");
+        return nullptr;
+    }
+    if (memset_s(data, size, 0, size) != EOK) {
+        delete[] data;
+        return nullptr;
+    }
+    BufferInfo spriteBuffer;
+    spriteBuffer.rect = Rect(0, 0, width - 1, height - 1);
+    spriteBuffer.mode = ARGB8888;
+    spriteBuffer.color = 0;
+    spriteBuffer.phyAddr = spriteBuffer.virAddr = data;
+    spriteBuffer.stride = width * sizeof(Color32);
+    spriteBuffer.width = width;
+    spriteBuffer.height = height;
+
+    /* the sprite is opaque as drawn, opaScale_ applies when it is blitted */
+    uint8_t opaScale = opaScale_;
+    opaScale_ = OPA_OPAQUE;
+    DrawSoftwareState(spriteBuffer, spriteBuffer.rect, spriteBuffer.rect);
+    opaScale_ = opaScale;
+    return data;
 }
 
 void UICheckBox::SetSelectedStateColor(ColorType color)
@@ -16,6 +16,7 @@
 #include "components/ui_image_view.h"
 #include "common/image.h"
 #include "common/typed_text.h"
+#include "draw/clip_utils.h"
 #include "draw/draw_image.h"
 #include "draw/draw_label.h"
 #include "engines/gfx/gfx_engine_manager.h"
@@ -23,6 +24,7 @@
 #include "gfx_utils/image_info.h"
 #include "gfx_utils/mem_api.h"
 #include "imgdecode/cache_manager.h"
+#include "imgdecode/image_load.h"
 #if (ENABLE_GIF == 1)
 #include "gif_lib.h"
 #endif
@@ -250,6 +252,53 @@ UIImageView::~UIImageView()
         delete contentMatrix_;
         contentMatrix_ = nullptr;
     }
+    if (clipMask_ != nullptr) {
+        delete clipMask_;
+        clipMask_ = nullptr;
+    }
+}
+
+void UIImageView::SetClipCircle(const Point& center, int16_t radius)
+{
+    if (radius < 0) {
+        radius = 0;
+    }
+    if ((clipRadius_ == radius) && (clipCenter_.x == center.x) && (clipCenter_.y == center.y)) {
+        return;
+    }
+    clipCenter_ = center;
+    clipRadius_ = radius;
+    if (clipMask_ != nullptr) {
+        delete clipMask_;
+        clipMask_ = nullptr;
+    }
+    Invalidate();
+}
+
+const ClipMask* UIImageView::GetClipMask()
+{
+    if (clipRadius_ == 0) {
+        return nullptr;
+    }
+    if ((clipMask_ != nullptr) && (clipMask_->GetWidth() == imageWidth_) &&
+        (clipMask_->GetHeight() == imageHeight_)) {
+        return clipMask_;
+    }
+    if (clipMask_ == nullptr) {
+        clipMask_ = new ClipMask();
+        if (clipMask_ == nullptr) {
+            GRAPHIC_LOGE("UIImageView::GetClipMask new ClipMask fail");
+            return nullptr;
+        }
+    }
+    ClipPath path;
+    path.Circle({static_cast<float>(clipCenter_.x), static_cast<float>(clipCenter_.y)}, clipRadius_);
+    if (!clipMask_->Build(path, imageWidth_, imageHeight_)) {
+        GRAPHIC_LOGE("UIImageView::GetClipMask build mask fail");
+        delete clipMask_;
+        clipMask_ = nullptr;
+    }
+    return clipMask_;
 }
 
 void UIImageView::SetResizeMode(ImageResizeMode mode)
@@ -410,7 +459,7 @@ bool UIImageView::OnPreDraw(Rect& invalidatedArea) const
         return true;
     }
 
-    if ((colorFormat_ == RGB565) || (colorFormat_ == RGB888)) {
+    if (((colorFormat_ == RGB565) || (colorFormat_ == RGB888)) && (clipRadius_ == 0)) {
         if (GetRect().IsContains(invalidatedArea)) {
             return true;
         }
@@ -438,11 +487,12 @@ void UIImageView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
             cordsTmp.SetBottom(viewRect.GetY() + imageHeight_ - 1);
 
             if ((drawTransMap_ == nullptr) || drawTransMap_->IsInvalid()) {
+                const ClipMask* clipMask = GetClipMask();
                 while (cordsTmp.GetTop() <= viewRect.GetBottom()) {
                     cordsTmp.SetLeft(viewRect.GetX());
                     cordsTmp.SetRight(viewRect.GetX() + imageWidth_ - 1);
                     while (cordsTmp.GetLeft() <= viewRect.GetRight()) {
-                        image_.DrawImage(gfxDstBuffer, cordsTmp, trunc, *style_, opa);
+                        image_.DrawImage(gfxDstBuffer, cordsTmp, trunc, *style_, opa, clipMask);
                         cordsTmp.SetLeft(cordsTmp.GetLeft() + imageWidth_);
                         cordsTmp.SetRight(cordsTmp.GetRight() + imageWidth_);
                     }
@@ -461,6 +511,10 @@ void UIImageView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
                 } else {
                     imgInfo = *(GetImageInfo());
                 }
+                if (imgInfo.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+                    GRAPHIC_LOGE("UIImageView::OnDraw row-indexed images can not be transformed");
+                    return;
+                }
                 uint8_t pxSize = DrawUtils::GetPxSizeByColorMode(imgInfo.header.colorMode);
                 TransformDataInfo imageTranDataInfo = {imgInfo.header, imgInfo.data, pxSize,
                                                        static_cast<BlurLevel>(blurLevel_),
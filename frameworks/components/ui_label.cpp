@@ -14,8 +14,10 @@
  */
 
 #include "components/ui_label.h"
+#include "draw/draw_utils.h"
 #include "font/ui_font.h"
 #include "gfx_utils/graphic_log.h"
+#include "securec.h"
 #include "themes/theme_manager.h"
 
 namespace OHOS {
@@ -108,15 +110,118 @@ private:
     float decimal_;
 };
 
+/* The text of a rolling label rendered once, so that each frame only blits it at the roll position. */
+class LabelStrip : public HeapBase {
+public:
+    LabelStrip() : data_(nullptr), width_(0), height_(0), color_(Color::White()), opa_(OPA_OPAQUE), valid_(false) {}
+    ~LabelStrip()
+    {
+        Release();
+    }
+
+    static uint32_t GetUsedSize()
+    {
+        return usedSize_;
+    }
+
+    bool IsValid(int16_t width, int16_t height, const Style& style) const
+    {
+        return valid_ && (width == width_) && (height == height_) && (style.textColor_.full == color_.full) &&
+               (style.textOpa_ == opa_);
+    }
+
+    void Invalidate()
+    {
+        valid_ = false;
+    }
+
+    /* Returns false if the strip does not fit into UILabel::MARQUEE_STRIP_MAX_SIZE. */
+    bool Render(Text& text, const Style& style, uint16_t ellipsisIndex, int16_t width, int16_t height);
+
+    void Draw(BufferInfo& gfxDstBuffer, const Rect& mask, const Point& pos, OpacityType opa) const;
+
+    void Release();
+
+private:
+    static uint32_t usedSize_;
+
+    uint8_t* data_;
+    int16_t width_;
+    int16_t height_;
+    ColorType color_;
+    OpacityType opa_;
+    bool valid_;
+};
+
+uint32_t LabelStrip::usedSize_ = 0;
+
+bool LabelStrip::Render(Text& text, const Style& style, uint16_t ellipsisIndex, int16_t width, int16_t height)
+{
+    uint32_t size = static_cast<uint32_t>(width) * height * sizeof(Color32);
+    if ((data_ == nullptr) || (width != width_) || (height != height_)) {
+        Release();
+        if ((width <= 0) || (height <= 0) || (usedSize_ + size > UILabel::MARQUEE_STRIP_MAX_SIZE)) {
+            return false;
+        }
+        data_ = new uint8_t[size];
+        if (data_ == nullptr) {
+            GRAPHIC_LOGE("LabelStrip::Render new data fail");
+            return false;
+        }
+        width_ = width;
+        height_ = height;
+        usedSize_ += size;
+    }
+    (void)memset_s(data_, size, 0, size);
+
+    BufferInfo strip;
+    strip.rect = Rect(0, 0, width - 1, height - 1);
+    strip.mode = ARGB8888;
+    strip.color = 0;
+    strip.phyAddr = strip.virAddr = data_;
+    strip.stride = width * sizeof(Color32);
+    strip.width = width;
+    strip.height = height;
+    /* the opacity of the label is applied when the strip is drawn */
+    text.OnDraw(strip, strip.rect, strip.rect, strip.rect, 0, style, ellipsisIndex, OPA_OPAQUE);
+    color_ = style.textColor_;
+    opa_ = style.textOpa_;
+    valid_ = true;
+    return true;
+}
+
+void LabelStrip::Draw(BufferInfo& gfxDstBuffer, const Rect& mask, const Point& pos, OpacityType opa) const
+{
+    Rect area(pos.x, pos.y, pos.x + width_ - 1, pos.y + height_ - 1);
+    DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, area, mask, data_, opa,
+                                        DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+}
+
+void LabelStrip::Release()
+{
+    if (data_ != nullptr) {
+        usedSize_ -= static_cast<uint32_t>(width_) * height_ * sizeof(Color32);
+        delete[] data_;
+        data_ = nullptr;
+    }
+    width_ = 0;
+    height_ = 0;
+    valid_ = false;
+}
+
+constexpr uint32_t UILabel::MARQUEE_STRIP_MAX_SIZE;
+
 UILabel::UILabel()
     : labelText_(nullptr),
       needRefresh_(false),
       useTextColor_(false),
       hasAnimator_(false),
       lineBreakMode_(LINE_BREAK_ELLIPSIS),
+      useMarqueeStrip_(false),
       ellipsisIndex_(Text::TEXT_ELLIPSIS_END_INV),
       offsetX_(0),
       textColor_(Color::White()),
+      strip_(nullptr),
       animator_{nullptr}
 {
     Theme* theme = ThemeManager::GetInstance().GetCurrent();
@@ -132,6 +237,7 @@ UILabel::~UILabel()
         animator_.animator = nullptr;
         hasAnimator_ = false;
     }
+    ReleaseMarqueeStrip();
     if (labelText_ != nullptr) {
         delete labelText_;
         labelText_ = nullptr;
@@ -303,6 +409,9 @@ void UILabel::RefreshLabel()
 {
     Invalidate();
     ellipsisIndex_ = Text::TEXT_ELLIPSIS_END_INV;
+    if (strip_ != nullptr) {
+        strip_->Invalidate();
+    }
     if (!needRefresh_) {
         needRefresh_ = true;
     }
@@ -403,6 +512,67 @@ void UILabel::SetRollSpeed(uint16_t speed)
     }
 }
 
+void UILabel::SetMarqueeStripEnable(bool enable)
+{
+    if (useMarqueeStrip_ == enable) {
+        return;
+    }
+    useMarqueeStrip_ = enable;
+    if (!enable) {
+        ReleaseMarqueeStrip();
+    }
+    Invalidate();
+}
+
+uint32_t UILabel::GetMarqueeStripSize()
+{
+    return LabelStrip::GetUsedSize();
+}
+
+void UILabel::ReleaseMarqueeStrip()
+{
+    if (strip_ != nullptr) {
+        delete strip_;
+        strip_ = nullptr;
+    }
+}
+
+bool UILabel::DrawMarqueeStrip(BufferInfo& gfxDstBuffer,
+                               const Rect& invalidatedArea,
+                               const Style& style,
+                               OpacityType opa)
+{
+    Rect textRect = GetContentRect();
+    int16_t textWidth = labelText_->GetTextSize().x;
+    bool rolling = (lineBreakMode_ == LINE_BREAK_MARQUEE) && hasAnimator_ && (textWidth > textRect.GetWidth());
+    if (!useMarqueeStrip_ || !rolling || ((transMap_ != nullptr) && !transMap_->IsInvalid())) {
+        /* give the memory back to the labels that still roll */
+        ReleaseMarqueeStrip();
+        return false;
+    }
+    if (strip_ == nullptr) {
+        strip_ = new LabelStrip();
+        if (strip_ == nullptr) {
+            GRAPHIC_LOGE("new LabelStrip fail");
+            return false;
+        }
+    }
+    if (!strip_->IsValid(textWidth, textRect.GetHeight(), style) &&
+        !strip_->Render(*labelText_, style, ellipsisIndex_, textWidth, textRect.GetHeight())) {
+        return false;
+    }
+    Rect mask = invalidatedArea;
+    if (mask.Intersect(mask, textRect)) {
+        /* the same position as the text would be drawn at, a right to left text is aligned to the right */
+        int16_t x = textRect.GetLeft() + offsetX_;
+        if (labelText_->GetDirect() == TEXT_DIRECT_RTL) {
+            x += textRect.GetWidth() - textWidth;
+        }
+        strip_->Draw(gfxDstBuffer, mask, {x, textRect.GetTop()}, opa);
+    }
+    return true;
+}
+
 void UILabel::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
 {
     InitLabelText();
@@ -410,6 +580,9 @@ void UILabel::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
     Style style = GetStyleConst();
     style.textColor_ = GetTextColor();
     OpacityType opa = GetMixOpaScale();
+    if (DrawMarqueeStrip(gfxDstBuffer, invalidatedArea, style, opa)) {
+        return;
+    }
     labelText_->OnDraw(gfxDstBuffer, invalidatedArea, GetOrigRect(),
                        GetContentRect(), offsetX_, style, ellipsisIndex_, opa);
 }
@@ -88,35 +88,46 @@ void UIRadioButton::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea
     } else {
         CalculateSize();
         BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, GetRect(), invalidatedArea, *style_, opaScale_);
-        Rect contentRect = GetContentRect();
-        int16_t dx = width_ >> 1;
-        int16_t dy = height_ >> 1;
-        int16_t x = contentRect.GetX() + dx;
-        int16_t y = contentRect.GetY() + dy;
-        ArcInfo arcInfoBig = {{x, y}, {0}, radiusBig_, 0, CIRCLE_IN_DEGREE, nullptr};
-        ArcInfo arcInfoSmall = {{x, y}, {0}, currentRadius_, 0, CIRCLE_IN_DEGREE, nullptr};
         Rect trunc = invalidatedArea;
-        bool isIntersect = trunc.Intersect(trunc, contentRect);
+        bool isIntersect = trunc.Intersect(trunc, GetContentRect());
         if (isIntersect) {
-            Style style = StyleDefault::GetBackgroundTransparentStyle();
-            if (backgroundOpacity_ != OPA_OPAQUE) {
-                style.lineColor_ = Color::White();
-                style.lineWidth_ = lineWidth_;
-                // 0xa8 : opacity of drawing unselected button arc edge.
-                BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoBig, trunc, style, 0xa8, CapType::CAP_NONE);
-            }
-            style.lineWidth_ = arcInfoBig.radius;
-            style.lineColor_ = selectedStateColor_;
-            BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoBig, trunc, style, backgroundOpacity_,
-                                                  CapType::CAP_NONE);
-            style.lineWidth_ = arcInfoSmall.radius;
-            style.lineColor_ = Color::White();
-            BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoSmall, trunc, style, OPA_OPAQUE,
-                                                  CapType::CAP_NONE);
+            DrawSoftwareStateSprite(gfxDstBuffer, trunc);
         }
     }
 }
 
+void UIRadioButton::DrawSoftwareState(BufferInfo& gfxDstBuffer, const Rect& contentRect, const Rect& trunc)
+{
+    int16_t dx = width_ >> 1;
+    int16_t dy = height_ >> 1;
+    int16_t x = contentRect.GetX() + dx;
+    int16_t y = contentRect.GetY() + dy;
+    ArcInfo arcInfoBig = {{x, y}, {0}, radiusBig_, 0, CIRCLE_IN_DEGREE, nullptr};
+    ArcInfo arcInfoSmall = {{x, y}, {0}, currentRadius_, 0, CIRCLE_IN_DEGREE, nullptr};
+    Style style = StyleDefault::GetBackgroundTransparentStyle();
+    if (backgroundOpacity_ != OPA_OPAQUE) {
+        style.lineColor_ = Color::White();
+        style.lineWidth_ = lineWidth_;
+        // 0xa8 : opacity of drawing unselected button arc edge.
+        BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoBig, trunc, style, 0xa8, CapType::CAP_NONE);
+    }
+    style.lineWidth_ = arcInfoBig.radius;
+    style.lineColor_ = selectedStateColor_;
+    BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoBig, trunc, style, backgroundOpacity_,
+                                          CapType::CAP_NONE);
+    style.lineWidth_ = arcInfoSmall.radius;
+    style.lineColor_ = Color::White();
+    BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoSmall, trunc, style, OPA_OPAQUE, CapType::CAP_NONE);
+}
+
+void UIRadioButton::GetSoftwareStateKey(uint32_t& color, uint32_t& step) const
+{
+    /* the line width only follows the size of the view up from DEFAULT_HOT_WIDTH */
+    color = Color::ColorTo32(selectedStateColor_);
+    step = (static_cast<uint32_t>(static_cast<uint8_t>(lineWidth_)) << 24) | // 24: above the radius
+           (static_cast<uint32_t>(currentRadius_) << 8) | backgroundOpacity_; // 8: above the opacity
+}
+
 void UIRadioButton::SetName(const char* name)
 {
     if (name == nullptr) {
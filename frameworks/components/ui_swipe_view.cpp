@@ -16,11 +16,21 @@
 #include "components/ui_swipe_view.h"
 #include "dock/focus_manager.h"
 #include "dock/vibrator_manager.h"
+#include "draw/draw_utils.h"
 #include "gfx_utils/graphic_log.h"
+#include "securec.h"
 
 namespace OHOS {
 UISwipeView::UISwipeView(uint8_t direction)
-    : swipeListener_(nullptr), curIndex_(0), blankSize_(DEFAULT_BLANK_SIZE), curView_(nullptr), loop_(false)
+    : swipeListener_(nullptr),
+      curIndex_(0),
+      blankSize_(DEFAULT_BLANK_SIZE),
+      curView_(nullptr),
+      loop_(false),
+      snapshots_{},
+      snapshotMaxSize_(DEFAULT_SNAPSHOT_MAX_SIZE),
+      snapshotSize_(0),
+      useSnapshot_(false)
 {
 #if ENABLE_ROTATE_INPUT
     rotateFactor_ = DEFAULT_SWIPE_VIEW_ROTATE_FACTOR;
@@ -30,7 +40,10 @@ UISwipeView::UISwipeView(uint8_t direction)
     swipeAccCoefficient_ = DRAG_ACC_FACTOR;
 }
 
-UISwipeView::~UISwipeView() {}
+UISwipeView::~UISwipeView()
+{
+    ReleaseSnapshots();
+}
 
 void UISwipeView::Add(UIView* view)
 {
@@ -59,6 +72,7 @@ void UISwipeView::Remove(UIView* view)
     if (view == nullptr) {
         return;
     }
+    StopSnapshot();
     UIViewGroup::Remove(view);
     if (curView_ == view) {
         curView_ = nullptr;
@@ -160,6 +174,7 @@ bool UISwipeView::OnDragEvent(const DragEvent& event)
     if (scrollAnimator_.GetState() != Animator::STOP) {
         UIAbstractScroll::StopAnimator();
     }
+    StartSnapshot();
 
     if (direction_ == HORIZONTAL) {
         DragXInner(event.GetDeltaX());
@@ -185,6 +200,7 @@ bool UISwipeView::OnDragEndEvent(const DragEvent& event)
     }
 
     if (curView_ == nullptr) {
+        StopSnapshot();
         return UIView::OnDragEndEvent(event);
     }
 
@@ -200,6 +216,7 @@ bool UISwipeView::OnRotateEvent(const RotateEvent& event)
 {
     int16_t rotateLen = static_cast<int16_t>(event.GetRotate() * rotateFactor_);
     RefreshRotate(rotateLen);
+    StartSnapshot();
     if (direction_ == HORIZONTAL) {
         DragXInner(rotateLen);
         RefreshCurrentViewByPosition(&UIView::GetX, &UIView::GetWidthWithMargin);
@@ -226,6 +243,7 @@ bool UISwipeView::OnRotateEndEvent(const RotateEvent& event)
         RefreshCurrentViewByThrow(lastRotateLen, dir, &UIView::GetY, &UIView::GetHeightWithMargin);
     }
     if (curView_ == nullptr) {
+        StopSnapshot();
         return UIView::OnRotateEndEvent(event);
     }
     SwitchToPage(curIndex_);
@@ -267,6 +285,7 @@ void UISwipeView::SwitchToPage(int16_t dst, bool needAnimator)
 
     UIView* dstView = GetViewByIndex(dst);
     if (dstView == nullptr) {
+        StopSnapshot();
         return;
     }
     curIndex_ = dst;
@@ -295,15 +314,19 @@ void UISwipeView::SwitchToPage(int16_t dst, bool needAnimator)
             animatorCallback_.SetDragStartValue(0, 0);
             animatorCallback_.SetDragEndValue(xOffset, yOffset);
             scrollAnimator_.Start();
-        } else {
-            MoveChildByOffset(xOffset, yOffset);
+            StartSnapshot();
+            return;
         }
+        MoveChildByOffset(xOffset, yOffset);
     }
+    /* the pages have settled */
+    StopSnapshot();
 }
 
 void UISwipeView::StopAnimator()
 {
     UIAbstractScroll::StopAnimator();
+    StopSnapshot();
     if (swipeListener_ != nullptr) {
         swipeListener_->OnSwipe(*this);
     }
@@ -573,6 +596,171 @@ void UISwipeView::CurrentIndexDec()
     }
 }
 
+void UISwipeView::SetSnapshotEnable(bool enable)
+{
+    useSnapshot_ = enable;
+    if (!enable) {
+        StopSnapshot();
+    }
+}
+
+void UISwipeView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
+{
+    UIAbstractScroll::OnDraw(gfxDstBuffer, invalidatedArea);
+    if (!childrenDrawnByGroup_) {
+        return;
+    }
+    /* the same mask as the root view gives the pages when it draws them */
+    Rect mask = GetContentRect();
+    if (!mask.Intersect(mask, invalidatedArea)) {
+        return;
+    }
+    UIView* view = childrenHead_;
+    while (view != nullptr) {
+        const PageSnapshot* snapshot = GetSnapshot(view);
+        if (snapshot == nullptr) {
+            DrawViewTree(gfxDstBuffer, view, mask);
+        } else if (view->IsVisible()) {
+            Rect rect = view->GetRect();
+            Rect area(rect.GetLeft(), rect.GetTop(), rect.GetLeft() + snapshot->width - 1,
+                      rect.GetTop() + snapshot->height - 1);
+            DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, area, mask, snapshot->data, OPA_OPAQUE,
+                                                DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+        }
+        view = view->GetNextSibling();
+    }
+}
+
+void UISwipeView::StartSnapshot()
+{
+    if (!useSnapshot_ || childrenDrawnByGroup_ || !IsTransInvalid()) {
+        return;
+    }
+    UIView* curView = GetViewByIndex(curIndex_);
+    if (curView == nullptr) {
+        return;
+    }
+    UIView* prevView = nullptr;
+    for (UIView* view = childrenHead_; view != nullptr; view = view->GetNextSibling()) {
+        /* a transformed view is drawn through the map buffer of the root view, which a snapshot does not have */
+        if (IsViewTreeTransformed(view)) {
+            return;
+        }
+        if (view->GetNextSibling() == curView) {
+            prevView = view;
+        }
+    }
+
+    UIView* pages[SNAPSHOT_PAGE_NUM] = {curView, prevView, curView->GetNextSibling()};
+    uint8_t num = 0;
+    for (uint8_t i = 0; i < SNAPSHOT_PAGE_NUM; i++) {
+        if ((pages[i] != nullptr) && pages[i]->IsVisible() && TakeSnapshot(snapshots_[num], pages[i])) {
+            num++;
+        }
+    }
+    /* without any snapshot the pages are simply drawn by the root view */
+    childrenDrawnByGroup_ = (num > 0);
+}
+
+void UISwipeView::StopSnapshot()
+{
+    ReleaseSnapshots();
+    if (childrenDrawnByGroup_) {
+        childrenDrawnByGroup_ = false;
+        /* the contents may have changed during the swipe */
+        Invalidate();
+    }
+}
+
+void UISwipeView::ReleaseSnapshots()
+{
+    for (uint8_t i = 0; i < SNAPSHOT_PAGE_NUM; i++) {
+        if (snapshots_[i].data != nullptr) {
+            delete[] snapshots_[i].data;
+        }
+        snapshots_[i] = {};
+    }
+    snapshotSize_ = 0;
+}
+
+bool UISwipeView::IsOpaqueOver(const UIView& view, const Rect& area) const
+{
+    Rect rect(area);
+    return (view.GetStyle(STYLE_BACKGROUND_OPA) == OPA_OPAQUE) && (view.GetOpaScale() == OPA_OPAQUE) &&
+           view.OnPreDraw(rect) && (GetMixOpaScale() == OPA_OPAQUE);
+}
+
+bool UISwipeView::TakeSnapshot(PageSnapshot& snapshot, UIView* view)
+{
+    int16_t width = view->GetWidth();
+    int16_t height = view->GetHeight();
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    /*
+     * The snapshot is copied over whatever lies behind the page, so it must hold that too. A page that does not
+     * cover itself is drawn over the background of this view, and drawn live when that background is not opaque.
+     */
+    bool pageOpaque = IsOpaqueOver(*view, view->GetRect());
+    if (!pageOpaque && !IsOpaqueOver(*this, GetContentRect())) {
+        return false;
+    }
+    uint32_t size = static_cast<uint32_t>(width) * height * sizeof(Color32);
+    if (snapshotSize_ + size > snapshotMaxSize_) {
+        return false;
+    }
+    uint8_t* data = new uint8_t[size];
+    if (data == nullptr) {
+        GRAPHIC_LOGE("UISwipeView::TakeSnapshot new data fail");
+        return false;
+    }
+    if (pageOpaque) {
+        (void)memset_s(data, size, 0, size);
+    } else {
+        Color32 background;
+        background.full = Color::ColorTo32(GetStyleConst().bgColor_);
+        background.alpha = OPA_OPAQUE;
+        Color32* pixels = reinterpret_cast<Color32*>(data);
+        for (int32_t i = 0; i < width * height; i++) {
+            pixels[i] = background;
+        }
+    }
+
+    BufferInfo buffer;
+    buffer.rect = Rect(0, 0, width - 1, height - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = data;
+    buffer.stride = width * sizeof(Color32);
+    buffer.width = width;
+    buffer.height = height;
+    /* the page is moved to the origin of the buffer while it is drawn, the same as the root view does for the map
+     * buffer of a transformed view */
+    int16_t x = view->GetX();
+    int16_t y = view->GetY();
+    Rect rect = view->GetRect();
+    view->SetPosition(x - rect.GetLeft(), y - rect.GetTop());
+    DrawViewTree(buffer, view, buffer.rect);
+    view->SetPosition(x, y);
+
+    snapshot.view = view;
+    snapshot.data = data;
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshotSize_ += size;
+    return true;
+}
+
+const UISwipeView::PageSnapshot* UISwipeView::GetSnapshot(const UIView* view) const
+{
+    for (uint8_t i = 0; i < SNAPSHOT_PAGE_NUM; i++) {
+        if ((snapshots_[i].data != nullptr) && (snapshots_[i].view == view)) {
+            return &snapshots_[i];
+        }
+    }
+    return nullptr;
+}
+
 #if ENABLE_VIBRATOR
 void UISwipeView::Vibrator()
 {
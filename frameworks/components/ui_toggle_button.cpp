@@ -92,24 +92,44 @@ void UIToggleButton::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedAre
     } else {
         CalculateSize();
         BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, GetRect(), invalidatedArea, *style_, opaScale_);
-        Rect contentRect = GetContentRect();
         Rect trunc = invalidatedArea;
-        bool isIntersect = trunc.Intersect(trunc, contentRect);
+        bool isIntersect = trunc.Intersect(trunc, GetContentRect());
         if (!isIntersect) {
             return;
         }
-        Style styleUnSelect = StyleDefault::GetBackgroundTransparentStyle();
-        styleUnSelect.bgColor_ = bgColor_;
-        styleUnSelect.bgOpa_ = backgroundOpacity_;
-        styleUnSelect.borderRadius_ = corner_;
-        BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, rectMid_, trunc, styleUnSelect, opaScale_);
-        ArcInfo arcInfoLeft = {currentCenter_, {0}, radius_, 0, CIRCLE_IN_DEGREE, nullptr};
-        styleUnSelect.lineColor_ = Color::White();
-        styleUnSelect.lineWidth_ = radius_;
-        BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoLeft, trunc, styleUnSelect, OPA_OPAQUE,
-                                              CapType::CAP_NONE);
+        DrawSoftwareStateSprite(gfxDstBuffer, trunc);
     }
 }
+
+void UIToggleButton::DrawSoftwareState(BufferInfo& gfxDstBuffer, const Rect& contentRect, const Rect& trunc)
+{
+    /* rectMid_ and currentCenter_ are calculated at the content rect of this view */
+    Rect viewContentRect = GetContentRect();
+    int16_t dx = contentRect.GetX() - viewContentRect.GetX();
+    int16_t dy = contentRect.GetY() - viewContentRect.GetY();
+    Rect rectMid(rectMid_.GetLeft() + dx, rectMid_.GetTop() + dy, rectMid_.GetRight() + dx, rectMid_.GetBottom() + dy);
+    Point center = {static_cast<int16_t>(currentCenter_.x + dx), static_cast<int16_t>(currentCenter_.y + dy)};
+
+    Style styleUnSelect = StyleDefault::GetBackgroundTransparentStyle();
+    styleUnSelect.bgColor_ = bgColor_;
+    styleUnSelect.bgOpa_ = backgroundOpacity_;
+    styleUnSelect.borderRadius_ = corner_;
+    BaseGfxEngine::GetInstance()->DrawRect(gfxDstBuffer, rectMid, trunc, styleUnSelect, opaScale_);
+    ArcInfo arcInfoLeft = {center, {0}, radius_, 0, CIRCLE_IN_DEGREE, nullptr};
+    styleUnSelect.lineColor_ = Color::White();
+    styleUnSelect.lineWidth_ = radius_;
+    BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcInfoLeft, trunc, styleUnSelect, OPA_OPAQUE,
+                                          CapType::CAP_NONE);
+}
+
+void UIToggleButton::GetSoftwareStateKey(uint32_t& color, uint32_t& step) const
+{
+    /* the knob position relative to the left end, the background color already follows the animation */
+    color = Color::ColorTo32(bgColor_);
+    uint16_t offset = static_cast<uint16_t>(currentCenter_.x - leftCenter_.x);
+    step = (static_cast<uint32_t>(offset) << 8) | backgroundOpacity_; // 8: above the opacity
+}
+
 #if DEFAULT_ANIMATION
 void UIToggleButton::Callback(UIView* view)
 {
@@ -15,6 +15,7 @@
 
 #include "components/ui_view.h"
 
+#include "common/style_pool.h"
 #include "components/root_view.h"
 #include "core/render_manager.h"
 #include "dfx/ui_view_bounds.h"
@@ -36,6 +37,7 @@ UIView::UIView()
       needRedraw_(false),
       styleAllocFlag_(false),
       isIntercept_(false),
+      needMeasure_(true),
 #if ENABLE_FOCUS_MANAGER
       focusable_(false),
 #endif
@@ -63,8 +65,11 @@ UIView::UIView()
     SetupThemeStyles();
 }
 
+uint32_t UIView::destroyGeneration_ = 0;
+
 UIView::~UIView()
 {
+    destroyGeneration_++;
     if (transMap_ != nullptr) {
         delete transMap_;
         transMap_ = nullptr;
@@ -74,7 +79,7 @@ UIView::~UIView()
         visibleRect_ = nullptr;
     }
     if (styleAllocFlag_) {
-        delete style_;
+        StylePool::GetInstance().Release(style_);
         style_ = nullptr;
         styleAllocFlag_ = false;
     }
@@ -185,7 +190,7 @@ void UIView::SetupThemeStyles()
 void UIView::SetStyle(Style& style)
 {
     if (styleAllocFlag_) {
-        delete style_;
+        StylePool::GetInstance().Release(style_);
         styleAllocFlag_ = false;
     }
     style_ = &style;
@@ -193,21 +198,26 @@ void UIView::SetStyle(Style& style)
 
 void UIView::SetStyle(uint8_t key, int64_t value)
 {
-    if (!styleAllocFlag_) {
-        style_ = new Style(*style_);
-        if (style_ == nullptr) {
-            GRAPHIC_LOGE("new Style fail");
-            return;
-        }
-        styleAllocFlag_ = true;
+    /* the changed style is shared with every view that has the same values, so the entry is swapped, not changed */
+    Style changedStyle(*style_);
+    changedStyle.SetStyle(key, value);
+    Style* style = StylePool::GetInstance().Acquire(changedStyle);
+    if (style == nullptr) {
+        GRAPHIC_LOGE("acquire Style fail");
+        return;
     }
     int16_t width = GetWidth();
     int16_t height = GetHeight();
     int16_t x = GetX();
     int16_t y = GetY();
-    style_->SetStyle(key, value);
+    if (styleAllocFlag_) {
+        StylePool::GetInstance().Release(style_);
+    }
+    style_ = style;
+    styleAllocFlag_ = true;
     Rect rect(x, y, x + width - 1, y + height -  1);
     UpdateRectInfo(key, rect);
+    RequestMeasure();
 }
 
 void UIView::UpdateRectInfo(uint8_t key, const Rect& rect)
@@ -402,8 +412,20 @@ void UIView::Invalidate()
     InvalidateRect(GetRect());
 }
 
+void UIView::RequestMeasure()
+{
+    needMeasure_ = true;
+    UIView* par = parent_;
+    while ((par != nullptr) && !par->needMeasure_) {
+        par->needMeasure_ = true;
+        par = par->parent_;
+    }
+}
+
 void UIView::InvalidateRect(const Rect& invalidatedArea)
 {
+    // views are only remeasured on demand, so anything that asks for a redraw also asks for a measure
+    RequestMeasure();
     if (!visible_) {
         if (needRedraw_) {
             needRedraw_ = false;
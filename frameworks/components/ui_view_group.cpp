@@ -27,7 +27,8 @@ UIViewGroup::UIViewGroup()
       childrenNum_(0),
       isDragging_(false),
       disallowIntercept_(false),
-      isAutoSize_(false)
+      isAutoSize_(false),
+      childrenDrawnByGroup_(false)
 {
     isViewGroup_ = true;
 #if ENABLE_FOCUS_MANAGER
@@ -37,6 +38,8 @@ UIViewGroup::UIViewGroup()
 
 UIViewGroup::~UIViewGroup() {}
 
+uint32_t UIViewGroup::attachGeneration_ = 0;
+
 void UIViewGroup::Add(UIView* view)
 {
     if ((view == this) || (view == nullptr)) {
@@ -60,6 +63,8 @@ void UIViewGroup::Add(UIView* view)
     view->SetNextSibling(nullptr);
     childrenTail_ = view;
     childrenNum_++;
+    attachGeneration_++;
+    view->RequestMeasure();
     if (isAutoSize_) {
         AutoResize();
     }
@@ -97,6 +102,8 @@ void UIViewGroup::Insert(UIView* prevView, UIView* insertView)
         childrenTail_ = insertView;
     }
     childrenNum_++;
+    attachGeneration_++;
+    insertView->RequestMeasure();
     if (isAutoSize_) {
         AutoResize();
     }
@@ -121,6 +128,8 @@ void UIViewGroup::Remove(UIView* view)
             childrenTail_ = nullptr;
         }
         childrenNum_--;
+        attachGeneration_++;
+        RequestMeasure();
         OnChildChanged();
         return;
     }
@@ -134,6 +143,8 @@ void UIViewGroup::Remove(UIView* view)
                 childrenTail_ = node;
             }
             childrenNum_--;
+            attachGeneration_++;
+            RequestMeasure();
             OnChildChanged();
             return;
         }
@@ -147,6 +158,7 @@ void UIViewGroup::RemoveAll()
     childrenHead_ = nullptr;
     childrenTail_ = nullptr;
     childrenNum_ = 0;
+    attachGeneration_++;
     UIView* tmp = nullptr;
     while (node != nullptr) {
         tmp = node;
@@ -154,6 +166,7 @@ void UIViewGroup::RemoveAll()
         tmp->SetParent(nullptr);
         tmp->SetNextSibling(nullptr);
     }
+    RequestMeasure();
     OnChildChanged();
 }
 
@@ -235,6 +248,47 @@ void UIViewGroup::GetTargetView(const Point& point, UIView** current, UIView** t
     }
 }
 
+void UIViewGroup::DrawViewTree(BufferInfo& gfxDstBuffer, UIView* view, const Rect& mask, uint8_t depth)
+{
+    Rect rect;
+    if (!view->IsVisible() || !rect.Intersect(view->GetMaskedRect(), mask)) {
+        return;
+    }
+    view->OnDraw(gfxDstBuffer, rect);
+    if (view->IsViewGroup() && (depth < COMPONENT_NESTING_DEPTH) &&
+        !static_cast<UIViewGroup*>(view)->IsChildrenDrawnByGroup()) {
+        Rect childMask = view->GetContentRect();
+        if (childMask.Intersect(childMask, rect)) {
+            UIView* child = static_cast<UIViewGroup*>(view)->GetChildrenHead();
+            while (child != nullptr) {
+                DrawViewTree(gfxDstBuffer, child, childMask, depth + 1);
+                child = child->GetNextSibling();
+            }
+        }
+    }
+    view->OnPostDraw(gfxDstBuffer, rect);
+}
+
+bool UIViewGroup::IsViewTreeTransformed(UIView* view, uint8_t depth)
+{
+    /* image views and texture mappers draw their transform themselves */
+    if (!view->IsTransInvalid() && (view->GetViewType() != UI_IMAGE_VIEW) &&
+        (view->GetViewType() != UI_TEXTURE_MAPPER)) {
+        return true;
+    }
+    if (!view->IsViewGroup() || (depth >= COMPONENT_NESTING_DEPTH)) {
+        return false;
+    }
+    UIView* child = static_cast<UIViewGroup*>(view)->GetChildrenHead();
+    while (child != nullptr) {
+        if (IsViewTreeTransformed(child, depth + 1)) {
+            return true;
+        }
+        child = child->GetNextSibling();
+    }
+    return false;
+}
+
 Rect UIViewGroup::GetAllChildRelativeRect() const
 {
     Rect rect = {0, 0, 0, 0};
@@ -15,7 +15,10 @@
 
 #include "core/render_manager.h"
 
+#include "common/input_device_manager.h"
 #include "components/root_view.h"
+#include "dfx/ui_frame_timeline.h"
+#include "dfx/ui_render_profiler.h"
 #include "gfx_utils/graphic_log.h"
 #include "hal_tick.h"
 #include "securec.h"
@@ -41,6 +44,11 @@ void RenderManager::Init()
 
 void RenderManager::Callback()
 {
+    DEBUG_FRAME_TIMELINE_BEGIN_FRAME();
+    DEBUG_RENDER_PROFILER_BEGIN_FRAME();
+    /* coalesced moves are dispatched now, so the frame shows the latest position */
+    InputDeviceManager::GetInstance()->FlushEvents();
+    DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_RENDER);
 #if ENABLE_WINDOW
     ListNode<Window*>* winNode = winList_.Begin();
     while (winNode != winList_.End()) {
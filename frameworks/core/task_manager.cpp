@@ -14,6 +14,7 @@
  */
 
 #include "common/task_manager.h"
+#include "dfx/ui_frame_timeline.h"
 
 #include "gfx_utils/graphic_log.h"
 #include "hal_tick.h"
@@ -68,6 +69,7 @@ void TaskManager::TaskHandler()
         return;
     }
     isHandlerRunning_ = true;
+    DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_TASK_HANDLER);
 
     ListNode<Task*>* node = list_.Begin();
 
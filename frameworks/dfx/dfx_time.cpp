@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dfx_time.h"
+
+#if ENABLE_DEBUG
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <ctime>
+#else
+#include "hal_tick.h"
+#endif
+
+namespace OHOS {
+uint64_t DfxTime::GetTimeUs()
+{
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    constexpr uint32_t US_PER_SECOND = 1000000;
+    constexpr uint32_t NS_PER_US = 1000;
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<uint64_t>(time.tv_sec) * US_PER_SECOND + static_cast<uint64_t>(time.tv_nsec) / NS_PER_US;
+#else
+    constexpr uint32_t US_PER_MS = 1000;
+    return static_cast<uint64_t>(HALTick::GetInstance().GetTime()) * US_PER_MS;
+#endif
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
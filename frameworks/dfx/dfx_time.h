@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_DFX_TIME_H
+#define GRAPHIC_LITE_DFX_TIME_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG
+#include <cstdint>
+
+namespace OHOS {
+/** The monotonic clock the dfx recorders stamp their events with. */
+class DfxTime {
+public:
+    /**
+     * @brief Gets the current time in microseconds. It has a microsecond resolution where clock_gettime is available
+     *        and the millisecond resolution of HALTick elsewhere.
+     */
+    static uint64_t GetTimeUs();
+};
+} // namespace OHOS
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_DFX_TIME_H
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dump_dom_writer.h"
+
+#if ENABLE_DEBUG
+#include <climits>
+#include <cstring>
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t NUMBER_LENGTH = 32;
+constexpr uint8_t ESCAPE_LENGTH = 7; // \u0000 and the terminator
+} // namespace
+
+constexpr uint16_t DumpStreamWriter::BUFFER_SIZE;
+constexpr uint8_t DumpStreamWriter::MAX_DEPTH;
+constexpr uint8_t DumpBinaryWriter::VERSION;
+constexpr uint8_t DumpBinaryWriter::KEY_INLINE;
+
+const char* const DumpBinaryWriter::KEYS[] = {
+    "name",          "x",           "y",           "width",          "height",        "id",
+    "visible",       "touchable",   "draggable",   "onClickListener", "onDragListener", "onLongPressListener",
+    "child",         "src",         "text",        "state",          "currValue",     "rangeMin",
+    "rangeMax",      "xScrollable", "yScrollable", "isLoopList",     "selectedIndex", "currentHour",
+    "currentMinute", "currentSecond", "currentIndex", "direction",    "selectedHour",  "selectedMinute",
+    "selectedSecond",
+};
+const uint8_t DumpBinaryWriter::KEY_NUM = sizeof(KEYS) / sizeof(KEYS[0]);
+
+void DumpStreamWriter::Write(const char* data, uint32_t size)
+{
+    while (!error_ && (size > 0)) {
+        if (length_ == BUFFER_SIZE) {
+            if (write(fd_, buffer_, length_) != static_cast<ssize_t>(length_)) {
+                GRAPHIC_LOGE("DumpStreamWriter::Write write file failed Err!\n");
+                error_ = true;
+                return;
+            }
+            length_ = 0;
+        }
+        uint32_t copySize = BUFFER_SIZE - length_;
+        if (copySize > size) {
+            copySize = size;
+        }
+        if (memcpy_s(buffer_ + length_, BUFFER_SIZE - length_, data, copySize) != EOK) {
+            error_ = true;
+            return;
+        }
+        length_ += copySize;
+        data += copySize;
+        size -= copySize;
+    }
+}
+
+void DumpStreamWriter::Write(const char* str)
+{
+    Write(str, static_cast<uint32_t>(strlen(str)));
+}
+
+void DumpStreamWriter::WriteByte(uint8_t value)
+{
+    Write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool DumpStreamWriter::Finish()
+{
+    if (!error_ && (length_ > 0)) {
+        if (write(fd_, buffer_, length_) != static_cast<ssize_t>(length_)) {
+            GRAPHIC_LOGE("DumpStreamWriter::Finish write file failed Err!\n");
+            error_ = true;
+        }
+        length_ = 0;
+    }
+    return !error_ && (depth_ == 0);
+}
+
+bool DumpStreamWriter::Push(bool isArray)
+{
+    if (depth_ == MAX_DEPTH) {
+        GRAPHIC_LOGE("DumpStreamWriter::Push tree too deep Err!\n");
+        error_ = true;
+        return false;
+    }
+    isArray_[depth_] = isArray;
+    hasItem_[depth_] = false;
+    depth_++;
+    return true;
+}
+
+void DumpStreamWriter::Pop()
+{
+    if (depth_ > 0) {
+        depth_--;
+    }
+}
+
+bool DumpStreamWriter::TakeFirst()
+{
+    if (depth_ == 0) {
+        return true;
+    }
+    bool first = !hasItem_[depth_ - 1];
+    hasItem_[depth_ - 1] = true;
+    return first;
+}
+
+void DumpJsonWriter::WriteIndent(uint8_t depth)
+{
+    for (uint8_t i = 0; i < depth; i++) {
+        Write("\t", 1);
+    }
+}
+
+void DumpJsonWriter::WriteString(const char* str)
+{
+    /* escaped as cJSON prints strings */
+    Write("\"", 1);
+    const char* run = str;
+    for (const char* pos = str; *pos != '\0'; pos++) {
+        uint8_t ch = static_cast<uint8_t>(*pos);
+        const char* escape = nullptr;
+        char code[ESCAPE_LENGTH];
+        switch (ch) {
+            case '\"':
+                escape = "\\\"";
+                break;
+            case '\\':
+                escape = "\\\\";
+                break;
+            case '\b':
+                escape = "\\b";
+                break;
+            case '\f':
+                escape = "\\f";
+                break;
+            case '\n':
+                escape = "\\n";
+                break;
+            case '\r':
+                escape = "\\r";
+                break;
+            case '\t':
+                escape = "\\t";
+                break;
+            default:
+                if ((ch < ' ') && (sprintf_s(code, sizeof(code), "\\u%04x", ch) > 0)) {
+                    escape = code;
+                }
+                break;
+        }
+        if (escape != nullptr) {
+            Write(run, static_cast<uint32_t>(pos - run));
+            Write(escape);
+            run = pos + 1;
+        }
+    }
+    Write(run);
+    Write("\"", 1);
+}
+
+void DumpJsonWriter::BeginItem(const char* key)
+{
+    bool first = TakeFirst();
+    if (depth_ == 0) {
+        return;
+    }
+    if (IsInArray()) {
+        if (!first) {
+            Write(", ");
+        }
+        return;
+    }
+    Write(first ? "\n" : ",\n");
+    WriteIndent(depth_);
+    WriteString((key == nullptr) ? "" : key);
+    Write(":\t");
+}
+
+void DumpJsonWriter::BeginObject(const char* key)
+{
+    BeginItem(key);
+    Write("{", 1);
+    Push(false);
+}
+
+void DumpJsonWriter::EndObject()
+{
+    if (depth_ == 0) {
+        return;
+    }
+    Write("\n", 1);
+    WriteIndent(depth_ - 1);
+    Write("}", 1);
+    Pop();
+}
+
+void DumpJsonWriter::BeginArray(const char* key)
+{
+    BeginItem(key);
+    Write("[", 1);
+    Push(true);
+}
+
+void DumpJsonWriter::EndArray()
+{
+    Write("]", 1);
+    Pop();
+}
+
+void DumpJsonWriter::AddString(const char* key, const char* value)
+{
+    if (value == nullptr) {
+        return;
+    }
+    BeginItem(key);
+    WriteString(value);
+}
+
+void DumpJsonWriter::AddNumber(const char* key, double value)
+{
+    /* cJSON prints numbers of the int range as %d, and others as %1.15g */
+    char number[NUMBER_LENGTH];
+    int32_t ret;
+    if ((value >= INT_MIN) && (value <= INT_MAX) && (value == static_cast<int32_t>(value))) {
+        ret = sprintf_s(number, sizeof(number), "%d", static_cast<int32_t>(value));
+    } else {
+        ret = sprintf_s(number, sizeof(number), "%1.15g", value);
+    }
+    if (ret < 0) {
+        return;
+    }
+    BeginItem(key);
+    Write(number);
+}
+
+void DumpJsonWriter::AddBool(const char* key, bool value)
+{
+    BeginItem(key);
+    Write(value ? "true" : "false");
+}
+
+DumpBinaryWriter::DumpBinaryWriter(int32_t fd) : DumpStreamWriter(fd)
+{
+    Write("UIDT", 4); // 4: magic length
+    WriteByte(VERSION);
+}
+
+void DumpBinaryWriter::WriteKey(const char* key)
+{
+    if (key == nullptr) {
+        WriteByte(0);
+        return;
+    }
+    for (uint8_t i = 0; i < KEY_NUM; i++) {
+        if (strcmp(KEYS[i], key) == 0) {
+            WriteByte(i + 1);
+            return;
+        }
+    }
+    size_t length = strlen(key);
+    if (length > UINT8_MAX) {
+        length = UINT8_MAX;
+    }
+    WriteByte(KEY_INLINE);
+    WriteByte(static_cast<uint8_t>(length));
+    Write(key, static_cast<uint32_t>(length));
+}
+
+void DumpBinaryWriter::BeginObject(const char* key)
+{
+    WriteByte('O');
+    WriteKey(key);
+    Push(false);
+}
+
+void DumpBinaryWriter::EndObject()
+{
+    WriteByte('o');
+    Pop();
+}
+
+void DumpBinaryWriter::BeginArray(const char* key)
+{
+    WriteByte('A');
+    WriteKey(key);
+    Push(true);
+}
+
+void DumpBinaryWriter::EndArray()
+{
+    WriteByte('a');
+    Pop();
+}
+
+void DumpBinaryWriter::AddString(const char* key, const char* value)
+{
+    if (value == nullptr) {
+        return;
+    }
+    size_t length = strlen(value);
+    if (length > UINT16_MAX) {
+        length = UINT16_MAX;
+    }
+    uint16_t size = static_cast<uint16_t>(length);
+    WriteByte('S');
+    WriteKey(key);
+    Write(reinterpret_cast<const char*>(&size), sizeof(size));
+    Write(value, size);
+}
+
+void DumpBinaryWriter::AddNumber(const char* key, double value)
+{
+    if ((value >= INT_MIN) && (value <= INT_MAX) && (value == static_cast<int32_t>(value))) {
+        int32_t number = static_cast<int32_t>(value);
+        WriteByte('N');
+        WriteKey(key);
+        Write(reinterpret_cast<const char*>(&number), sizeof(number));
+    } else {
+        WriteByte('D');
+        WriteKey(key);
+        Write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+void DumpBinaryWriter::AddBool(const char* key, bool value)
+{
+    WriteByte(value ? 'T' : 'F');
+    WriteKey(key);
+}
+
+void DumpCJsonWriter::BeginObject(const char* key)
+{
+    if (object_ == nullptr) {
+        object_ = cJSON_CreateObject();
+        if (object_ == nullptr) {
+            GRAPHIC_LOGE("DumpCJsonWriter::BeginObject cJSON create object failed Err!\n");
+        }
+    }
+}
+
+void DumpCJsonWriter::AddString(const char* key, const char* value)
+{
+    if (object_ != nullptr) {
+        cJSON_AddStringToObject(object_, key, value);
+    }
+}
+
+void DumpCJsonWriter::AddNumber(const char* key, double value)
+{
+    if (object_ != nullptr) {
+        cJSON_AddNumberToObject(object_, key, value);
+    }
+}
+
+void DumpCJsonWriter::AddBool(const char* key, bool value)
+{
+    if (object_ != nullptr) {
+        cJSON_AddBoolToObject(object_, key, value);
+    }
+}
+
+char* DumpCJsonWriter::Print() const
+{
+    return (object_ == nullptr) ? nullptr : cJSON_Print(object_);
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_DUMP_DOM_WRITER_H
+#define GRAPHIC_LITE_DUMP_DOM_WRITER_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG
+#include "cJSON.h"
+#include "gfx_utils/heap_base.h"
+#include <cstdint>
+
+namespace OHOS {
+/**
+ * Receives the fields of the views UIDumpDomTree dumps, in the order they are output. A nullptr key is given for the
+ * root object and the objects of an array, and a nullptr string value is skipped, as cJSON skips it.
+ */
+class DumpDomWriter : public HeapBase {
+public:
+    DumpDomWriter() {}
+    virtual ~DumpDomWriter() {}
+
+    virtual void BeginObject(const char* key) = 0;
+    virtual void EndObject() = 0;
+    virtual void BeginArray(const char* key) = 0;
+    virtual void EndArray() = 0;
+    virtual void AddString(const char* key, const char* value) = 0;
+    virtual void AddNumber(const char* key, double value) = 0;
+    virtual void AddBool(const char* key, bool value) = 0;
+};
+
+/**
+ * Writes to a file descriptor through a buffer of BUFFER_SIZE bytes, so that the dump never holds more than that
+ * however large the tree is.
+ */
+class DumpStreamWriter : public DumpDomWriter {
+public:
+    static constexpr uint16_t BUFFER_SIZE = 512;
+    static constexpr uint8_t MAX_DEPTH = 128;
+
+    explicit DumpStreamWriter(int32_t fd) : depth_(0), fd_(fd), length_(0), error_(false) {}
+    virtual ~DumpStreamWriter() {}
+
+    /* Writes what is left in the buffer, returns false if any write failed or the objects do not match. */
+    bool Finish();
+
+protected:
+    void Write(const char* data, uint32_t size);
+    void Write(const char* str);
+    void WriteByte(uint8_t value);
+
+    /* Returns false, and fails the dump, if the tree is deeper than MAX_DEPTH. */
+    bool Push(bool isArray);
+    void Pop();
+
+    /* Marks the current object or array as not empty, returns whether it was. */
+    bool TakeFirst();
+
+    bool IsInArray() const
+    {
+        return (depth_ > 0) && isArray_[depth_ - 1];
+    }
+
+    uint8_t depth_;
+
+private:
+    int32_t fd_;
+    uint16_t length_;
+    bool error_;
+    bool isArray_[MAX_DEPTH];
+    bool hasItem_[MAX_DEPTH];
+    char buffer_[BUFFER_SIZE];
+};
+
+/* Writes the same text cJSON_Print prints for the tree. */
+class DumpJsonWriter : public DumpStreamWriter {
+public:
+    explicit DumpJsonWriter(int32_t fd) : DumpStreamWriter(fd) {}
+    ~DumpJsonWriter() {}
+
+    void BeginObject(const char* key) override;
+    void EndObject() override;
+    void BeginArray(const char* key) override;
+    void EndArray() override;
+    void AddString(const char* key, const char* value) override;
+    void AddNumber(const char* key, double value) override;
+    void AddBool(const char* key, bool value) override;
+
+private:
+    void BeginItem(const char* key);
+    void WriteIndent(uint8_t depth);
+    void WriteString(const char* str);
+};
+
+/**
+ * Writes a compact binary form: the magic "UIDT" and a version byte, followed by records in the byte order of the
+ * device. Each record is a tag, a key and a value:
+ *   'O' key, 'o'                      object begin and end
+ *   'A' key, 'a'                      array begin and end
+ *   'S' key, uint16 length, bytes     string
+ *   'N' key, int32                    integral number
+ *   'D' key, double                   other number
+ *   'T' key, 'F' key                  true and false
+ * A key is the index of a known key plus 1 in one byte, 0 for no key, or KEY_INLINE followed by uint8 length and
+ * bytes for any other key.
+ */
+class DumpBinaryWriter : public DumpStreamWriter {
+public:
+    static constexpr uint8_t VERSION = 1;
+    static constexpr uint8_t KEY_INLINE = 0xFF;
+
+    explicit DumpBinaryWriter(int32_t fd);
+    ~DumpBinaryWriter() {}
+
+    void BeginObject(const char* key) override;
+    void EndObject() override;
+    void BeginArray(const char* key) override;
+    void EndArray() override;
+    void AddString(const char* key, const char* value) override;
+    void AddNumber(const char* key, double value) override;
+    void AddBool(const char* key, bool value) override;
+
+    /* The known keys, their order is part of the format. */
+    static const char* const KEYS[];
+    static const uint8_t KEY_NUM;
+
+private:
+    void WriteKey(const char* key);
+};
+
+/* Builds one object of cJSON, for UIDumpDomTree::DumpDomNode. Arrays are not supported. */
+class DumpCJsonWriter : public DumpDomWriter {
+public:
+    DumpCJsonWriter() : object_(nullptr) {}
+    ~DumpCJsonWriter()
+    {
+        cJSON_Delete(object_);
+    }
+
+    void BeginObject(const char* key) override;
+    void EndObject() override {}
+    void BeginArray(const char* key) override {}
+    void EndArray() override {}
+    void AddString(const char* key, const char* value) override;
+    void AddNumber(const char* key, double value) override;
+    void AddBool(const char* key, bool value) override;
+
+    /* Returns the object printed by cJSON_Print, to be released by cJSON_free, or nullptr. */
+    char* Print() const;
+
+private:
+    cJSON* object_;
+};
+} // namespace OHOS
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_DUMP_DOM_WRITER_H
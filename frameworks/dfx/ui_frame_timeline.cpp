@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_frame_timeline.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
+#include "dfx/dfx_time.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint16_t TRACE_LINE_SIZE = 160;
+const char* const PHASE_NAME[FRAME_PHASE_MAX] = {
+    "TaskHandler",
+    "Input",
+    "Render",
+    "Measure",
+    "MergeRects",
+    "DrawTop",
+    "Flush",
+};
+} // namespace
+
+UIFrameTimeline* UIFrameTimeline::GetInstance()
+{
+    static UIFrameTimeline instance;
+    return &instance;
+}
+
+uint64_t UIFrameTimeline::GetTimeUs()
+{
+    return DfxTime::GetTimeUs();
+}
+
+const char* UIFrameTimeline::GetPhaseName(FramePhase phase)
+{
+    if (phase >= FRAME_PHASE_MAX) {
+        return "Unknown";
+    }
+    return PHASE_NAME[phase];
+}
+
+void UIFrameTimeline::Record(FramePhase phase, uint64_t startUs, uint64_t endUs)
+{
+    if (!record_) {
+        return;
+    }
+    uint16_t tail = (head_ + count_) % FRAME_TIMELINE_MAX_EVENT_NUM;
+    FrameTimelineEvent& event = events_[tail];
+    event.startUs = startUs;
+    event.durationUs = (endUs > startUs) ? static_cast<uint32_t>(endUs - startUs) : 0;
+    event.frameId = frameId_;
+    event.phase = phase;
+    if (count_ < FRAME_TIMELINE_MAX_EVENT_NUM) {
+        count_++;
+    } else {
+        head_ = (head_ + 1) % FRAME_TIMELINE_MAX_EVENT_NUM;
+    }
+}
+
+bool UIFrameTimeline::GetEvent(uint16_t index, FrameTimelineEvent& event) const
+{
+    if (index >= count_) {
+        return false;
+    }
+    event = events_[(head_ + index) % FRAME_TIMELINE_MAX_EVENT_NUM];
+    return true;
+}
+
+bool UIFrameTimeline::ExportChromeTrace(const char* path) const
+{
+    if (path == nullptr) {
+        return false;
+    }
+    unlink(path);
+    int32_t fd = open(path, O_CREAT | O_RDWR, DEFAULT_FILE_PERMISSION);
+    if (fd < 0) {
+        GRAPHIC_LOGE("UIFrameTimeline::ExportChromeTrace open file failed Err!\n");
+        return false;
+    }
+
+    bool ret = true;
+    char line[TRACE_LINE_SIZE];
+    const char* head = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    uint32_t length = strlen(head);
+    if (static_cast<uint32_t>(write(fd, head, length)) != length) {
+        ret = false;
+    }
+    FrameTimelineEvent event;
+    for (uint16_t i = 0; ret && (i < count_); i++) {
+        GetEvent(i, event);
+        int32_t len = sprintf_s(line, sizeof(line),
+            "%s{\"name\":\"%s\",\"cat\":\"ui\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,\"pid\":0,\"tid\":0,"
+            "\"args\":{\"frame\":%u}}",
+            (i == 0) ? "" : ",\n", GetPhaseName(event.phase), static_cast<unsigned long long>(event.startUs),
+            event.durationUs, event.frameId);
+        if ((len < 0) || (write(fd, line, len) != len)) {
+            ret = false;
+        }
+    }
+    const char* tail = "\n]}\n";
+    length = strlen(tail);
+    if (ret && (static_cast<uint32_t>(write(fd, tail, length)) != length)) {
+        ret = false;
+    }
+    if (!ret) {
+        GRAPHIC_LOGE("UIFrameTimeline::ExportChromeTrace write file failed Err!\n");
+    }
+    if (close(fd) < 0) {
+        return false;
+    }
+    return ret;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_input_latency.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
+#include <climits>
+#include "dfx/dfx_time.h"
+
+namespace OHOS {
+namespace {
+constexpr uint32_t US_PER_MS = 1000;
+} // namespace
+
+UIInputLatency* UIInputLatency::GetInstance()
+{
+    static UIInputLatency instance;
+    return &instance;
+}
+
+uint64_t UIInputLatency::GetTimeUs()
+{
+    return DfxTime::GetTimeUs();
+}
+
+uint32_t UIInputLatency::GetBucketUpperUs(uint8_t index)
+{
+    if (index >= INPUT_LATENCY_BUCKET_NUM - 1) {
+        return UINT32_MAX;
+    }
+    return US_PER_MS << index;
+}
+
+void UIInputLatency::RecordInput(uint64_t timeUs)
+{
+    if (!record_) {
+        return;
+    }
+    if (pendingNum_ >= INPUT_LATENCY_MAX_PENDING_NUM) {
+        /* the oldest samples are kept, they have the largest latencies */
+        droppedCount_++;
+        return;
+    }
+    pendingUs_[pendingNum_++] = timeUs;
+}
+
+void UIInputLatency::RecordFlush(uint64_t timeUs)
+{
+    if (!record_) {
+        return;
+    }
+    for (uint8_t i = 0; i < pendingNum_; i++) {
+        uint64_t latency = (timeUs > pendingUs_[i]) ? (timeUs - pendingUs_[i]) : 0;
+        uint32_t latencyUs = (latency > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(latency);
+        uint8_t index = 0;
+        while ((index < INPUT_LATENCY_BUCKET_NUM - 1) && (latencyUs >= GetBucketUpperUs(index))) {
+            index++;
+        }
+        buckets_[index]++;
+        sampleCount_++;
+        sumUs_ += latencyUs;
+        if (latencyUs > maxUs_) {
+            maxUs_ = latencyUs;
+        }
+    }
+    pendingNum_ = 0;
+}
+
+void UIInputLatency::Clear()
+{
+    pendingNum_ = 0;
+    sampleCount_ = 0;
+    droppedCount_ = 0;
+    maxUs_ = 0;
+    sumUs_ = 0;
+    for (uint8_t i = 0; i < INPUT_LATENCY_BUCKET_NUM; i++) {
+        buckets_[i] = 0;
+    }
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
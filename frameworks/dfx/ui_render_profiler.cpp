@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_render_profiler.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
+#include "common/screen.h"
+#include "dfx/dfx_time.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint16_t REPORT_LINE_SIZE = 160;
+constexpr uint8_t OVERDRAW_MAX_COUNT = UINT8_MAX;
+constexpr uint8_t OVERDRAW_OPA = OPA_OPAQUE / 2; // 2: half, the views stay visible under the heatmap
+/* heatmap colors of the pixels drawn 2, 3, 4 and 5 or more times */
+const ColorType OVERDRAW_COLORS[] = {Color::Blue(), Color::Green(),
+                                     Color::GetColorFromRGB(0xFF, 0x80, 0xC0), // 0xFF, 0x80, 0xC0: pink
+                                     Color::Red()};
+constexpr uint8_t OVERDRAW_COLOR_NUM = sizeof(OVERDRAW_COLORS) / sizeof(OVERDRAW_COLORS[0]);
+} // namespace
+
+UIRenderProfiler* UIRenderProfiler::GetInstance()
+{
+    static UIRenderProfiler instance;
+    return &instance;
+}
+
+UIRenderProfiler::~UIRenderProfiler()
+{
+    SetOverdrawState(false);
+}
+
+uint64_t UIRenderProfiler::GetTimeUs()
+{
+    return DfxTime::GetTimeUs();
+}
+
+void UIRenderProfiler::BeginFrame()
+{
+    if (!profile_) {
+        return;
+    }
+    if (frameNum_ >= frameWindow_) {
+        Publish();
+    }
+    frameNum_++;
+}
+
+ViewRenderCost* UIRenderProfiler::FindCost(const UIView* view)
+{
+    /* 3: views are at least 8-byte aligned, the low bits carry no information */
+    uint16_t slot = static_cast<uint16_t>((reinterpret_cast<uintptr_t>(view) >> 3) % RENDER_PROFILER_MAX_VIEW_NUM);
+    for (uint16_t i = 0; i < RENDER_PROFILER_MAX_VIEW_NUM; i++) {
+        ViewRenderCost& cost = costs_[slot];
+        if (cost.view == view) {
+            return &cost;
+        }
+        if (cost.view == nullptr) {
+            cost.view = view;
+            cost.type = view->GetViewType();
+            const char* id = view->GetViewId();
+            if ((id == nullptr) || (strncpy_s(cost.id, sizeof(cost.id), id, sizeof(cost.id) - 1) != EOK)) {
+                cost.id[0] = '\0';
+            }
+            return &cost;
+        }
+        slot = (slot + 1) % RENDER_PROFILER_MAX_VIEW_NUM;
+    }
+    return nullptr;
+}
+
+void UIRenderProfiler::Record(const UIView* view, bool postDraw, uint64_t startUs, uint64_t endUs, const Rect& area)
+{
+    if (!profile_ || (view == nullptr)) {
+        return;
+    }
+    ViewRenderCost* cost = FindCost(view);
+    if (cost == nullptr) {
+        droppedNum_++;
+        return;
+    }
+    uint32_t durationUs = (endUs > startUs) ? static_cast<uint32_t>(endUs - startUs) : 0;
+    if (postDraw) {
+        cost->postDrawUs += durationUs;
+        return;
+    }
+    cost->drawUs += durationUs;
+    cost->drawCount++;
+    if (!area.IsEmpty()) {
+        cost->pixels += area.GetSize();
+    }
+}
+
+void UIRenderProfiler::Publish()
+{
+    reportNum_ = 0;
+    for (uint16_t i = 0; i < RENDER_PROFILER_MAX_VIEW_NUM; i++) {
+        if (costs_[i].view == nullptr) {
+            continue;
+        }
+        /* insertion sort, the report is built once per window */
+        uint16_t pos = reportNum_++;
+        while ((pos > 0) && (report_[pos - 1].GetTotalUs() < costs_[i].GetTotalUs())) {
+            report_[pos] = report_[pos - 1];
+            pos--;
+        }
+        report_[pos] = costs_[i];
+    }
+    reportFrameNum_ = frameNum_;
+    frameNum_ = 0;
+    if (memset_s(costs_, sizeof(costs_), 0, sizeof(costs_)) != EOK) {
+        GRAPHIC_LOGE("UIRenderProfiler::Publish memset_s failed Err!\n");
+    }
+}
+
+uint16_t UIRenderProfiler::GetReport(ViewRenderCost* costs, uint16_t num) const
+{
+    if (costs == nullptr) {
+        return 0;
+    }
+    uint16_t count = MATH_MIN(num, reportNum_);
+    for (uint16_t i = 0; i < count; i++) {
+        costs[i] = report_[i];
+    }
+    return count;
+}
+
+bool UIRenderProfiler::DumpReport(const char* path) const
+{
+    if (path == nullptr) {
+        return false;
+    }
+    unlink(path);
+    int32_t fd = open(path, O_CREAT | O_RDWR, DEFAULT_FILE_PERMISSION);
+    if (fd < 0) {
+        GRAPHIC_LOGE("UIRenderProfiler::DumpReport open file failed Err!\n");
+        return false;
+    }
+
+    bool ret = true;
+    char line[REPORT_LINE_SIZE];
+    int32_t len = sprintf_s(line, sizeof(line), "frames: %u, dropped: %u\ntotalUs\tdrawUs\tpostDrawUs\tdraws\tpixels\t"
+        "type\tid\n", reportFrameNum_, droppedNum_);
+    if ((len < 0) || (write(fd, line, len) != len)) {
+        ret = false;
+    }
+    for (uint16_t i = 0; ret && (i < reportNum_); i++) {
+        const ViewRenderCost& cost = report_[i];
+        len = sprintf_s(line, sizeof(line), "%u\t%u\t%u\t%u\t%llu\t%s\t%s\n", cost.GetTotalUs(), cost.drawUs,
+            cost.postDrawUs, cost.drawCount, static_cast<unsigned long long>(cost.pixels),
+            (cost.type < UI_NUMBER_MAX) ? VIEW_TYPE_STRING[cost.type] : "UIView", cost.id);
+        if ((len < 0) || (write(fd, line, len) != len)) {
+            ret = false;
+        }
+    }
+    if (!ret) {
+        GRAPHIC_LOGE("UIRenderProfiler::DumpReport write file failed Err!\n");
+    }
+    if (close(fd) < 0) {
+        return false;
+    }
+    return ret;
+}
+
+void UIRenderProfiler::Clear()
+{
+    frameNum_ = 0;
+    reportFrameNum_ = 0;
+    reportNum_ = 0;
+    droppedNum_ = 0;
+    if (memset_s(costs_, sizeof(costs_), 0, sizeof(costs_)) != EOK) {
+        GRAPHIC_LOGE("UIRenderProfiler::Clear memset_s failed Err!\n");
+    }
+}
+
+bool UIRenderProfiler::SetOverdrawState(bool show)
+{
+    if (!show) {
+        delete[] overdrawCounts_;
+        overdrawCounts_ = nullptr;
+        overdrawBuffer_ = nullptr;
+        overdrawWidth_ = 0;
+        overdrawHeight_ = 0;
+        return true;
+    }
+    if (overdrawCounts_ != nullptr) {
+        return true;
+    }
+    int16_t width = Screen::GetInstance().GetWidth();
+    int16_t height = Screen::GetInstance().GetHeight();
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    overdrawCounts_ = new uint8_t[width * height];
+    if (overdrawCounts_ == nullptr) {
+        GRAPHIC_LOGE("UIRenderProfiler::SetOverdrawState new counts fail");
+        return false;
+    }
+    if (memset_s(overdrawCounts_, width * height, 0, width * height) != EOK) {
+        delete[] overdrawCounts_;
+        overdrawCounts_ = nullptr;
+        return false;
+    }
+    overdrawWidth_ = width;
+    overdrawHeight_ = height;
+    return true;
+}
+
+void UIRenderProfiler::BeginOverdraw(const BufferInfo& dst, const Rect& rect)
+{
+    if (overdrawCounts_ == nullptr) {
+        return;
+    }
+    overdrawBuffer_ = dst.virAddr;
+    Rect area;
+    if (!area.Intersect(rect, Rect(0, 0, overdrawWidth_ - 1, overdrawHeight_ - 1))) {
+        return;
+    }
+    for (int16_t y = area.GetTop(); y <= area.GetBottom(); y++) {
+        uint8_t* row = overdrawCounts_ + y * overdrawWidth_ + area.GetLeft();
+        if (memset_s(row, area.GetWidth(), 0, area.GetWidth()) != EOK) {
+            return;
+        }
+    }
+}
+
+bool UIRenderProfiler::IsDrawingNothing(const UIView* view)
+{
+    /* these types only draw the style rect of UIView::OnDraw, which is empty when both parts are transparent */
+    UIViewType type = view->GetViewType();
+    if ((type != UI_ROOT_VIEW) && (type != UI_VIEW_GROUP) && (type != UI_NUMBER_MAX)) {
+        return false;
+    }
+    bool noBackground = (view->GetStyle(STYLE_BACKGROUND_OPA) == OPA_TRANSPARENT);
+    bool noBorder = (view->GetStyle(STYLE_BORDER_WIDTH) == 0) || (view->GetStyle(STYLE_BORDER_OPA) == OPA_TRANSPARENT);
+    return noBackground && noBorder;
+}
+
+void UIRenderProfiler::AddOverdraw(const UIView* view, const BufferInfo& dst, const Rect& area)
+{
+    if ((overdrawCounts_ == nullptr) || (view == nullptr) || (dst.virAddr != overdrawBuffer_) ||
+        IsDrawingNothing(view)) {
+        return;
+    }
+    Rect drawn;
+    if (!drawn.Intersect(area, Rect(0, 0, overdrawWidth_ - 1, overdrawHeight_ - 1))) {
+        return;
+    }
+    for (int16_t y = drawn.GetTop(); y <= drawn.GetBottom(); y++) {
+        uint8_t* count = overdrawCounts_ + y * overdrawWidth_ + drawn.GetLeft();
+        for (int16_t x = drawn.GetLeft(); x <= drawn.GetRight(); x++, count++) {
+            if (*count < OVERDRAW_MAX_COUNT) {
+                (*count)++;
+            }
+        }
+    }
+}
+
+void UIRenderProfiler::EndOverdraw(BufferInfo& dst, const Rect& rect)
+{
+    if (overdrawCounts_ == nullptr) {
+        return;
+    }
+    Rect area;
+    if (!area.Intersect(rect, Rect(0, 0, overdrawWidth_ - 1, overdrawHeight_ - 1))) {
+        return;
+    }
+    /* one fill per run of pixels with the same count, the pixels drawn once keep their colors */
+    BaseGfxEngine* engine = BaseGfxEngine::GetInstance();
+    for (int16_t y = area.GetTop(); y <= area.GetBottom(); y++) {
+        const uint8_t* row = overdrawCounts_ + y * overdrawWidth_;
+        int16_t x = area.GetLeft();
+        while (x <= area.GetRight()) {
+            uint8_t count = row[x];
+            int16_t start = x;
+            while ((x <= area.GetRight()) && (row[x] == count)) {
+                x++;
+            }
+            if (count < 2) { // 2: drawn more than once
+                continue;
+            }
+            uint8_t colorIndex = MATH_MIN(count - 2, OVERDRAW_COLOR_NUM - 1); // 2: the first tinted count
+            engine->Fill(dst, Rect(start, y, x - 1, y), OVERDRAW_COLORS[colorIndex], OVERDRAW_OPA);
+        }
+    }
+}
+
+uint8_t UIRenderProfiler::GetOverdrawCount(int16_t x, int16_t y) const
+{
+    if ((overdrawCounts_ == nullptr) || (x < 0) || (y < 0) || (x >= overdrawWidth_) || (y >= overdrawHeight_)) {
+        return 0;
+    }
+    return overdrawCounts_[y * overdrawWidth_ + x];
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
@@ -14,15 +14,34 @@
  */
 
 #include "dock/input_device.h"
+#include "dfx/ui_frame_timeline.h"
+#include "dfx/ui_input_latency.h"
 
 namespace OHOS {
 void InputDevice::ProcessEvent()
 {
+    DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_INPUT);
     DeviceData data;
     bool moreToRead = false;
     do {
         moreToRead = Read(data);
-        DispatchEvent(data);
+        DEBUG_INPUT_LATENCY_RECORD_INPUT();
+        if (!coalesceEvent_) {
+            DispatchEvent(data);
+            continue;
+        }
+        if (!IsCoalescable(data)) {
+            FlushEvent();
+            DispatchEvent(data);
+            continue;
+        }
+#if ENABLE_WINDOW
+        if (hasPendingData_ && (pendingData_.winId != data.winId)) {
+            FlushEvent();
+        }
+#endif
+        pendingData_ = data;
+        hasPendingData_ = true;
     } while (moreToRead);
 }
 }  // namespace OHOS
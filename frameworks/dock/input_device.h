@@ -25,7 +25,7 @@ namespace OHOS {
  */
 class InputDevice : public HeapBase {
 public:
-    InputDevice() : rawDataState_(STATE_RELEASE) {}
+    InputDevice() : rawDataState_(STATE_RELEASE), coalesceEvent_(false), hasPendingData_(false), pendingData_() {}
     virtual ~InputDevice() {}
 
     /**
@@ -42,6 +42,45 @@ public:
      */
     virtual bool Read(DeviceData& data) = 0;
 
+    /**
+     * @brief Sets whether samples that only continue an event are coalesced. Coalescing is disabled by default.
+     *
+     * When enabled, a coalescable sample is held back instead of dispatched, and each later one replaces it, so that
+     * the views get one event per frame with the summed movement instead of one event per sample. The held sample is
+     * dispatched by {@link FlushEvent}, which the render manager calls before each frame, or before the next sample
+     * that cannot be coalesced, so no press or release is lost or reordered.
+     *
+     * @param coalesce Specifies whether to coalesce samples.
+     */
+    void SetEventCoalesce(bool coalesce)
+    {
+        coalesceEvent_ = coalesce;
+        if (!coalesce) {
+            FlushEvent();
+        }
+    }
+
+    /**
+     * @brief Obtains whether samples are coalesced.
+     *
+     * @return Returns <b>true</b> if samples are coalesced; returns <b>false</b> otherwise.
+     */
+    bool IsEventCoalesced() const
+    {
+        return coalesceEvent_;
+    }
+
+    /**
+     * @brief Dispatches the sample held back by coalescing, if any.
+     */
+    void FlushEvent()
+    {
+        if (hasPendingData_) {
+            hasPendingData_ = false;
+            DispatchEvent(pendingData_);
+        }
+    }
+
     constexpr static uint8_t STATE_RELEASE = 0;
     constexpr static uint8_t STATE_PRESS = 1;
 
@@ -53,6 +92,21 @@ protected:
      * @param [in] data data received from hardware
      */
     virtual void DispatchEvent(const DeviceData& data) = 0;
+
+    /**
+     * @brief Checks whether a sample may be merged into the next one when coalescing is enabled.
+     * @param [in] data data received from hardware
+     * @returns true if only the latest of a run of such samples needs to be dispatched.
+     */
+    virtual bool IsCoalescable(const DeviceData& data) const
+    {
+        return false;
+    }
+
+private:
+    bool coalesceEvent_;
+    bool hasPendingData_;
+    DeviceData pendingData_;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_INPUT_DEVICE_H
@@ -45,12 +45,13 @@ void PointerInputDevice::DispatchEvent(const DeviceData& data)
         GRAPHIC_LOGE("No valid rootview to dispatch input event!\n");
         return;
     }
-    // invalid touchable and draggable view will be reset to nullptr
-    if ((touchableView_ != nullptr) && !RootView::FindSubView(*rootView, touchableView_)) {
+    // invalid touchable and draggable view will be reset to nullptr, they stay valid while no view moved in or out
+    bool treeChanged = (checkedRootView_ != rootView) || (attachGeneration_ != UIViewGroup::GetAttachGeneration());
+    if (treeChanged && (touchableView_ != nullptr) && !IsViewAttached(*rootView, touchableView_)) {
         touchableView_ = nullptr;
         lastPos_ = curPos_;
     }
-    if ((draggableView_ != nullptr) && !RootView::FindSubView(*rootView, draggableView_)) {
+    if (treeChanged && (draggableView_ != nullptr) && !IsViewAttached(*rootView, draggableView_)) {
         draggableView_ = nullptr;
         lastPos_ = curPos_;
         dragLastPos_ = curPos_;
@@ -58,6 +59,9 @@ void PointerInputDevice::DispatchEvent(const DeviceData& data)
         dragStep_ = { 0, 0 };
         isDragging_ = false;
     }
+    checkedRootView_ = rootView;
+    attachGeneration_ = UIViewGroup::GetAttachGeneration();
+    destroyGeneration_ = UIView::GetDestroyGeneration();
 
     if (data.state == STATE_PRESS) {
         DispatchPressEvent(rootView);
@@ -68,6 +72,22 @@ void PointerInputDevice::DispatchEvent(const DeviceData& data)
     lastPos_ = curPos_;
 }
 
+bool PointerInputDevice::IsViewAttached(const UIViewGroup& rootView, const UIView* view)
+{
+    if ((checkedRootView_ != &rootView) || (destroyGeneration_ != UIView::GetDestroyGeneration())) {
+        /* view may have been destroyed, it must not be dereferenced */
+        treeSearchCount_++;
+        return RootView::FindSubView(rootView, view);
+    }
+    while (view != nullptr) {
+        if (view == &rootView) {
+            return true;
+        }
+        view = view->GetParent();
+    }
+    return false;
+}
+
 void PointerInputDevice::DispatchPressEvent(UIViewGroup* rootView)
 {
     // first time to press
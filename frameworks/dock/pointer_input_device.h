@@ -28,13 +28,26 @@ public:
         : touchableView_(nullptr), draggableView_(nullptr), targetView_(nullptr), lastPos_({0, 0}),
           dragLastPos_({0, 0}), curPos_({ 0, 0 }), dragStep_({ 0, 0 }), dragLen_({ 0, 0 }), pressState_(false),
           pressSent_(false), longPressSent_(false), cancelSent_(false), isDragging_(false), needClick_(true),
-          pressTimeStamp_(0)
+          pressTimeStamp_(0), checkedRootView_(nullptr), attachGeneration_(0), destroyGeneration_(0),
+          treeSearchCount_(0)
     {}
     virtual ~PointerInputDevice() {}
 
+    /* Obtains how often a captured view was searched for in the whole tree, only done after a view was destroyed */
+    uint32_t GetTreeSearchCount() const
+    {
+        return treeSearchCount_;
+    }
+
 protected:
     void DispatchEvent(const DeviceData& data) override;
 
+    /* only moves of a started drag are coalesced, the drag view then gets their summed movement in one event */
+    bool IsCoalescable(const DeviceData& data) const override
+    {
+        return (data.state == STATE_PRESS) && pressState_ && isDragging_ && (draggableView_ != nullptr);
+    }
+
 private:
     UIView* touchableView_;
     UIView* draggableView_;
@@ -51,6 +64,11 @@ private:
     bool isDragging_;
     bool needClick_;
     uint32_t pressTimeStamp_;
+    /* the touchable and draggable views were in the tree of checkedRootView_ at these generations */
+    const UIViewGroup* checkedRootView_;
+    uint32_t attachGeneration_;
+    uint32_t destroyGeneration_;
+    uint32_t treeSearchCount_;
 
     void DispatchPressEvent(UIViewGroup* rootView);
     void DispatchReleaseEvent(UIViewGroup* rootView);
@@ -60,6 +78,7 @@ private:
     void DispatchLongPressEvent(uint32_t elapse);
     void DispatchCancelEvent();
     bool ProcessReleaseEvent();
+    bool IsViewAttached(const UIViewGroup& rootView, const UIView* view);
     UIView* GetDraggableView(UIView* targetView) const
     {
         UIView* tempView = targetView;
@@ -23,6 +23,7 @@
 #include "gfx_utils/graphic_log.h"
 #include "render/render_base.h"
 #include "render/render_pixfmt_rgba_blend.h"
+#include "securec.h"
 
 namespace OHOS {
 using UICanvasPath = DepictCurve;
@@ -92,94 +93,202 @@ ClipPath& ClipPath::Circle(const PointF& center, float radius)
     return *this;
 }
 
-UICanvasVertices& ClipUtils::CloseVertices(const ClipPath& path)
-{
-    UICanvasVertices& vertices = path.GetVertices();
-    vertices.ClosePolygon();
-    return vertices;
-}
+constexpr uint8_t ClipMask::MIN_SOLID_RUN;
 
-void ClipUtils::PerformScan(const ClipPath& path, const ImageInfo* imageInfo)
+bool ClipMask::Build(const ClipPath& path, int16_t width, int16_t height)
 {
+    Clear();
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    rowStart_ = new uint32_t[height + 1];
+    if (rowStart_ == nullptr) {
+        GRAPHIC_LOGE("ClipMask::Build new rowStart_ fail");
+        Clear();
+        return false;
+    }
+    (void)memset_s(rowStart_, (height + 1) * sizeof(uint32_t), 0, (height + 1) * sizeof(uint32_t));
+
     RasterizerScanlineAntialias rasterizer;
     GeometryScanline scanline;
     TransAffine transform;
-    UICanvasVertices& vertices = CloseVertices(path);
-    UICanvasPath canvasPath(vertices);
+    UICanvasPath canvasPath(path.CloseVertices());
     PathTransform pathTransform(canvasPath, transform);
+    rasterizer.ClipBox(0, 0, width, height);
     rasterizer.Reset();
     rasterizer.AddPath(pathTransform);
+
+    /* the first sweep counts the spans and covers, the second one stores them */
+    Sweep(rasterizer, scanline, false);
+    if (spanNum_ == 0) {
+        return true;
+    }
+    spans_ = new Span[spanNum_];
+    if (coverNum_ > 0) {
+        covers_ = new uint8_t[coverNum_];
+    }
+    if ((spans_ == nullptr) || ((coverNum_ > 0) && (covers_ == nullptr))) {
+        GRAPHIC_LOGE("ClipMask::Build new spans fail");
+        Clear();
+        return false;
+    }
+    Sweep(rasterizer, scanline, true);
+    for (int16_t y = 0; y < height; y++) {
+        rowStart_[y + 1] += rowStart_[y];
+    }
+    return true;
+}
+
+void ClipMask::Sweep(RasterizerScanlineAntialias& rasterizer, GeometryScanline& scanline, bool store)
+{
+    spanNum_ = 0;
+    coverNum_ = 0;
     if (!rasterizer.RewindScanlines()) {
-        for (int32_t i = 0; i < imageInfo->header.height; i++) {
-            DrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
-        }
         return;
     }
     scanline.Reset(rasterizer.GetMinX(), rasterizer.GetMaxX());
-
-    bool first = true;
-    int16_t y = 0;
     while (rasterizer.SweepScanline(scanline)) {
-        y = scanline.GetYLevel();
-        if (first) {
-            for (int32_t i = 0; i < y; i++) {
-                DrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
-            }
-            first = false;
+        int32_t y = scanline.GetYLevel();
+        if ((y < 0) || (y >= height_)) {
+            continue;
         }
         uint32_t numSpans = scanline.NumSpans();
         GeometryScanline::ConstIterator span = scanline.Begin();
-        int16_t index = 0;
         while (true) {
             int32_t x = span->x;
             int32_t len = span->spanLength;
             const uint8_t* covers = span->covers;
-
-            if (len < 0) {
+            bool solid = (len < 0);
+            if (solid) {
                 len = -len;
             }
-            DrawHorLine(index, y, x - index - 1, OPA_TRANSPARENT, imageInfo);
-            for (int16_t i = x; i < x + len; i++, covers++) {
-                DrawPixel(i, y, *covers, imageInfo);
+            if (x < 0) {
+                covers += solid ? 0 : -x;
+                len += x;
+                x = 0;
+            }
+            len = MATH_MIN(len, width_ - x);
+            if (len > 0) {
+                if (solid) {
+                    AddSpan(y, x, len, nullptr, *covers, store);
+                } else {
+                    AddCovers(y, x, len, covers, store);
+                }
             }
-            index = x + len;
             if (--numSpans == 0) {
                 break;
             }
             ++span;
         }
-        DrawHorLine(index, y, imageInfo->header.width - index, OPA_TRANSPARENT, imageInfo);
     }
+}
 
-    for (int32_t i = y + 1; i < imageInfo->header.height; i++) {
-        DrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
+void ClipMask::AddCovers(int16_t y, int16_t x, int16_t length, const uint8_t* covers, bool store)
+{
+    /* split into long runs of one coverage, and the pixels in between which keep their own coverage */
+    int16_t start = 0;
+    int16_t i = 0;
+    while (i < length) {
+        int16_t run = 1;
+        while ((i + run < length) && (covers[i + run] == covers[i])) {
+            run++;
+        }
+        if ((covers[i] == OPA_TRANSPARENT) || (run >= MIN_SOLID_RUN)) {
+            AddSpan(y, x + start, i - start, covers + start, 0, store);
+            AddSpan(y, x + i, run, nullptr, covers[i], store);
+            start = i + run;
+        }
+        i += run;
     }
+    AddSpan(y, x + start, length - start, covers + start, 0, store);
 }
 
-void ClipUtils::DrawPixel(int16_t x, int16_t y, uint8_t opa, const ImageInfo* imageInfo)
+void ClipMask::AddSpan(int16_t y, int16_t x, int16_t length, const uint8_t* covers, uint8_t cover, bool store)
 {
-    if (x < 0 || x > imageInfo->header.width - 1 || y < 0 || y > imageInfo->header.height - 1) {
+    if ((length <= 0) || ((covers == nullptr) && (cover == OPA_TRANSPARENT))) {
         return;
     }
+    if (store) {
+        Span& span = spans_[spanNum_];
+        span.x = x;
+        span.length = length;
+        span.cover = cover;
+        span.covers = nullptr;
+        if (covers != nullptr) {
+            (void)memcpy_s(covers_ + coverNum_, length, covers, length);
+            span.covers = covers_ + coverNum_;
+        }
+        rowStart_[y + 1]++;
+    }
+    spanNum_++;
+    if (covers != nullptr) {
+        coverNum_ += length;
+    }
+}
 
-    int32_t offset = imageInfo->header.width * y + x;
-    switch (imageInfo->header.colorMode) {
-        case ARGB8888: {
-            Color32* buffer = reinterpret_cast<Color32*>(const_cast<uint8_t*>(imageInfo->data));
-            buffer[offset].alpha = buffer[offset].alpha * opa / OPA_OPAQUE;
-            break;
+void ClipMask::Clear()
+{
+    delete[] rowStart_;
+    delete[] spans_;
+    delete[] covers_;
+    rowStart_ = nullptr;
+    spans_ = nullptr;
+    covers_ = nullptr;
+    spanNum_ = 0;
+    coverNum_ = 0;
+    width_ = 0;
+    height_ = 0;
+}
+
+void ClipMask::Apply(const ImageInfo* imageInfo) const
+{
+    if ((imageInfo == nullptr) || (imageInfo->data == nullptr)) {
+        return;
+    }
+    if (imageInfo->header.colorMode != ARGB8888) {
+        GRAPHIC_LOGE("Only images in ARGB8888 format are supported!");
+        return;
+    }
+    int16_t width = imageInfo->header.width;
+    Color32* row = reinterpret_cast<Color32*>(const_cast<uint8_t*>(imageInfo->data));
+    for (int16_t y = 0; y < imageInfo->header.height; y++, row += width) {
+        uint32_t spanNum;
+        const Span* span = GetRowSpans(y, spanNum);
+        int16_t x = 0;
+        for (; spanNum > 0; spanNum--, span++) {
+            int16_t start = MATH_MIN(span->x, width);
+            int16_t end = MATH_MIN(static_cast<int16_t>(span->x + span->length), width);
+            for (; x < start; x++) {
+                row[x].alpha = OPA_TRANSPARENT;
+            }
+            if (span->covers != nullptr) {
+                for (const uint8_t* covers = span->covers; x < end; x++, covers++) {
+                    row[x].alpha = row[x].alpha * (*covers) / OPA_OPAQUE;
+                }
+            } else if (span->cover != OPA_OPAQUE) {
+                for (; x < end; x++) {
+                    row[x].alpha = row[x].alpha * span->cover / OPA_OPAQUE;
+                }
+            }
+            x = end;
         }
-        default: {
-            GRAPHIC_LOGE("Only images in ARGB8888 format are supported!");
-            break;
+        for (; x < width; x++) {
+            row[x].alpha = OPA_TRANSPARENT;
         }
     }
 }
 
-void ClipUtils::DrawHorLine(int16_t x, int16_t y, int16_t len, uint8_t opa, const ImageInfo* imageInfo)
+void ClipUtils::PerformScan(const ClipPath& path, const ImageInfo* imageInfo)
 {
-    for (int32_t i = x; i <= x + len; i++) {
-        DrawPixel(i, y, opa, imageInfo);
+    if (imageInfo == nullptr) {
+        return;
+    }
+    ClipMask mask;
+    if (!mask.Build(path, imageInfo->header.width, imageInfo->header.height)) {
+        return;
     }
+    mask.Apply(imageInfo);
 }
 };
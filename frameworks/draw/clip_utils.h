@@ -16,6 +16,8 @@
 #ifndef GRAPHIC_LITE_CLIP_UTILS_H
 #define GRAPHIC_LITE_CLIP_UTILS_H
 
+#include "gfx_utils/diagram/rasterizer/rasterizer_scanline_antialias.h"
+#include "gfx_utils/diagram/scanline/geometry_scanline.h"
 #include "gfx_utils/diagram/vertexprimitive/geometry_path_storage.h"
 #include "gfx_utils/geometry2d.h"
 #include "gfx_utils/image_info.h"
@@ -54,20 +56,97 @@ public:
     {
         return *vertices_;
     }
+
+    /* Closes the path before it is rasterized. */
+    UICanvasVertices& CloseVertices() const
+    {
+        vertices_->ClosePolygon();
+        return *vertices_;
+    }
 private:
     UICanvasVertices* vertices_;
 };
 
+/*
+ * The coverage of a clip path, kept as sorted spans per row so that it can be applied while drawing without
+ * touching the source image. Rows without spans are fully clipped.
+ */
+class ClipMask : public HeapBase {
+public:
+    struct Span {
+        int16_t x;
+        int16_t length;
+        /* coverage of every pixel, nullptr if the whole span has the coverage of cover */
+        const uint8_t* covers;
+        uint8_t cover;
+    };
+
+    ClipMask() : width_(0), height_(0), rowStart_(nullptr), spans_(nullptr), covers_(nullptr), spanNum_(0),
+        coverNum_(0) {}
+    ~ClipMask()
+    {
+        Clear();
+    }
+
+    /* Rasterizes the path inside a width x height area. Returns false if memory runs out. */
+    bool Build(const ClipPath& path, int16_t width, int16_t height);
+
+    void Clear();
+
+    /* Clips an ARGB8888 image in place, the pixels outside the mask become transparent. */
+    void Apply(const ImageInfo* imageInfo) const;
+
+    /* Returns the spans of row y in ascending order, nullptr if the row is fully clipped. */
+    const Span* GetRowSpans(int16_t y, uint32_t& spanNum) const
+    {
+        if ((rowStart_ == nullptr) || (y < 0) || (y >= height_)) {
+            spanNum = 0;
+            return nullptr;
+        }
+        spanNum = rowStart_[y + 1] - rowStart_[y];
+        return (spanNum == 0) ? nullptr : &spans_[rowStart_[y]];
+    }
+
+    int16_t GetWidth() const
+    {
+        return width_;
+    }
+
+    int16_t GetHeight() const
+    {
+        return height_;
+    }
+
+    /* Returns the bytes held by the mask. */
+    uint32_t GetSize() const
+    {
+        return (rowStart_ == nullptr) ? 0 : ((height_ + 1) * sizeof(uint32_t) + spanNum_ * sizeof(Span) + coverNum_);
+    }
+
+private:
+    /* runs of at least this many equally covered pixels are kept as one span, so they are blended at once */
+    static constexpr uint8_t MIN_SOLID_RUN = 4;
+
+    void Sweep(RasterizerScanlineAntialias& rasterizer, GeometryScanline& scanline, bool store);
+    void AddCovers(int16_t y, int16_t x, int16_t length, const uint8_t* covers, bool store);
+    void AddSpan(int16_t y, int16_t x, int16_t length, const uint8_t* covers, uint8_t cover, bool store);
+
+    int16_t width_;
+    int16_t height_;
+    uint32_t* rowStart_;
+    Span* spans_;
+    uint8_t* covers_;
+    uint32_t spanNum_;
+    uint32_t coverNum_;
+};
+
 class ClipUtils : public HeapBase {
 public:
     ClipUtils() {}
     ~ClipUtils() {}
 
+    /* Clips an ARGB8888 image in place. Use ClipMask to clip while drawing and keep the image. */
     void PerformScan(const ClipPath& path, const ImageInfo* imageInfo);
-private:
-    UICanvasVertices& CloseVertices(const ClipPath& path);
-    void DrawPixel(int16_t x, int16_t y, uint8_t opa, const ImageInfo* imageInfo);
-    void DrawHorLine(int16_t x, int16_t y, int16_t width, uint8_t opa, const ImageInfo* imageInfo);
 };
 };
 #endif
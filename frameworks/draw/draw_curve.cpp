@@ -14,10 +14,21 @@
  */
 
 #include "draw/draw_curve.h"
-#include "animator/interpolation.h"
+#include "draw/draw_utils.h"
 #include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/diagram/depiction/depict_curve.h"
+#include "gfx_utils/diagram/depiction/depict_stroke.h"
+#include "gfx_utils/diagram/rasterizer/rasterizer_scanline_antialias.h"
+#include "gfx_utils/diagram/scanline/geometry_scanline.h"
+#include "gfx_utils/graphic_math.h"
+#include "render/render_base.h"
+#include "render/render_buffer.h"
+#include "render/render_pixfmt_rgba_blend.h"
+#include "render/render_scanline.h"
 
 namespace OHOS {
+constexpr uint16_t DrawCurve::MAX_SEGMENT_NUM;
+
 void DrawCurve::DrawCubicBezier(BufferInfo& gfxDstBuffer, const Point& start, const Point& control1,
                                 const Point& control2, const Point& end, const Rect& mask,
                                 int16_t width, const ColorType& color, OpacityType opacity)
@@ -26,16 +37,188 @@ void DrawCurve::DrawCubicBezier(BufferInfo& gfxDstBuffer, const Point& start, co
         return;
     }
 
-    Point prePoint = start;
-    for (int16_t t = 1; t <= INTERPOLATION_RANGE; t++) {
-        Point point;
-        point.x = Interpolation::GetBezierInterpolation(t, start.x, control1.x, control2.x, end.x);
-        point.y = Interpolation::GetBezierInterpolation(t, start.y, control1.y, control2.y, end.y);
-        if ((prePoint.x == point.x) && (prePoint.y == point.y)) {
+    uint16_t segmentNum = GetSegmentNum(start, control1, control2, end);
+    float x;
+    float y;
+    if (IsStrokeSupported(gfxDstBuffer)) {
+        UICanvasVertices vertices;
+        vertices.MoveTo(start.x + HALF_PIXEL, start.y + HALF_PIXEL);
+        for (uint16_t i = 1; i <= segmentNum; i++) {
+            GetBezierPoint(start, control1, control2, end, static_cast<float>(i) / segmentNum, x, y);
+            vertices.LineTo(x + HALF_PIXEL, y + HALF_PIXEL);
+        }
+        StrokeVertices(gfxDstBuffer, vertices, mask, width, color, opacity);
+        vertices.FreeAll();
+        return;
+    }
+
+    Point points[MAX_SEGMENT_NUM + 1];
+    uint16_t pointNum = 0;
+    points[pointNum++] = start;
+    for (uint16_t i = 1; i <= segmentNum; i++) {
+        GetBezierPoint(start, control1, control2, end, static_cast<float>(i) / segmentNum, x, y);
+        Point point = {static_cast<int16_t>(MATH_ROUND(x)), static_cast<int16_t>(MATH_ROUND(y))};
+        if ((points[pointNum - 1].x == point.x) && (points[pointNum - 1].y == point.y)) {
+            continue;
+        }
+        points[pointNum++] = point;
+    }
+    DrawSegments(gfxDstBuffer, points, pointNum, mask, width, color, opacity);
+}
+
+void DrawCurve::DrawPolyline(BufferInfo& gfxDstBuffer, const Point* points, uint16_t pointNum, const Rect& mask,
+                             int16_t width, const ColorType& color, OpacityType opacity)
+{
+    if ((points == nullptr) || (pointNum < 2) || (width == 0) || (opacity == OPA_TRANSPARENT)) { // 2: one segment
+        return;
+    }
+    if (!IsStrokeSupported(gfxDstBuffer)) {
+        DrawSegments(gfxDstBuffer, points, pointNum, mask, width, color, opacity);
+        return;
+    }
+
+    UICanvasVertices vertices;
+    vertices.MoveTo(points[0].x + HALF_PIXEL, points[0].y + HALF_PIXEL);
+    for (uint16_t i = 1; i < pointNum; i++) {
+        vertices.LineTo(points[i].x + HALF_PIXEL, points[i].y + HALF_PIXEL);
+    }
+    StrokeVertices(gfxDstBuffer, vertices, mask, width, color, opacity);
+    vertices.FreeAll();
+}
+
+uint16_t DrawCurve::GetSegmentNum(const Point& start, const Point& control1, const Point& control2, const Point& end)
+{
+    /*
+     * Wang's formula: a cubic split into n even steps of t stays within FLATNESS of its chords if
+     * n >= sqrt(3 * 2 / 8 * dd / FLATNESS), where dd is the longest second difference of the control points.
+     */
+    float ddx1 = start.x - 2 * control1.x + control2.x; // 2: second difference
+    float ddy1 = start.y - 2 * control1.y + control2.y; // 2: second difference
+    float ddx2 = control1.x - 2 * control2.x + end.x;   // 2: second difference
+    float ddy2 = control1.y - 2 * control2.y + end.y;   // 2: second difference
+    float dd = Sqrt(MATH_MAX(ddx1 * ddx1 + ddy1 * ddy1, ddx2 * ddx2 + ddy2 * ddy2));
+    float segmentNum = Sqrt(0.75f * dd / FLATNESS); // 0.75: 3 * 2 / 8 for a cubic
+    if (segmentNum >= MAX_SEGMENT_NUM) {
+        return MAX_SEGMENT_NUM;
+    }
+    return static_cast<uint16_t>(segmentNum) + 1;
+}
+
+void DrawCurve::GetBezierPoint(const Point& start, const Point& control1, const Point& control2, const Point& end,
+                               float t, float& x, float& y)
+{
+    float mt = 1 - t;
+    float a = mt * mt * mt;
+    float b = 3 * mt * mt * t; // 3: cubic bezier coefficient
+    float c = 3 * mt * t * t;  // 3: cubic bezier coefficient
+    float d = t * t * t;
+    x = a * start.x + b * control1.x + c * control2.x + d * end.x;
+    y = a * start.y + b * control1.y + c * control2.y + d * end.y;
+}
+
+void DrawCurve::StrokeVertices(BufferInfo& gfxDstBuffer, UICanvasVertices& vertices, const Rect& mask,
+                               int16_t width, const ColorType& color, OpacityType opacity)
+{
+    DepictCurve path(vertices);
+    DepictStroke<DepictCurve> stroke(path);
+    stroke.SetWidth(width);
+#if GRAPHIC_ENABLE_LINECAP_FLAG
+    stroke.SetLineCap(LineCap::BUTT_CAP);
+#endif
+#if GRAPHIC_ENABLE_LINEJOIN_FLAG
+    stroke.SetLineJoin(LineJoin::ROUND_JOIN);
+#endif
+
+    /* the joins are part of the outline, so the rasterizer covers every pixel once */
+    RasterizerScanlineAntialias rasterizer;
+    rasterizer.ClipBox(mask.GetLeft(), mask.GetTop(), mask.GetRight() + 1, mask.GetBottom() + 1);
+    rasterizer.Reset();
+    rasterizer.AddPath(stroke);
+    if (gfxDstBuffer.mode != ARGB8888) {
+        BlendScanlines(gfxDstBuffer, rasterizer, mask, color, opacity);
+        return;
+    }
+
+    RenderBuffer renderBuffer;
+    renderBuffer.Attach(static_cast<uint8_t*>(gfxDstBuffer.virAddr), gfxDstBuffer.width, gfxDstBuffer.height,
+                        gfxDstBuffer.stride);
+    RenderPixfmtRgbaBlend pixFormat(renderBuffer);
+    RenderBase renBase(pixFormat);
+    renBase.ResetClipping(true);
+    renBase.ClipBox(mask.GetLeft(), mask.GetTop(), mask.GetRight(), mask.GetBottom());
+
+    Rgba8T strokeColor;
+    strokeColor.red = color.red;
+    strokeColor.green = color.green;
+    strokeColor.blue = color.blue;
+    strokeColor.alpha = opacity;
+    GeometryScanline scanline;
+    RenderScanlinesAntiAliasSolid(rasterizer, scanline, renBase, strokeColor);
+}
+
+void DrawCurve::BlendScanlines(BufferInfo& gfxDstBuffer, RasterizerScanlineAntialias& rasterizer, const Rect& mask,
+                               const ColorType& color, OpacityType opacity)
+{
+    if (!rasterizer.RewindScanlines()) {
+        return;
+    }
+    GeometryScanline scanline;
+    scanline.Reset(rasterizer.GetMinX(), rasterizer.GetMaxX());
+    DrawUtils* drawUtils = DrawUtils::GetInstance();
+    while (rasterizer.SweepScanline(scanline)) {
+        int16_t y = scanline.GetYLevel();
+        uint32_t numSpans = scanline.NumSpans();
+        GeometryScanline::ConstIterator span = scanline.Begin();
+        while (true) {
+            int16_t x = static_cast<int16_t>(span->x);
+            int16_t len = static_cast<int16_t>(span->spanLength);
+            if (len < 0) {
+                /* a solid span has one coverage for all its pixels */
+                Rect rect(x, y, x - len - 1, y);
+                drawUtils->DrawColorArea(gfxDstBuffer, rect, mask, color, *span->covers * opacity / OPA_OPAQUE);
+            } else {
+                drawUtils->DrawCoverageSpan(gfxDstBuffer, x, y, span->covers, len, mask, color, opacity);
+            }
+            if (--numSpans == 0) {
+                break;
+            }
+            ++span;
+        }
+    }
+}
+
+void DrawCurve::DrawSegments(BufferInfo& gfxDstBuffer, const Point* points, uint16_t pointNum, const Rect& mask,
+                             int16_t width, const ColorType& color, OpacityType opacity)
+{
+    for (uint16_t i = 1; i < pointNum; i++) {
+        const Point& start = points[i - 1];
+        const Point& end = points[i];
+        Rect rect(MATH_MIN(start.x, end.x) - width, MATH_MIN(start.y, end.y) - width,
+                  MATH_MAX(start.x, end.x) + width, MATH_MAX(start.y, end.y) + width);
+        if (!mask.IsIntersect(rect)) {
             continue;
         }
-        BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, prePoint, point, mask, width, color, opacity);
-        prePoint = point;
+        BaseGfxEngine::GetInstance()->DrawLine(gfxDstBuffer, start, end, mask, width, color, opacity);
+        if (i < pointNum - 1) {
+            DrawJoint(gfxDstBuffer, end, mask, width, color, opacity);
+        }
     }
 }
+
+void DrawCurve::DrawJoint(BufferInfo& gfxDstBuffer, const Point& center, const Rect& mask, int16_t width,
+                          const ColorType& color, OpacityType opacity)
+{
+    ArcInfo arcinfo = {{0}};
+    arcinfo.center = center;
+    arcinfo.imgPos = Point{0, 0};
+    arcinfo.radius = (width + 1) >> 1;
+    arcinfo.startAngle = 0;
+    arcinfo.endAngle = CIRCLE_IN_DEGREE;
+
+    Style style;
+    style.lineColor_ = color;
+    style.lineWidth_ = width;
+    style.lineOpa_ = OPA_OPAQUE;
+    BaseGfxEngine::GetInstance()->DrawArc(gfxDstBuffer, arcinfo, mask, style, opacity, CapType::CAP_NONE);
 }
+} // namespace OHOS
@@ -17,6 +17,8 @@
 #define GRAPHIC_LITE_DRAW_CURVE_H
 
 #include "gfx_utils/color.h"
+#include "gfx_utils/diagram/rasterizer/rasterizer_scanline_antialias.h"
+#include "gfx_utils/diagram/vertexprimitive/geometry_path_storage.h"
 #include "gfx_utils/geometry2d.h"
 #include "gfx_utils/graphic_buffer.h"
 
@@ -26,8 +28,45 @@ public:
     static void DrawCubicBezier(BufferInfo& gfxDstBuffer, const Point& start, const Point& control1,
                                 const Point& control2, const Point& end, const Rect& mask,
                                 int16_t width, const ColorType& color, OpacityType opacity);
+
+    /*
+     * Strokes the polyline through points with round joins. On ARGB8888, RGB888 and RGB565 buffers the whole polyline
+     * is rasterized as one anti-aliased shape, so every pixel is blended once even where segments meet. Other buffers
+     * draw a line per segment and a dot at every joint.
+     */
+    static void DrawPolyline(BufferInfo& gfxDstBuffer, const Point* points, uint16_t pointNum, const Rect& mask,
+                             int16_t width, const ColorType& color, OpacityType opacity);
+
+    /*
+     * Obtains the number of segments a cubic bezier curve is flattened to. The count grows with how much the control
+     * polygon bends, so that no point of the curve is more than FLATNESS away from the polyline.
+     */
+    static uint16_t GetSegmentNum(const Point& start, const Point& control1, const Point& control2, const Point& end);
+
+    static constexpr uint16_t MAX_SEGMENT_NUM = 256;
+
 private:
-    static constexpr uint16_t INTERPOLATION_RANGE = 1024;
+    /* largest distance between the curve and its polyline, in pixels */
+    static constexpr float FLATNESS = 0.25f;
+    /* moves integer coordinates to pixel centers, where DrawLine puts them too */
+    static constexpr float HALF_PIXEL = 0.5f;
+
+    static bool IsStrokeSupported(const BufferInfo& gfxDstBuffer)
+    {
+        ColorMode mode = gfxDstBuffer.mode;
+        return ((mode == ARGB8888) || (mode == RGB888) || (mode == RGB565)) && (gfxDstBuffer.virAddr != nullptr);
+    }
+    static void GetBezierPoint(const Point& start, const Point& control1, const Point& control2, const Point& end,
+                               float t, float& x, float& y);
+    static void StrokeVertices(BufferInfo& gfxDstBuffer, UICanvasVertices& vertices, const Rect& mask,
+                               int16_t width, const ColorType& color, OpacityType opacity);
+    /* blends the covered spans through DrawUtils, for the buffers the ARGB8888 pixel format cannot render to */
+    static void BlendScanlines(BufferInfo& gfxDstBuffer, RasterizerScanlineAntialias& rasterizer, const Rect& mask,
+                               const ColorType& color, OpacityType opacity);
+    static void DrawSegments(BufferInfo& gfxDstBuffer, const Point* points, uint16_t pointNum, const Rect& mask,
+                             int16_t width, const ColorType& color, OpacityType opacity);
+    static void DrawJoint(BufferInfo& gfxDstBuffer, const Point& center, const Rect& mask, int16_t width,
+                          const ColorType& color, OpacityType opacity);
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_DRAW_CURVE_H
@@ -15,25 +15,190 @@
 
 #include "draw/draw_image.h"
 
+#include "engines/gfx/gfx_engine_manager.h"
 #include "gfx_utils/color.h"
 #include "gfx_utils/graphic_log.h"
 #include "imgdecode/cache_manager.h"
+#include "imgdecode/image_load.h"
+#include "imgdecode/row_rle_image.h"
+#include "securec.h"
 
 namespace OHOS {
+namespace {
+/* shorter runs are cheaper to copy with the pixels around them than to fill */
+constexpr int16_t MIN_FILL_RUN = 8;
+
+/*
+ * Draws the rows of a COMPRESS_MODE_ROW_RLE_ALG image. The visible pixels of a row are decoded into a row buffer and
+ * blitted, except long runs of one pixel, which are filled without being decoded.
+ */
+class RowRleDrawer {
+public:
+    RowRleDrawer(BufferInfo& dst, const Rect& coords, const Rect& mask, const ImageInfo& img, OpacityType opa,
+                 const ClipMask* clipMask, uint8_t* buf)
+        : dst_(dst),
+          coords_(coords),
+          mask_(mask),
+          img_(img),
+          opa_(opa),
+          clipMask_(clipMask),
+          buf_(buf),
+          byteSize_(RowRleImage::GetByteSize(img.header.colorMode)),
+          y_(0),
+          pendingX_(0),
+          pendingLen_(0)
+    {
+    }
+
+    ~RowRleDrawer() {}
+
+    bool DrawRow(int16_t y, int16_t left, int16_t right)
+    {
+        const uint8_t* rowEnd = nullptr;
+        const uint8_t* pos = RowRleImage::GetRow(img_, y, rowEnd);
+        if (pos == nullptr) {
+            return false;
+        }
+        y_ = y;
+        pendingLen_ = 0;
+        int16_t x = 0;
+        RowRleImage::Packet packet;
+        while ((x <= right) && RowRleImage::NextPacket(pos, rowEnd, byteSize_, packet)) {
+            int16_t from = MATH_MAX(x, left);
+            int16_t to = MATH_MIN(x + packet.count - 1, right);
+            if (from <= to) {
+                if (!packet.run) {
+                    Append(from, packet.pixels + (from - x) * byteSize_, to - from + 1);
+                } else if ((clipMask_ != nullptr) || (to - from + 1 < MIN_FILL_RUN)) {
+                    for (int16_t i = from; i <= to; i++) {
+                        Append(i, packet.pixels, 1);
+                    }
+                } else {
+                    Flush();
+                    Fill(from, to, packet.pixels);
+                }
+            }
+            x += packet.count;
+        }
+        Flush();
+        return x > right;
+    }
+
+private:
+    void Append(int16_t x, const uint8_t* pixels, int16_t len)
+    {
+        if (pendingLen_ == 0) {
+            pendingX_ = x;
+        }
+        uint32_t size = static_cast<uint32_t>(len) * byteSize_;
+        if (memcpy_s(buf_ + pendingLen_ * byteSize_, size, pixels, size) == EOK) {
+            pendingLen_ += len;
+        }
+    }
+
+    void Flush()
+    {
+        if (pendingLen_ == 0) {
+            return;
+        }
+        int16_t left = coords_.GetLeft() + pendingX_;
+        int16_t top = coords_.GetTop() + y_;
+        Rect area(left, top, left + pendingLen_ - 1, top);
+        uint8_t colorMode = img_.header.colorMode;
+        DrawUtils::GetInstance()->DrawImage(dst_, area, mask_, buf_, opa_, DrawUtils::GetPxSizeByColorMode(colorMode),
+                                            static_cast<ColorMode>(colorMode), clipMask_, {pendingX_, y_});
+        pendingLen_ = 0;
+    }
+
+    void Fill(int16_t from, int16_t to, const uint8_t* pixel)
+    {
+        /* byte order of an uncompressed image: blue first, and a little-endian word for RGB565 */
+        uint8_t alpha = OPA_OPAQUE;
+        ColorType color;
+        if (img_.header.colorMode == RGB565) {
+            uint16_t value = pixel[0] | (pixel[1] << 8); // 8: high byte
+            color = Color::GetColorFromRGB((value >> 11) << 3, ((value >> 5) & 0x3F) << 2, // 11, 5, 3, 2: RGB565
+                                           (value & 0x1F) << 3);                             // 3: 5 bits to 8 bits
+        } else {
+            color = Color::GetColorFromRGB(pixel[2], pixel[1], pixel[0]); // 2: red, 1: green, 0: blue
+            if (img_.header.colorMode == ARGB8888) {
+                alpha = pixel[3]; // 3: alpha
+            }
+        }
+        OpacityType opa = DrawUtils::GetMixOpacity(opa_, alpha);
+        if (opa == OPA_TRANSPARENT) {
+            return;
+        }
+        int16_t top = coords_.GetTop() + y_;
+        Rect area(coords_.GetLeft() + from, top, coords_.GetLeft() + to, top);
+        if (area.Intersect(area, mask_)) {
+            /* the deferred queue merges the fills of a flat area across rows */
+            BaseGfxEngine::GetInstance()->SubmitFill(dst_, area, color, opa);
+        }
+    }
+
+    BufferInfo& dst_;
+    const Rect& coords_;
+    const Rect& mask_;
+    const ImageInfo& img_;
+    OpacityType opa_;
+    const ClipMask* clipMask_;
+    uint8_t* buf_;
+    uint8_t byteSize_;
+    int16_t y_;
+    int16_t pendingX_;
+    int16_t pendingLen_;
+};
+} // namespace
+
+void DrawImage::DrawRowRle(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask, const ImageInfo& img,
+                           OpacityType opa, const ClipMask* clipMask)
+{
+    Rect valid;
+    if (!valid.Intersect(coords, mask)) {
+        return;
+    }
+    /* the visible part in image coordinates */
+    int16_t left = valid.GetLeft() - coords.GetLeft();
+    int16_t right = MATH_MIN(valid.GetRight() - coords.GetLeft(), img.header.width - 1);
+    int16_t top = valid.GetTop() - coords.GetTop();
+    int16_t bottom = MATH_MIN(valid.GetBottom() - coords.GetTop(), img.header.height - 1);
+    uint8_t byteSize = RowRleImage::GetByteSize(img.header.colorMode);
+    if ((left > right) || (top > bottom) || (byteSize == 0)) {
+        return;
+    }
+    uint8_t* buf = static_cast<uint8_t*>(UIMalloc(static_cast<uint32_t>(right - left + 1) * byteSize));
+    if (buf == nullptr) {
+        return;
+    }
+    RowRleDrawer drawer(gfxDstBuffer, coords, mask, img, opa, clipMask, buf);
+    for (int16_t y = top; y <= bottom; y++) {
+        if (!drawer.DrawRow(y, left, right)) {
+            GRAPHIC_LOGE("DrawImage::DrawRowRle invalid row");
+            break;
+        }
+    }
+    UIFree(buf);
+}
+
 void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask,
-    const ImageInfo* img, const Style& style, uint8_t opaScale)
+    const ImageInfo* img, const Style& style, uint8_t opaScale, const ClipMask* clipMask)
 {
     if (img == nullptr) {
         return;
     }
     OpacityType opa = DrawUtils::GetMixOpacity(opaScale, style.imageOpa_);
+    if (img->header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+        DrawRowRle(gfxDstBuffer, coords, mask, *img, opa, clipMask);
+        return;
+    }
     uint8_t pxBitSize = DrawUtils::GetPxSizeByColorMode(img->header.colorMode);
     DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, coords, mask, img->data, opa, pxBitSize,
-                                        static_cast<ColorMode>(img->header.colorMode));
+                                        static_cast<ColorMode>(img->header.colorMode), clipMask);
 }
 
 void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask,
-    const char* path, const Style& style, uint8_t opaScale)
+    const char* path, const Style& style, uint8_t opaScale, const ClipMask* clipMask)
 {
     if (path == nullptr) {
         return;
@@ -46,9 +211,11 @@ void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const R
     }
 
     uint8_t pxBitSize = DrawUtils::GetPxSizeByColorMode(entry.GetImageInfo().header.colorMode);
-    if (entry.InCache()) {
+    if (entry.InCache() && (entry.GetImageInfo().header.compressMode == COMPRESS_MODE_ROW_RLE_ALG)) {
+        DrawRowRle(gfxDstBuffer, coords, mask, entry.GetImageInfo(), opa, clipMask);
+    } else if (entry.InCache()) {
         DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, coords, mask, entry.GetImgData(), opa, pxBitSize,
-                                            static_cast<ColorMode>(entry.GetImageInfo().header.colorMode));
+                                            static_cast<ColorMode>(entry.GetImageInfo().header.colorMode), clipMask);
     } else {
         Rect valid = coords;
         if (!valid.Intersect(valid, mask)) {
@@ -75,8 +242,10 @@ void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const R
                 UIFree(buf);
                 return;
             }
+            /* buf holds the row from start, so that pixel is at the clip mask origin */
             DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, line, mask, buf, opa, pxBitSize,
-                                                static_cast<ColorMode>(entry.GetImageInfo().header.colorMode));
+                                                static_cast<ColorMode>(entry.GetImageInfo().header.colorMode),
+                                                clipMask, start);
             line.SetTop(line.GetTop() + 1);
             line.SetBottom(line.GetBottom() + 1);
             start.y++;
@@ -31,10 +31,14 @@ public:
     ~DrawImage() {}
 
     static void DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask,
-        const ImageInfo* img, const Style& style, uint8_t opaScale);
+        const ImageInfo* img, const Style& style, uint8_t opaScale, const ClipMask* clipMask = nullptr);
 
     static void DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask,
-        const char* path, const Style& style, uint8_t opaScale);
+        const char* path, const Style& style, uint8_t opaScale, const ClipMask* clipMask = nullptr);
+
+    /* Draws an image in COMPRESS_MODE_ROW_RLE_ALG, decoding only the visible part. */
+    static void DrawRowRle(BufferInfo& gfxDstBuffer, const Rect& coords, const Rect& mask, const ImageInfo& img,
+        OpacityType opa, const ClipMask* clipMask = nullptr);
 };
 } // namespace OHOS
 
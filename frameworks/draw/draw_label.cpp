@@ -17,6 +17,7 @@
 #include <cstdio>
 #include "common/typed_text.h"
 #include "draw/draw_utils.h"
+#include "draw/rotated_glyph_cache.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "font/ui_font.h"
 #include "font/ui_font_header.h"
@@ -213,6 +214,10 @@ void DrawLabel::DrawLetterWithRotate(BufferInfo& gfxDstBuffer,
                                      const ColorType& color,
                                      OpacityType opaScale)
 {
+    if (RotatedGlyphCache::GetInstance().IsEnabled() &&
+        DrawRotatedGlyph(gfxDstBuffer, mask, fontId, letter, pos, rotateAngle, color, opaScale)) {
+        return;
+    }
     UIFont* fontEngine = UIFont::GetInstance();
     FontHeader head;
     GlyphNode node;
@@ -256,6 +261,63 @@ void DrawLabel::DrawLetterWithRotate(BufferInfo& gfxDstBuffer,
                                                 letterTranDataInfo);
 }
 
+bool DrawLabel::DrawRotatedGlyph(BufferInfo& gfxDstBuffer,
+                                 const Rect& mask,
+                                 uint8_t fontId,
+                                 uint32_t letter,
+                                 const Point& pos,
+                                 int16_t rotateAngle,
+                                 const ColorType& color,
+                                 OpacityType opaScale)
+{
+    UIFont* fontEngine = UIFont::GetInstance();
+    FontHeader head;
+    if (fontEngine->GetCurrentFontHeader(head) != 0) {
+        return false;
+    }
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    RotatedGlyphKey key = {letter, fontId, head.fontHeight, RotatedGlyphCache::NormalizeAngle(rotateAngle)};
+    const RotatedGlyph* glyph = cache.Get(key);
+    if (glyph == nullptr) {
+        GlyphNode node;
+#if ENABLE_VECTOR_FONT
+        node.textStyle = TEXT_STYLE_NORMAL;
+#endif
+        const uint8_t* fontMap = fontEngine->GetBitmap(letter, node, 0);
+        if (fontMap == nullptr) {
+            return false;
+        }
+        if ((node.cols == 0) || (node.rows == 0)) {
+            return true;
+        }
+        /* the rotated outline is sharper than the upright bitmap turned around, bitmap fonts only have the latter */
+        int16_t uprightTop = head.ascender - node.top;
+        RotatedGlyph rotated = {};
+        rotated.data = fontEngine->GetRotatedBitmap(letter, key.angle, head.ascender, node);
+        if (rotated.data != nullptr) {
+            rotated.left = node.left;
+            rotated.top = head.ascender - node.top;
+            rotated.width = node.cols;
+            rotated.height = node.rows;
+        } else if (!RotatedGlyphCache::Rotate(fontMap, fontEngine->GetFontWeight(fontId), node.cols, node.rows,
+                                              node.left, uprightTop, key.angle, rotated)) {
+            return false;
+        }
+        glyph = cache.Put(key, rotated);
+        if (glyph == nullptr) {
+            return false;
+        }
+    }
+    Rect rect(pos.x + glyph->left, pos.y + glyph->top, pos.x + glyph->left + glyph->width - 1,
+              pos.y + glyph->top + glyph->height - 1);
+    Rect subRect;
+    if (subRect.Intersect(rect, mask)) {
+        BaseGfxEngine::GetInstance()->DrawLetter(gfxDstBuffer, glyph->data, rect, subRect, FONT_WEIGHT_8, color,
+                                                 opaScale);
+    }
+    return true;
+}
+
 
 void DrawLabel::GetLineBackgroundColor(uint16_t letterIndex, List<LineBackgroundColor>* linebackgroundColor,
                                        bool& havelinebackground, ColorType& linebgColor)
@@ -41,6 +41,15 @@ public:
                                      const ColorType& color,
                                      OpacityType opaScale);
 private:
+    /* Draws the letter from RotatedGlyphCache, returns false if it has to be transformed from the upright bitmap. */
+    static bool DrawRotatedGlyph(BufferInfo& gfxDstBuffer,
+                                 const Rect& mask,
+                                 uint8_t fontId,
+                                 uint32_t letter,
+                                 const Point& pos,
+                                 int16_t rotateAngle,
+                                 const ColorType& color,
+                                 OpacityType opaScale);
     static uint8_t GetLineMaxLetterSize(const char* text, uint16_t lineLength, uint8_t fontSize,
                                         uint16_t letterIndex, SizeSpan* sizeSpans);
     static void GetLineBackgroundColor(uint16_t letterIndex, List<LineBackgroundColor>* linebackgroundColor,
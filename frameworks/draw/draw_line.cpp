@@ -56,6 +56,145 @@ namespace OHOS {
         SWAP_POINTS((x1), (x2), (y1), (y2));                 \
     }
 
+/*
+ * Collects the anti-aliased pixels of a line into runs along rows and blends each run by one DrawCoverageSpan call.
+ * The runs are disjoint, and a run is flushed before a later pixel or fill touches it, so every pixel is blended in
+ * the same order as one by one.
+ */
+class DrawLine::SpanWriter : public HeapBase {
+public:
+    SpanWriter(BufferInfo& gfxDstBuffer, const Rect& mask, const ColorType& color, OpacityType opacity)
+        : gfxDstBuffer_(gfxDstBuffer), mask_(mask), color_(color), opacity_(opacity), useCount_(0)
+    {
+        for (Span& span : spans_) {
+            span.begin = span.end = 0;
+        }
+    }
+
+    ~SpanWriter()
+    {
+        Flush();
+    }
+
+    void Plot(int16_t x, int16_t y, uint8_t weight);
+    void Fill(const Rect& rect);
+    void Flush();
+
+private:
+    static constexpr uint8_t SPAN_NUM = 3; // 3: the rows a thin line of width 2 touches at once
+    static constexpr int16_t SPAN_BUFFER_LEN = 128;
+
+    struct Span {
+        int16_t left; // x of coverage[begin]
+        int16_t y;
+        int16_t begin;
+        int16_t end; // empty if begin == end
+        uint32_t lastUse;
+        uint8_t coverage[SPAN_BUFFER_LEN];
+    };
+
+    static bool IsEmpty(const Span& span)
+    {
+        return span.begin == span.end;
+    }
+
+    void FlushSpan(Span& span);
+
+    BufferInfo& gfxDstBuffer_;
+    const Rect& mask_;
+    const ColorType& color_;
+    OpacityType opacity_;
+    uint32_t useCount_;
+    Span spans_[SPAN_NUM];
+};
+
+bool DrawLine::spanEnable_ = true;
+uint32_t DrawLine::blendCount_ = 0;
+
+void DrawLine::SpanWriter::Plot(int16_t x, int16_t y, uint8_t weight)
+{
+    if (!spanEnable_) {
+        blendCount_++;
+        DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer_, x, y, mask_, color_, opacity_, weight);
+        return;
+    }
+    if ((x < mask_.GetLeft()) || (x > mask_.GetRight()) || (y < mask_.GetTop()) || (y > mask_.GetBottom())) {
+        return;
+    }
+    /* a pixel blended again must see the pending blend of the run holding it */
+    for (Span& span : spans_) {
+        if (!IsEmpty(span) && (span.y == y) && (x >= span.left) && (x < span.left + span.end - span.begin)) {
+            FlushSpan(span);
+        }
+    }
+    Span* target = nullptr;
+    for (Span& span : spans_) {
+        if (IsEmpty(span)) {
+            if ((target == nullptr) || !IsEmpty(*target)) {
+                target = &span;
+            }
+            continue;
+        }
+        if (span.y == y) {
+            if ((x == span.left + span.end - span.begin) && (span.end < SPAN_BUFFER_LEN)) {
+                span.coverage[span.end++] = weight;
+                span.lastUse = ++useCount_;
+                return;
+            }
+            if ((x == span.left - 1) && (span.begin > 0)) {
+                span.coverage[--span.begin] = weight;
+                span.left = x;
+                span.lastUse = ++useCount_;
+                return;
+            }
+        }
+        if ((target == nullptr) || (!IsEmpty(*target) && (span.lastUse < target->lastUse))) {
+            target = &span;
+        }
+    }
+    if (!IsEmpty(*target)) {
+        FlushSpan(*target);
+    }
+    /* start in the middle, the run may grow either way */
+    target->begin = target->end = SPAN_BUFFER_LEN / 2; // 2: half
+    target->coverage[target->end++] = weight;
+    target->left = x;
+    target->y = y;
+    target->lastUse = ++useCount_;
+}
+
+void DrawLine::SpanWriter::Fill(const Rect& rect)
+{
+    for (Span& span : spans_) {
+        if (IsEmpty(span)) {
+            continue;
+        }
+        Rect spanRect(span.left, span.y, span.left + span.end - span.begin - 1, span.y);
+        if (spanRect.IsIntersect(rect)) {
+            FlushSpan(span);
+        }
+    }
+    blendCount_++;
+    DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer_, rect, mask_, color_, opacity_);
+}
+
+void DrawLine::SpanWriter::Flush()
+{
+    for (Span& span : spans_) {
+        if (!IsEmpty(span)) {
+            FlushSpan(span);
+        }
+    }
+}
+
+void DrawLine::SpanWriter::FlushSpan(Span& span)
+{
+    blendCount_++;
+    DrawUtils::GetInstance()->DrawCoverageSpan(gfxDstBuffer_, span.left, span.y, span.coverage + span.begin,
+                                               span.end - span.begin, mask_, color_, opacity_);
+    span.begin = span.end = 0;
+}
+
 void DrawLine::Draw(BufferInfo& gfxDstBuffer,
                     const Point& start,
                     const Point& end,
@@ -88,7 +227,8 @@ void DrawLine::Draw(BufferInfo& gfxDstBuffer,
     } else if (start.x == end.x) {
         DrawVerticalLine(gfxDstBuffer, start, end, mask, width, color, opacity);
     } else {
-        DrawWuLine(gfxDstBuffer, start, end, mask, width, color, opacity);
+        SpanWriter writer(gfxDstBuffer, mask, color, opacity);
+        DrawWuLine(writer, start, end, width);
     }
 }
 
@@ -141,11 +281,10 @@ void DrawLine::DrawHorizontalLine(BufferInfo& gfxDstBuffer, const Point& start,
     DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
 }
 
-void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end,
-    const Rect& mask, int16_t width, const ColorType& color, OpacityType opacity)
+void DrawLine::DrawWuLine(SpanWriter& writer, const Point& start, const Point& end, int16_t width)
 {
     if (width <= 2) { // 2 : thin line width
-        DrawThinWuLine(gfxDstBuffer, start, end, mask, width, color, opacity);
+        DrawThinWuLine(writer, start, end, width);
         return;
     }
 
@@ -181,7 +320,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
     // width is longer than distance between start point and end point, need swap direction of line.
     if (dx * dx + dy * dy < width * width) {
         if ((dx == 1) && (dy == 1)) {
-            DrawThinWuLine(gfxDstBuffer, { x0Int, y0Int }, { x3Int, y3Int }, mask, 2, color, opacity); // 2 : line width
+            DrawThinWuLine(writer, { x0Int, y0Int }, { x3Int, y3Int }, 2); // 2 : line width
             return;
         }
         dx = MATH_ABS(x0Int - x1Int);
@@ -247,7 +386,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
             dx = MATH_ABS(x1Int - x0Int);
             sx = x0Int;
             sy = y0Int;
-            DrawUtils::GetInstance()->DrawPixel(gfxDstBuffer, x0Int, y0Int, mask, color, opacity);
+            writer.Plot(x0Int, y0Int, OPA_OPAQUE);
             while (--dx) {
                 accTemp1 = acc1;
                 acc1 += adj1;
@@ -258,8 +397,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                     sy++;
                 }
                 sx -= dir;
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy, mask, color, opacity,
-                    (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, sy, (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
             }
             if (sy - y0Int < MAX_LINE_WIDTH) {
                 endPoints0[sy - y0Int] = sx - dir;
@@ -270,7 +408,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
             dx = MATH_ABS(x3Int - x2Int);
             sy = y3Int;
             sx = x3Int;
-            DrawUtils::GetInstance()->DrawPixel(gfxDstBuffer, x3Int, y3Int, mask, color, opacity);
+            writer.Plot(x3Int, y3Int, OPA_OPAQUE);
             while (--dx) {
                 accTemp1 = acc1;
                 acc1 += adj1;
@@ -281,8 +419,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                     sy--;
                 }
                 sx += dir;
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy, mask, color, opacity,
-                                                          (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, sy, (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
             }
             if (temp1 < MAX_LINE_WIDTH) {
                 endPoints1[temp1++] = sx + dir;
@@ -290,9 +427,9 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
         } else {
             /* If y0 is equal to y1, draw two horizontal lines as the top line and bottom line. */
             rect.SetRect(MATH_MIN(x0Int, x1Int), y0Int, MATH_MAX(x0Int, x1Int), y1Int);
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
             rect.SetRect(MATH_MIN(x2Int, x3Int), y3Int, MATH_MAX(x2Int, x3Int), y2Int);
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
         }
 
         sx = x0Int;
@@ -305,8 +442,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
         while (--dy) {
             if (sy <= y1Int) {
                 INCREASE_ACC(acc0, accTemp0, adj0, sx, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx + dir, sy, mask,
-                                                          color, opacity, acc0 >> SHIFT_8);
+                writer.Plot(sx + dir, sy, acc0 >> SHIFT_8);
                 if (temp0 < MAX_LINE_WIDTH) {
                     edge0 = endPoints0[temp0++];
                 }
@@ -314,16 +450,13 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
             } else if (sy < y2Int) {
                 INCREASE_ACC(acc0, accTemp0, adj0, sx, dir);
                 INCREASE_ACC(acc2, accTemp2, adj0, sxTemp, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx + dir, sy, mask,
-                                                          color, opacity, acc0 >> SHIFT_8);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sxTemp, sy, mask, color, opacity,
-                                                          (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx + dir, sy, acc0 >> SHIFT_8);
+                writer.Plot(sxTemp, sy, (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
                 edge0 = sxTemp + dir;
                 edge1 = sx;
             } else if (sy < y3Int) {
                 INCREASE_ACC(acc2, accTemp2, adj0, sxTemp, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sxTemp, sy, mask, color, opacity,
-                                                          (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sxTemp, sy, (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
                 edge0 = sxTemp + dir;
                 if (temp1 > 0) {
                     edge1 = endPoints1[--temp1];
@@ -333,7 +466,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                 SWAP_INT16(edge0, edge1);
             }
             rect.SetRect(edge0, sy, edge1, sy);
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
             sy++;
         }
     } else {
@@ -345,7 +478,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
             dy = MATH_ABS(y1Int - y0Int);
             sx = x0Int;
             sy = y0Int;
-            DrawUtils::GetInstance()->DrawPixel(gfxDstBuffer, sx, sy, mask, color, opacity);
+            writer.Plot(sx, sy, OPA_OPAQUE);
             while (--dy) {
                 accTemp1 = acc1;
                 acc1 += adj1;
@@ -356,8 +489,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                     sx--;
                 }
                 sy -= dir;
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy, mask, color, opacity,
-                                                          (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, sy, (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
             }
             if (x0Int - sx < MAX_LINE_WIDTH) {
                 endPoints0[x0Int - sx] = sy - dir;
@@ -378,19 +510,18 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                     sx++;
                 }
                 sy += dir;
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy, mask, color, opacity,
-                                                          (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, sy, (acc1 >> SHIFT_8) ^ OPA_OPAQUE);
             }
-            DrawUtils::GetInstance()->DrawPixel(gfxDstBuffer, x3Int, y3Int, mask, color, opacity);
+            writer.Plot(x3Int, y3Int, OPA_OPAQUE);
             if (temp1 < MAX_LINE_WIDTH) {
                 endPoints1[temp1++] = sy + dir;
             }
         } else {
             /* If x0 is equal to x1, draw two vertical lines as the top line and bottom line. */
             rect.SetRect(x1Int, MATH_MIN(y0Int, y1Int), x0Int, MATH_MAX(y0Int, y1Int));
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
             rect.SetRect(x3Int, MATH_MIN(y2Int, y3Int), x2Int, MATH_MAX(y2Int, y3Int));
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
         }
 
         sx = x0Int - 1;
@@ -403,8 +534,7 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
         while (--dx) {
             if (sx >= x1Int) {
                 INCREASE_ACC(acc0, accTemp0, adj0, sy, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy + dir, mask,
-                                                          color, opacity, acc0 >> SHIFT_8);
+                writer.Plot(sx, sy + dir, acc0 >> SHIFT_8);
                 if (temp0 < MAX_LINE_WIDTH) {
                     edge0 = endPoints0[temp0++];
                 }
@@ -412,16 +542,13 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
             } else if (sx > x2Int) {
                 INCREASE_ACC(acc0, accTemp0, adj0, sy, dir);
                 INCREASE_ACC(acc2, accTemp2, adj0, syTemp, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, sy + dir, mask,
-                                                          color, opacity, acc0 >> SHIFT_8);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, syTemp, mask, color,
-                                                          opacity, (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, sy + dir, acc0 >> SHIFT_8);
+                writer.Plot(sx, syTemp, (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
                 edge0 = syTemp + dir;
                 edge1 = sy;
             } else if (sx > x3Int) {
                 INCREASE_ACC(acc2, accTemp2, adj0, syTemp, dir);
-                DrawUtils::GetInstance()->DrawPixelInLine(gfxDstBuffer, sx, syTemp, mask, color, opacity,
-                                                          (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
+                writer.Plot(sx, syTemp, (acc2 >> SHIFT_8) ^ OPA_OPAQUE);
                 edge0 = syTemp + dir;
                 if (temp1 > 0) {
                     edge1 = endPoints1[--temp1];
@@ -431,14 +558,13 @@ void DrawLine::DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Po
                 SWAP_INT16(edge0, edge1);
             }
             rect.SetRect(sx, edge0, sx, edge1);
-            DrawUtils::GetInstance()->DrawColorArea(gfxDstBuffer, rect, mask, color, opacity);
+            writer.Fill(rect);
             sx--;
         }
     }
 }
 
-void DrawLine::DrawThinWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end,
-    const Rect& mask, int16_t width, const ColorType& color, OpacityType opacity)
+void DrawLine::DrawThinWuLine(SpanWriter& writer, const Point& start, const Point& end, int16_t width)
 {
     int16_t sx = start.x;
     int16_t sy = start.y;
@@ -456,12 +582,14 @@ void DrawLine::DrawThinWuLine(BufferInfo& gfxDstBuffer, const Point& start, cons
         while (dy--) {
             INCREASE_ACC(acc, accTemp, adj, sx, dir);
             sy++;
+            uint8_t weight = acc >> SHIFT_8;
             if (width == 1) {
-                DrawUtils::GetInstance()->DrawAdjPixelInLine(gfxDstBuffer, sx, sy, sx + dir, sy, mask,
-                                                             color, opacity, acc >> SHIFT_8);
+                writer.Plot(sx, sy, weight ^ OPA_OPAQUE);
+                writer.Plot(sx + dir, sy, weight);
             } else {
-                DrawUtils::GetInstance()->DrawVerPixelInLine(gfxDstBuffer, sx, sy, dir, mask,
-                                                             color, opacity, acc >> SHIFT_8);
+                writer.Plot(sx + dir, sy, weight);
+                writer.Plot(sx, sy, OPA_OPAQUE);
+                writer.Plot(sx - dir, sy, weight ^ OPA_OPAQUE);
             }
         }
     } else {
@@ -469,12 +597,14 @@ void DrawLine::DrawThinWuLine(BufferInfo& gfxDstBuffer, const Point& start, cons
         while (dx--) {
             INCREASE_ACC(acc, accTemp, adj, sy, dir);
             sx--;
+            uint8_t weight = acc >> SHIFT_8;
             if (width == 1) {
-                DrawUtils::GetInstance()->DrawAdjPixelInLine(gfxDstBuffer, sx, sy, sx, sy + dir, mask,
-                                                             color, opacity, acc >> SHIFT_8);
+                writer.Plot(sx, sy, weight ^ OPA_OPAQUE);
+                writer.Plot(sx, sy + dir, weight);
             } else {
-                DrawUtils::GetInstance()->DrawHorPixelInLine(gfxDstBuffer, sx, sy, dir, mask,
-                                                             color, opacity, acc >> SHIFT_8);
+                writer.Plot(sx, sy + dir, weight);
+                writer.Plot(sx, sy, OPA_OPAQUE);
+                writer.Plot(sx, sy - dir, weight ^ OPA_OPAQUE);
             }
         }
     }
@@ -26,18 +26,38 @@ public:
     static void Draw(BufferInfo& gfxDstBuffer, const Point& start, const Point& end, const Rect& mask,
         int16_t width, const ColorType& color, OpacityType opacity);
 
+    /* Anti-aliased pixels are blended in row spans by default, and one by one if disabled. */
+    static void SetSpanEnable(bool enable)
+    {
+        spanEnable_ = enable;
+    }
+
+    static bool IsSpanEnable()
+    {
+        return spanEnable_;
+    }
+
+    /* Obtains the number of blends issued for anti-aliased lines so far, a span blended at once counts as one. */
+    static uint32_t GetBlendCount()
+    {
+        return blendCount_;
+    }
+
 private:
+    class SpanWriter;
+
     static void DrawVerticalLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end,
         const Rect& mask, int16_t width, const ColorType& color, OpacityType opacity);
 
     static void DrawHorizontalLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end,
         const Rect& mask, int16_t width, const ColorType& color, OpacityType opacity);
 
-    static void DrawWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end,
-        const Rect& mask, int16_t width, const ColorType& color, OpacityType opacity);
+    static void DrawWuLine(SpanWriter& writer, const Point& start, const Point& end, int16_t width);
 
-    static void DrawThinWuLine(BufferInfo& gfxDstBuffer, const Point& start, const Point& end, const Rect& mask,
-        int16_t width, const ColorType& color, OpacityType opacity);
+    static void DrawThinWuLine(SpanWriter& writer, const Point& start, const Point& end, int16_t width);
+
+    static bool spanEnable_;
+    static uint32_t blendCount_;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_DRAW_LINE_H
@@ -15,6 +15,7 @@
 
 #include "draw/draw_utils.h"
 
+#include "draw/clip_utils.h"
 #include "draw/draw_triangle.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "font/ui_font.h"
@@ -199,7 +200,7 @@ void DrawUtils::DrawColorArea(BufferInfo& gfxDstBuffer,
         return;
     }
 
-    BaseGfxEngine::GetInstance()->Fill(gfxDstBuffer, maskedArea, color, opa);
+    BaseGfxEngine::GetInstance()->SubmitFill(gfxDstBuffer, maskedArea, color, opa);
 }
 
 uint8_t DrawUtils::GetPxSizeByColorMode(uint8_t colorMode)
@@ -418,7 +419,7 @@ void DrawUtils::DrawLetter(BufferInfo& gfxDstBuffer,
             return;
     }
 
-    uint8_t letterWidthInByte = (fontRect.GetWidth() * fontWeight) >> SHIFT_3;
+    uint16_t letterWidthInByte = (fontRect.GetWidth() * fontWeight) >> SHIFT_3;
     if ((fontRect.GetWidth() * fontWeight) & 0x7) { // 0x7 : less than 1 byte is counted as 1 byte
         letterWidthInByte++;
     }
@@ -474,7 +475,9 @@ void DrawUtils::DrawImage(BufferInfo& gfxDstBuffer,
                           const uint8_t* image,
                           OpacityType opa,
                           uint8_t pxBitSize,
-                          ColorMode colorMode) const
+                          ColorMode colorMode,
+                          const ClipMask* clipMask,
+                          const Point& clipOffset) const
 {
     if (image == nullptr) {
         return;
@@ -500,10 +503,106 @@ void DrawUtils::DrawImage(BufferInfo& gfxDstBuffer,
     src.mode = colorMode;
     src.color = 0;
 
+    if (clipMask != nullptr) {
+        Point clipPos = {static_cast<int16_t>(clipOffset.x + imageX), static_cast<int16_t>(clipOffset.y + imageY)};
+        DrawClippedImage(gfxDstBuffer, src, maskedArea, opa, *clipMask, clipPos);
+        return;
+    }
+
     Point dstPos = {maskedArea.GetLeft(), maskedArea.GetTop()};
     BlendOption blendOption;
     blendOption.opacity = opa;
-    BaseGfxEngine::GetInstance()->Blit(gfxDstBuffer, dstPos, src, maskedArea, blendOption);
+    BaseGfxEngine::GetInstance()->SubmitBlit(gfxDstBuffer, dstPos, src, maskedArea, blendOption);
+}
+
+void DrawUtils::DrawClippedImage(BufferInfo& gfxDstBuffer,
+                                 const BufferInfo& src,
+                                 const Rect& maskedArea,
+                                 OpacityType opa,
+                                 const ClipMask& clipMask,
+                                 const Point& clipPos) const
+{
+    /* clipPos is the pixel of the clip mask, and src.rect the pixel of the image, at the top left of maskedArea */
+    BufferInfo span = src;
+    int16_t toClipX = clipPos.x - maskedArea.GetLeft();
+    int16_t toClipY = clipPos.y - maskedArea.GetTop();
+    int16_t toImageX = src.rect.GetLeft() - maskedArea.GetLeft();
+    int16_t imageY = src.rect.GetTop();
+    /* the edge runs are blended in place, so the deferred blits are drawn first to keep the order */
+    BaseGfxEngine::GetInstance()->PauseDeferred();
+    for (int16_t y = maskedArea.GetTop(); y <= maskedArea.GetBottom(); y++, imageY++) {
+        uint32_t spanNum;
+        const ClipMask::Span* clipSpan = clipMask.GetRowSpans(y + toClipY, spanNum);
+        for (; spanNum > 0; spanNum--, clipSpan++) {
+            int16_t spanLeft = clipSpan->x - toClipX;
+            if (spanLeft > maskedArea.GetRight()) {
+                break;
+            }
+            int16_t left = MATH_MAX(spanLeft, maskedArea.GetLeft());
+            int16_t right = MATH_MIN(static_cast<int16_t>(spanLeft + clipSpan->length - 1), maskedArea.GetRight());
+            if (clipSpan->covers == nullptr) {
+                /* fully covered spans are blended at once */
+                OpacityType spanOpa = GetMixOpacity(opa, clipSpan->cover);
+                if ((left <= right) && (spanOpa != OPA_TRANSPARENT)) {
+                    BlitImageSpan(gfxDstBuffer, span, {static_cast<int16_t>(left + toImageX), imageY}, left, right,
+                                  y, spanOpa);
+                }
+                continue;
+            }
+            if (left <= right) {
+                BlendImageCoverageSpan(gfxDstBuffer, src, {static_cast<int16_t>(left + toImageX), imageY}, left,
+                                       right, y, clipSpan->covers + (left - spanLeft), opa);
+            }
+        }
+    }
+    BaseGfxEngine::GetInstance()->ResumeDeferred();
+}
+
+void DrawUtils::BlendImageCoverageSpan(BufferInfo& gfxDstBuffer,
+                                       const BufferInfo& src,
+                                       const Point& imagePos,
+                                       int16_t left,
+                                       int16_t right,
+                                       int16_t y,
+                                       const uint8_t* covers,
+                                       OpacityType opa) const
+{
+    int16_t begin = left;
+    if ((gfxDstBuffer.virAddr == nullptr) || (src.virAddr == nullptr) ||
+        !ClipToRowBounds(gfxDstBuffer.virAddr, y, begin, right)) {
+        return;
+    }
+    ColorMode destMode = gfxDstBuffer.mode;
+    ColorMode srcMode = src.mode;
+    uint8_t destByteSize = GetByteSizeByColorMode(destMode);
+    uint8_t srcByteSize = GetByteSizeByColorMode(srcMode);
+    uint8_t* dest = static_cast<uint8_t*>(gfxDstBuffer.virAddr) + gfxDstBuffer.stride * y + destByteSize * begin;
+    uint8_t* srcBuf = static_cast<uint8_t*>(src.virAddr) + src.stride * imagePos.y +
+                      srcByteSize * (imagePos.x + begin - left);
+    covers += begin - left;
+    for (int16_t x = begin; x <= right; x++, covers++) {
+        OpacityType pixelOpa = GetMixOpacity(opa, *covers);
+        if (pixelOpa != OPA_TRANSPARENT) {
+            COLOR_FILL_BLEND(dest, destMode, srcBuf, srcMode, pixelOpa);
+        }
+        dest += destByteSize;
+        srcBuf += srcByteSize;
+    }
+}
+
+void DrawUtils::BlitImageSpan(BufferInfo& gfxDstBuffer,
+                              BufferInfo& src,
+                              const Point& imagePos,
+                              int16_t left,
+                              int16_t right,
+                              int16_t y,
+                              OpacityType opa)
+{
+    src.rect = {imagePos.x, imagePos.y, static_cast<int16_t>(imagePos.x + right - left), imagePos.y};
+    Rect subRect(left, y, right, y);
+    BlendOption blendOption;
+    blendOption.opacity = opa;
+    BaseGfxEngine::GetInstance()->SubmitBlit(gfxDstBuffer, {left, y}, src, subRect, blendOption);
 }
 
 void DrawUtils::FillAreaWithSoftWare(BufferInfo& gfxDstBuffer,
@@ -532,6 +631,10 @@ void DrawUtils::FillAreaWithSoftWare(BufferInfo& gfxDstBuffer,
     if ((fillColor.alpha == OPA_TRANSPARENT) || (opa == OPA_TRANSPARENT)) {
         return;
     }
+    if (IsRowBounded(gfxDstBuffer.virAddr)) {
+        FillBoundedArea(gfxDstBuffer, fillArea, fillColor, opa);
+        return;
+    }
     /* cover mode */
     if ((opa == OPA_OPAQUE) && (fillColor.alpha == OPA_OPAQUE)) {
         for (int16_t col = 0; col < width; ++col) {
@@ -597,6 +700,96 @@ void DrawUtils::FillAreaWithSoftWare(BufferInfo& gfxDstBuffer,
     }
 }
 
+bool DrawUtils::ClipToRowBounds(const void* virAddr, int16_t y, int16_t& left, int16_t& right) const
+{
+    if (IsRowBounded(virAddr) && (y >= 0) && (y < rowBoundNum_)) {
+        left = MATH_MAX(left, rowBounds_[y * 2]);      // 2: left and right bound of each row
+        right = MATH_MIN(right, rowBounds_[y * 2 + 1]); // 2: left and right bound of each row
+    }
+    return left <= right;
+}
+
+void DrawUtils::FillBoundedArea(BufferInfo& gfxDstBuffer,
+                                const Rect& fillArea,
+                                Color32 fillColor,
+                                OpacityType opa) const
+{
+    ColorMode mode = gfxDstBuffer.mode;
+    uint8_t destByteSize = GetByteSizeByColorMode(mode);
+    int32_t destWidth = gfxDstBuffer.width;
+    uint8_t* buffer = static_cast<uint8_t*>(gfxDstBuffer.virAddr);
+    bool cover = (opa == OPA_OPAQUE) && (fillColor.alpha == OPA_OPAQUE);
+
+    /* in cover mode the widest row is filled first, the other rows copy the part they share with it */
+    const uint8_t* proto = nullptr;
+    int16_t protoY = 0;
+    int16_t protoLeft = 0;
+    int16_t protoRight = -1;
+    if (cover) {
+        for (int16_t y = fillArea.GetTop(); y <= fillArea.GetBottom(); y++) {
+            int16_t left = fillArea.GetLeft();
+            int16_t right = fillArea.GetRight();
+            if (ClipToRowBounds(buffer, y, left, right) && (right - left > protoRight - protoLeft)) {
+                protoY = y;
+                protoLeft = left;
+                protoRight = right;
+            }
+        }
+        if (protoLeft > protoRight) {
+            return;
+        }
+        uint8_t* dest = buffer + (protoY * destWidth + protoLeft) * destByteSize;
+        proto = dest;
+        for (int16_t x = protoLeft; x <= protoRight; x++) {
+            COLOR_FILL_COVER(dest, mode, fillColor.red, fillColor.green, fillColor.blue, ARGB8888);
+            dest += destByteSize;
+        }
+    }
+#ifdef ARM_NEON_OPT
+    NeonBlendPipeLine pipeLine;
+    if (!cover) {
+        pipeLine.Construct(mode, ARGB8888, &fillColor, opa);
+    }
+#endif
+
+    for (int16_t y = fillArea.GetTop(); y <= fillArea.GetBottom(); y++) {
+        int16_t left = fillArea.GetLeft();
+        int16_t right = fillArea.GetRight();
+        if (!ClipToRowBounds(buffer, y, left, right) || ((proto != nullptr) && (y == protoY))) {
+            continue;
+        }
+        uint8_t* dest = buffer + (y * destWidth + left) * destByteSize;
+        if ((proto != nullptr) && (left >= protoLeft) && (right <= protoRight)) {
+            int32_t size = (right - left + 1) * destByteSize;
+            if (memcpy_s(dest, size, proto + (left - protoLeft) * destByteSize, size) != EOK) {
+                GRAPHIC_LOGE("DrawUtils::FillBoundedArea memcpy failed!\n");
+                return;
+            }
+            continue;
+        }
+        if (cover) {
+            for (int16_t x = left; x <= right; x++) {
+                COLOR_FILL_COVER(dest, mode, fillColor.red, fillColor.green, fillColor.blue, ARGB8888);
+                dest += destByteSize;
+            }
+            continue;
+        }
+        int16_t width = right - left + 1;
+#ifdef ARM_NEON_OPT
+        int16_t step = NEON_STEP_8 * destByteSize;
+        while (width >= NEON_STEP_8) {
+            pipeLine.Invoke(dest);
+            dest += step;
+            width -= NEON_STEP_8;
+        }
+#endif
+        for (int16_t i = 0; i < width; i++) {
+            COLOR_FILL_BLEND(dest, mode, &fillColor, ARGB8888, opa);
+            dest += destByteSize;
+        }
+    }
+}
+
 #ifdef ARM_NEON_OPT
 void DrawUtils::BlendLerpPix(uint8_t* color, uint8_t red, uint8_t green, uint8_t blue,
                              uint8_t alpha, uint8_t cover)
@@ -696,19 +889,23 @@ void DrawUtils::BlendWithSoftWare(const uint8_t* src1,
         int16_t dstStep = NEON_STEP_8 * GetByteSizeByColorMode(destMode);
         int16_t srcStep = NEON_STEP_8 * GetByteSizeByColorMode(srcMode);
         for (uint32_t row = 0; row < height; ++row) {
-            uint8_t* dstBuf = dest;
-            uint8_t* srcBuf = const_cast<uint8_t*>(src);
-            int16_t tmpWidth = width;
-            while (tmpWidth >= NEON_STEP_8) {
-                pipeLine.Invoke(dstBuf, srcBuf, opa);
-                dstBuf += dstStep;
-                srcBuf += srcStep;
-                tmpWidth -= NEON_STEP_8;
-            }
-            for (int16_t i = 0; i < tmpWidth; ++i) {
-                COLOR_FILL_BLEND(dstBuf, destMode, srcBuf, srcMode, opa);
-                dstBuf += destByteSize;
-                srcBuf += srcByteSize;
+            int16_t left = static_cast<int16_t>(x);
+            int16_t right = static_cast<int16_t>(x + width - 1);
+            if (ClipToRowBounds(dst, y + row, left, right)) {
+                uint8_t* dstBuf = dest + (left - x) * destByteSize;
+                uint8_t* srcBuf = const_cast<uint8_t*>(src) + (left - x) * srcByteSize;
+                int16_t tmpWidth = right - left + 1;
+                while (tmpWidth >= NEON_STEP_8) {
+                    pipeLine.Invoke(dstBuf, srcBuf, opa);
+                    dstBuf += dstStep;
+                    srcBuf += srcStep;
+                    tmpWidth -= NEON_STEP_8;
+                }
+                for (int16_t i = 0; i < tmpWidth; ++i) {
+                    COLOR_FILL_BLEND(dstBuf, destMode, srcBuf, srcMode, opa);
+                    dstBuf += destByteSize;
+                    srcBuf += srcByteSize;
+                }
             }
             dest += destStride;
             src += srcStride;
@@ -718,12 +915,16 @@ void DrawUtils::BlendWithSoftWare(const uint8_t* src1,
     {
         DEBUG_PERFORMANCE_TRACE("BlendWithSoftWare");
         for (uint32_t row = 0; row < height; ++row) {
-            uint8_t* destTmp = dest;
-            uint8_t* srcTmp = const_cast<uint8_t*>(src);
-            for (uint32_t col = 0; col < width; ++col) {
-                COLOR_FILL_BLEND(destTmp, destMode, srcTmp, srcMode, opa);
-                destTmp += destByteSize;
-                srcTmp += srcByteSize;
+            int16_t left = static_cast<int16_t>(x);
+            int16_t right = static_cast<int16_t>(x + width - 1);
+            if (ClipToRowBounds(dst, y + row, left, right)) {
+                uint8_t* destTmp = dest + (left - x) * destByteSize;
+                uint8_t* srcTmp = const_cast<uint8_t*>(src) + (left - x) * srcByteSize;
+                for (int16_t col = left; col <= right; ++col) {
+                    COLOR_FILL_BLEND(destTmp, destMode, srcTmp, srcMode, opa);
+                    destTmp += destByteSize;
+                    srcTmp += srcByteSize;
+                }
             }
             dest += destStride;
             src += srcStride;
@@ -2240,4 +2441,34 @@ void DrawUtils::DrawHorPixelInLine(BufferInfo& gfxDstBuffer,
         COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, fillOpa);
     }
 }
+
+void DrawUtils::DrawCoverageSpan(BufferInfo& gfxDstBuffer,
+                                 int16_t left,
+                                 int16_t y,
+                                 const uint8_t* coverage,
+                                 int16_t len,
+                                 const Rect& mask,
+                                 const ColorType& color,
+                                 OpacityType opa) const
+{
+    DRAW_UTILS_PREPROCESS(gfxDstBuffer, opa);
+    if ((coverage == nullptr) || (len <= 0) || (y < mask.GetTop()) || (y > mask.GetBottom())) {
+        return;
+    }
+    int16_t begin = MATH_MAX(left, mask.GetLeft());
+    int16_t end = MATH_MIN(static_cast<int16_t>(left + len - 1), mask.GetRight());
+    if (begin > end) {
+        return;
+    }
+    Color32 result;
+    result.full = Color::ColorTo32(color);
+    screenBuffer += (y * screenBufferWidth + begin) * bufferPxSize;
+    coverage += begin - left;
+    for (int16_t x = begin; x <= end; x++) {
+        OpacityType fillOpa = *coverage * opa / OPA_OPAQUE;
+        COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, fillOpa);
+        screenBuffer += bufferPxSize;
+        coverage++;
+    }
+}
 } // namespace OHOS
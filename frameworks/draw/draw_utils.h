@@ -190,6 +190,8 @@ struct TrianglePartInfo {
     bool ignoreJunctionPoint;
 };
 
+class ClipMask;
+
 enum {
     IMG_SRC_VARIABLE,
     IMG_SRC_FILE,
@@ -221,8 +223,13 @@ public:
                     const ColorType& color,
                     const OpacityType opa) const;
 
+    /*
+     * Draws the image in area. When clipMask is set, only the covered pixels are drawn, the pixel at clipOffset of
+     * the clip mask matches the top left pixel of area.
+     */
     void DrawImage(BufferInfo& gfxDstBuffer, const Rect& area, const Rect& mask,
-                   const uint8_t* image, OpacityType opa, uint8_t pxBitSize, ColorMode colorMode) const;
+                   const uint8_t* image, OpacityType opa, uint8_t pxBitSize, ColorMode colorMode,
+                   const ClipMask* clipMask = nullptr, const Point& clipOffset = {0, 0}) const;
 
     static void
         GetXAxisErrForJunctionLine(bool ignoreJunctionPoint, bool isRightPart, int16_t& xMinErr, int16_t& xMaxErr);
@@ -276,6 +283,13 @@ public:
     void DrawPixelInLine(BufferInfo& gfxDstBuffer, int16_t x, int16_t y, const Rect& mask,
                          const ColorType& color, OpacityType opa, uint16_t w) const;
 
+    /*
+     * Blends color into the len pixels of row y starting at left, each weighted by its coverage. Every pixel ends up
+     * as DrawPixelInLine with the same weight would leave it.
+     */
+    void DrawCoverageSpan(BufferInfo& gfxDstBuffer, int16_t left, int16_t y, const uint8_t* coverage, int16_t len,
+                          const Rect& mask, const ColorType& color, OpacityType opa) const;
+
     void DrawVerPixelInLine(BufferInfo& gfxDstBuffer,
                             int16_t x,
                             int16_t y,
@@ -311,6 +325,18 @@ public:
                               const Rect& fillArea,
                               const ColorType& color,
                               const OpacityType& opa) const;
+
+    /*
+     * Limits the fills and blits into the buffer at virAddr to the columns bounds[2 * y] to bounds[2 * y + 1] of
+     * each row y below rowNum, until it is called again. A row whose left bound is right of its right bound is not
+     * drawn at all. Used to skip the corners of a round screen, which cannot be seen.
+     */
+    void SetRowBounds(const void* virAddr, const int16_t* bounds, int16_t rowNum)
+    {
+        boundedAddr_ = (bounds != nullptr) ? virAddr : nullptr;
+        rowBounds_ = bounds;
+        rowBoundNum_ = rowNum;
+    }
 #ifdef ARM_NEON_OPT
 
     void BlendLerpPix(uint8_t* color, uint8_t red, uint8_t green, uint8_t blue,
@@ -355,6 +381,28 @@ private:
 
     void FillArea(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& mask,
                   bool isTransparent, const ColorType* colorBuf);
+
+    void DrawClippedImage(BufferInfo& gfxDstBuffer, const BufferInfo& src, const Rect& maskedArea, OpacityType opa,
+                          const ClipMask& clipMask, const Point& clipPos) const;
+
+    static void BlitImageSpan(BufferInfo& gfxDstBuffer, BufferInfo& src, const Point& imagePos, int16_t left,
+                              int16_t right, int16_t y, OpacityType opa);
+
+    /* blends the image pixels of [left, right] on row y in one pass, each weighted by its cover */
+    void BlendImageCoverageSpan(BufferInfo& gfxDstBuffer, const BufferInfo& src, const Point& imagePos, int16_t left,
+                                int16_t right, int16_t y, const uint8_t* covers, OpacityType opa) const;
+
+    bool IsRowBounded(const void* virAddr) const
+    {
+        return (virAddr != nullptr) && (virAddr == boundedAddr_);
+    }
+    /* narrows [left, right] to the bounds of row y when the buffer at virAddr is bounded, false if nothing is left */
+    bool ClipToRowBounds(const void* virAddr, int16_t y, int16_t& left, int16_t& right) const;
+    void FillBoundedArea(BufferInfo& gfxDstBuffer, const Rect& fillArea, Color32 fillColor, OpacityType opa) const;
+
+    const void* boundedAddr_ = nullptr;
+    const int16_t* rowBounds_ = nullptr;
+    int16_t rowBoundNum_ = 0;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_DRAW_UTILS_H
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/rotated_glyph_cache.h"
+#include <cmath>
+#include "draw/draw_utils.h"
+#include "gfx_utils/graphic_log.h"
+
+namespace OHOS {
+namespace {
+constexpr float HALF = 0.5f;
+constexpr uint8_t CORNER_NUM = 4;
+} // namespace
+
+constexpr uint8_t RotatedGlyphCache::MAX_ENTRY_NUM;
+constexpr uint32_t RotatedGlyphCache::MAX_CACHE_SIZE;
+
+RotatedGlyphCache& RotatedGlyphCache::GetInstance()
+{
+    static RotatedGlyphCache instance;
+    return instance;
+}
+
+int16_t RotatedGlyphCache::NormalizeAngle(int16_t angle)
+{
+    angle %= CIRCLE_IN_DEGREE;
+    return (angle < 0) ? (angle + CIRCLE_IN_DEGREE) : angle;
+}
+
+bool RotatedGlyphCache::IsEqual(const RotatedGlyphKey& key1, const RotatedGlyphKey& key2)
+{
+    return (key1.letter == key2.letter) && (key1.fontId == key2.fontId) && (key1.fontHeight == key2.fontHeight) &&
+           (key1.angle == key2.angle);
+}
+
+const RotatedGlyph* RotatedGlyphCache::Get(const RotatedGlyphKey& key)
+{
+    for (uint8_t i = 0; i < entryNum_; i++) {
+        Entry& entry = entries_[i];
+        if (IsEqual(entry.key, key)) {
+            entry.lastUse = ++useCount_;
+            hitCount_++;
+            return &entry.glyph;
+        }
+    }
+    missCount_++;
+    return nullptr;
+}
+
+const RotatedGlyph* RotatedGlyphCache::Put(const RotatedGlyphKey& key, const RotatedGlyph& glyph)
+{
+    uint32_t size = static_cast<uint32_t>(glyph.width) * glyph.height;
+    if ((glyph.data == nullptr) || (size == 0) || (size > MAX_CACHE_SIZE)) {
+        delete[] glyph.data;
+        return nullptr;
+    }
+    while ((entryNum_ == MAX_ENTRY_NUM) || (usedSize_ + size > MAX_CACHE_SIZE)) {
+        uint8_t oldest = 0;
+        for (uint8_t i = 1; i < entryNum_; i++) {
+            if (entries_[i].lastUse < entries_[oldest].lastUse) {
+                oldest = i;
+            }
+        }
+        Remove(oldest);
+    }
+    Entry& entry = entries_[entryNum_++];
+    entry.key = key;
+    entry.glyph = glyph;
+    entry.lastUse = ++useCount_;
+    usedSize_ += size;
+    return &entry.glyph;
+}
+
+void RotatedGlyphCache::Remove(uint8_t index)
+{
+    Entry& entry = entries_[index];
+    usedSize_ -= static_cast<uint32_t>(entry.glyph.width) * entry.glyph.height;
+    delete[] entry.glyph.data;
+    entryNum_--;
+    entries_[index] = entries_[entryNum_];
+    entries_[entryNum_].glyph.data = nullptr;
+}
+
+void RotatedGlyphCache::Clear()
+{
+    while (entryNum_ > 0) {
+        Remove(entryNum_ - 1);
+    }
+    hitCount_ = 0;
+    missCount_ = 0;
+}
+
+uint8_t* RotatedGlyphCache::Unpack(const uint8_t* fontMap, uint8_t fontWeight, uint16_t cols, uint16_t rows)
+{
+    uint8_t* coverage = new uint8_t[static_cast<uint32_t>(cols) * rows];
+    if (coverage == nullptr) {
+        GRAPHIC_LOGE("RotatedGlyphCache::Unpack new coverage fail");
+        return nullptr;
+    }
+    /* rows start on a byte and pixels fill each byte from the low bits, like DrawUtils::DrawLetter reads them */
+    uint32_t rowBytes = (static_cast<uint32_t>(cols) * fontWeight + FONT_WEIGHT_8 - 1) / FONT_WEIGHT_8;
+    uint8_t mask = static_cast<uint8_t>((1 << fontWeight) - 1);
+    for (uint16_t y = 0; y < rows; y++) {
+        const uint8_t* src = fontMap + y * rowBytes;
+        uint8_t* dst = coverage + static_cast<uint32_t>(y) * cols;
+        for (uint16_t x = 0; x < cols; x++) {
+            uint32_t bit = static_cast<uint32_t>(x) * fontWeight;
+            uint8_t value = (src[bit / FONT_WEIGHT_8] >> (bit % FONT_WEIGHT_8)) & mask;
+            dst[x] = static_cast<uint8_t>(value * OPA_OPAQUE / mask);
+        }
+    }
+    return coverage;
+}
+
+bool RotatedGlyphCache::Rotate(const uint8_t* fontMap, uint8_t fontWeight, uint16_t cols, uint16_t rows,
+                               int16_t left, int16_t top, int16_t angle, RotatedGlyph& glyph)
+{
+    if ((fontMap == nullptr) || (cols == 0) || (rows == 0) ||
+        ((fontWeight != FONT_WEIGHT_1) && (fontWeight != FONT_WEIGHT_2) && (fontWeight != FONT_WEIGHT_4) &&
+         (fontWeight != FONT_WEIGHT_8))) {
+        return false;
+    }
+    uint8_t* src = Unpack(fontMap, fontWeight, cols, rows);
+    if (src == nullptr) {
+        return false;
+    }
+    float sinma = Sin(angle);
+    float cosma = Sin(QUARTER_IN_DEGREE - angle);
+
+    /* the bounding box of the rotated corners */
+    const float cornerX[CORNER_NUM] = {static_cast<float>(left), static_cast<float>(left + cols),
+                                       static_cast<float>(left), static_cast<float>(left + cols)};
+    const float cornerY[CORNER_NUM] = {static_cast<float>(top), static_cast<float>(top),
+                                       static_cast<float>(top + rows), static_cast<float>(top + rows)};
+    float minX = cornerX[0] * cosma - cornerY[0] * sinma;
+    float maxX = minX;
+    float minY = cornerX[0] * sinma + cornerY[0] * cosma;
+    float maxY = minY;
+    for (uint8_t i = 1; i < CORNER_NUM; i++) {
+        float x = cornerX[i] * cosma - cornerY[i] * sinma;
+        float y = cornerX[i] * sinma + cornerY[i] * cosma;
+        minX = MATH_MIN(minX, x);
+        maxX = MATH_MAX(maxX, x);
+        minY = MATH_MIN(minY, y);
+        maxY = MATH_MAX(maxY, y);
+    }
+    glyph.left = static_cast<int16_t>(std::floor(minX));
+    glyph.top = static_cast<int16_t>(std::floor(minY));
+    glyph.width = static_cast<uint16_t>(static_cast<int16_t>(std::ceil(maxX)) - glyph.left);
+    glyph.height = static_cast<uint16_t>(static_cast<int16_t>(std::ceil(maxY)) - glyph.top);
+    glyph.data = new uint8_t[static_cast<uint32_t>(glyph.width) * glyph.height];
+    if (glyph.data == nullptr) {
+        GRAPHIC_LOGE("RotatedGlyphCache::Rotate new glyph fail");
+        delete[] src;
+        return false;
+    }
+
+    /* each pixel center is turned back onto the upright glyph and sampled there */
+    uint8_t* dst = glyph.data;
+    for (uint16_t j = 0; j < glyph.height; j++) {
+        float dy = glyph.top + j + HALF;
+        for (uint16_t i = 0; i < glyph.width; i++) {
+            float dx = glyph.left + i + HALF;
+            float u = dx * cosma + dy * sinma - left - HALF;
+            float v = dy * cosma - dx * sinma - top - HALF;
+            int32_t x0 = static_cast<int32_t>(std::floor(u));
+            int32_t y0 = static_cast<int32_t>(std::floor(v));
+            float fx = u - x0;
+            float fy = v - y0;
+            float sum = 0;
+            for (int32_t y = y0; y <= y0 + 1; y++) {
+                if ((y < 0) || (y >= rows)) {
+                    continue;
+                }
+                float wy = (y == y0) ? (1 - fy) : fy;
+                for (int32_t x = x0; x <= x0 + 1; x++) {
+                    if ((x < 0) || (x >= cols)) {
+                        continue;
+                    }
+                    float wx = (x == x0) ? (1 - fx) : fx;
+                    sum += src[y * cols + x] * wx * wy;
+                }
+            }
+            *dst++ = static_cast<uint8_t>(MATH_MIN(sum + HALF, static_cast<float>(OPA_OPAQUE)));
+        }
+    }
+    delete[] src;
+    return true;
+}
+} // namespace OHOS
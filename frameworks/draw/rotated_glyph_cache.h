@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
+#define GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
+
+#include "gfx_utils/heap_base.h"
+#include <cstdint>
+
+namespace OHOS {
+/*
+ * Identifies a rotated glyph: the letter, the font, which packs the size for bitmap fonts, the line height, which
+ * tells the sizes of a vector font apart, and the angle in whole degrees within [0, 360).
+ */
+struct RotatedGlyphKey {
+    uint32_t letter;
+    uint8_t fontId;
+    uint16_t fontHeight;
+    int16_t angle;
+};
+
+/*
+ * The 8 bit coverage of a rotated glyph, width * height bytes. The top left pixel is at (left, top) from the point
+ * the glyph was rotated around.
+ */
+struct RotatedGlyph {
+    uint8_t* data;
+    int16_t left;
+    int16_t top;
+    uint16_t width;
+    uint16_t height;
+};
+
+/**
+ * Keeps glyphs rotated to the angles of an arc label or rotated text, so that each (glyph, angle) is rasterized once
+ * and then blended like an upright letter instead of going through a bilinear transform per pixel on every frame.
+ * The cache holds at most MAX_ENTRY_NUM glyphs and MAX_CACHE_SIZE bytes, the least recently used glyph is dropped
+ * first.
+ */
+class RotatedGlyphCache : public HeapBase {
+public:
+    static constexpr uint8_t MAX_ENTRY_NUM = 128;
+    static constexpr uint32_t MAX_CACHE_SIZE = 64 * 1024; // 64 * 1024: 64KB
+
+    static RotatedGlyphCache& GetInstance();
+
+    /* Returns the cached glyph of key, or nullptr. The glyph is valid until the next Put or Clear. */
+    const RotatedGlyph* Get(const RotatedGlyphKey& key);
+
+    /*
+     * Takes over glyph.data and returns the cached glyph, or releases the data and returns nullptr if the glyph is
+     * larger than the whole cache.
+     */
+    const RotatedGlyph* Put(const RotatedGlyphKey& key, const RotatedGlyph& glyph);
+
+    void Clear();
+
+    /* Drawing rotated letters through the cache is enabled by default. Disabling it also clears it. */
+    void SetEnable(bool enable)
+    {
+        enable_ = enable;
+        if (!enable) {
+            Clear();
+        }
+    }
+
+    bool IsEnabled() const
+    {
+        return enable_;
+    }
+
+    uint8_t GetEntryNum() const
+    {
+        return entryNum_;
+    }
+
+    uint32_t GetUsedSize() const
+    {
+        return usedSize_;
+    }
+
+    uint32_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint32_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    /*
+     * Resamples an upright glyph of cols * rows pixels in A1, A2, A4 or A8, whose top left pixel is at (left, top)
+     * from the pivot, rotated clockwise by angle degrees around the pivot. Bilinear, like the transform the glyph
+     * used to be drawn with. Returns false if glyph.data cannot be allocated, otherwise glyph.data is new[]ed.
+     */
+    static bool Rotate(const uint8_t* fontMap, uint8_t fontWeight, uint16_t cols, uint16_t rows, int16_t left,
+                       int16_t top, int16_t angle, RotatedGlyph& glyph);
+
+    /* Returns angle in [0, 360). */
+    static int16_t NormalizeAngle(int16_t angle);
+
+private:
+    struct Entry {
+        RotatedGlyphKey key;
+        RotatedGlyph glyph;
+        uint32_t lastUse;
+    };
+
+    RotatedGlyphCache()
+        : entries_{}, entryNum_(0), usedSize_(0), useCount_(0), hitCount_(0), missCount_(0), enable_(true)
+    {
+    }
+    ~RotatedGlyphCache()
+    {
+        Clear();
+    }
+
+    static bool IsEqual(const RotatedGlyphKey& key1, const RotatedGlyphKey& key2);
+    static uint8_t* Unpack(const uint8_t* fontMap, uint8_t fontWeight, uint16_t cols, uint16_t rows);
+    void Remove(uint8_t index);
+
+    Entry entries_[MAX_ENTRY_NUM];
+    uint8_t entryNum_;
+    uint32_t usedSize_;
+    uint32_t useCount_;
+    uint32_t hitCount_;
+    uint32_t missCount_;
+    bool enable_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
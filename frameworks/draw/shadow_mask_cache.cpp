@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/shadow_mask_cache.h"
+
+namespace OHOS {
+constexpr uint8_t ShadowMaskCache::MAX_ENTRY_NUM;
+constexpr uint32_t ShadowMaskCache::MAX_CACHE_SIZE;
+
+ShadowMaskCache& ShadowMaskCache::GetInstance()
+{
+    static ShadowMaskCache instance;
+    return instance;
+}
+
+uint64_t ShadowMaskCache::Hash(const void* data, uint32_t size, uint64_t hash)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (uint32_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= HASH_PRIME;
+    }
+    return hash;
+}
+
+bool ShadowMaskCache::IsEqual(const ShadowMaskKey& key1, const ShadowMaskKey& key2)
+{
+    return (key1.pathHash == key2.pathHash) && (key1.paramHash == key2.paramHash) && (key1.radius == key2.radius) &&
+           (key1.vertexNum == key2.vertexNum) && (key1.minX == key2.minX) && (key1.minY == key2.minY) &&
+           (key1.maxX == key2.maxX) && (key1.maxY == key2.maxY);
+}
+
+const ShadowMask* ShadowMaskCache::Get(const ShadowMaskKey& key)
+{
+    for (uint8_t i = 0; i < entryNum_; i++) {
+        Entry& entry = entries_[i];
+        if (IsEqual(entry.key, key)) {
+            entry.lastUse = ++useCount_;
+            hitCount_++;
+            return &entry.mask;
+        }
+    }
+    missCount_++;
+    return nullptr;
+}
+
+bool ShadowMaskCache::Put(const ShadowMaskKey& key, const ShadowMask& mask)
+{
+    uint32_t size = static_cast<uint32_t>(mask.width) * mask.height;
+    if ((mask.alpha == nullptr) || (size > MAX_CACHE_SIZE)) {
+        return false;
+    }
+    while ((entryNum_ == MAX_ENTRY_NUM) || (usedSize_ + size > MAX_CACHE_SIZE)) {
+        uint8_t oldest = 0;
+        for (uint8_t i = 1; i < entryNum_; i++) {
+            if (entries_[i].lastUse < entries_[oldest].lastUse) {
+                oldest = i;
+            }
+        }
+        Remove(oldest);
+    }
+    Entry& entry = entries_[entryNum_++];
+    entry.key = key;
+    entry.mask = mask;
+    entry.lastUse = ++useCount_;
+    usedSize_ += size;
+    return true;
+}
+
+void ShadowMaskCache::Remove(uint8_t index)
+{
+    Entry& entry = entries_[index];
+    usedSize_ -= static_cast<uint32_t>(entry.mask.width) * entry.mask.height;
+    delete[] entry.mask.alpha;
+    entryNum_--;
+    entries_[index] = entries_[entryNum_];
+    entries_[entryNum_].mask.alpha = nullptr;
+}
+
+void ShadowMaskCache::Clear()
+{
+    while (entryNum_ > 0) {
+        Remove(entryNum_ - 1);
+    }
+    hitCount_ = 0;
+    missCount_ = 0;
+}
+} // namespace OHOS
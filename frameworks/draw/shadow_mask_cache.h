@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_SHADOW_MASK_CACHE_H
+#define GRAPHIC_LITE_SHADOW_MASK_CACHE_H
+
+#include "gfx_utils/heap_base.h"
+#include <cstdint>
+
+namespace OHOS {
+/*
+ * Identifies a blurred shadow: the path and everything that changes its outline, and the blur radius. The vertex
+ * count and the bounds of the vertices are kept besides the path hash, so a hash collision only returns a wrong mask
+ * for a path of the same size and extent.
+ */
+struct ShadowMaskKey {
+    uint64_t pathHash;
+    uint64_t paramHash;
+    uint16_t radius;
+    uint32_t vertexNum;
+    float minX;
+    float minY;
+    float maxX;
+    float maxY;
+};
+
+/* A blurred shadow alpha mask. left and top are relative to the integer translation of the path. */
+struct ShadowMask {
+    uint8_t* alpha;
+    int16_t left;
+    int16_t top;
+    int16_t width;
+    int16_t height;
+};
+
+/**
+ * Keeps the latest blurred shadow masks so that shadows of unchanged paths are neither rasterized nor blurred
+ * again. The cache holds at most MAX_ENTRY_NUM masks and MAX_CACHE_SIZE bytes, the least recently used mask is
+ * dropped first.
+ */
+class ShadowMaskCache : public HeapBase {
+public:
+    static constexpr uint8_t MAX_ENTRY_NUM = 8;
+    static constexpr uint32_t MAX_CACHE_SIZE = 256 * 1024; // 256 * 1024: 256KB
+
+    static ShadowMaskCache& GetInstance();
+
+    /* FNV-1a, continues from hash so that several fields can be hashed into one value */
+    static uint64_t Hash(const void* data, uint32_t size, uint64_t hash = HASH_OFFSET);
+
+    /* Returns the cached mask of key, or nullptr. The mask is valid until the next Put or Clear. */
+    const ShadowMask* Get(const ShadowMaskKey& key);
+
+    /* Takes over mask.alpha and returns true, or returns false if the mask is larger than the whole cache. */
+    bool Put(const ShadowMaskKey& key, const ShadowMask& mask);
+
+    void Clear();
+
+    uint32_t GetUsedSize() const
+    {
+        return usedSize_;
+    }
+
+    uint32_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint32_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+private:
+    static constexpr uint64_t HASH_OFFSET = 14695981039346656037ULL;
+    static constexpr uint64_t HASH_PRIME = 1099511628211ULL;
+
+    struct Entry {
+        ShadowMaskKey key;
+        ShadowMask mask;
+        uint32_t lastUse;
+    };
+
+    ShadowMaskCache() : entries_{}, entryNum_(0), usedSize_(0), useCount_(0), hitCount_(0), missCount_(0) {}
+    ~ShadowMaskCache()
+    {
+        Clear();
+    }
+
+    static bool IsEqual(const ShadowMaskKey& key1, const ShadowMaskKey& key2);
+    void Remove(uint8_t index);
+
+    Entry entries_[MAX_ENTRY_NUM];
+    uint8_t entryNum_;
+    uint32_t usedSize_;
+    uint32_t useCount_;
+    uint32_t hitCount_;
+    uint32_t missCount_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_SHADOW_MASK_CACHE_H
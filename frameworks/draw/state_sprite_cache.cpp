@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/state_sprite_cache.h"
+#include "gfx_utils/color.h"
+
+namespace OHOS {
+constexpr uint8_t StateSpriteCache::MAX_ENTRY_NUM;
+constexpr uint32_t StateSpriteCache::MAX_CACHE_SIZE;
+
+StateSpriteCache& StateSpriteCache::GetInstance()
+{
+    static StateSpriteCache instance;
+    return instance;
+}
+
+uint32_t StateSpriteCache::GetSpriteSize(const StateSpriteKey& key)
+{
+    if ((key.width <= 0) || (key.height <= 0)) {
+        return 0;
+    }
+    return static_cast<uint32_t>(key.width) * key.height * sizeof(Color32);
+}
+
+bool StateSpriteCache::IsEqual(const StateSpriteKey& key1, const StateSpriteKey& key2)
+{
+    return (key1.type == key2.type) && (key1.width == key2.width) && (key1.height == key2.height) &&
+           (key1.viewWidth == key2.viewWidth) && (key1.viewHeight == key2.viewHeight) &&
+           (key1.color == key2.color) && (key1.step == key2.step);
+}
+
+const uint8_t* StateSpriteCache::Get(const StateSpriteKey& key)
+{
+    for (uint8_t i = 0; i < entryNum_; i++) {
+        Entry& entry = entries_[i];
+        if (IsEqual(entry.key, key)) {
+            entry.lastUse = ++useCount_;
+            hitCount_++;
+            return entry.data;
+        }
+    }
+    missCount_++;
+    return nullptr;
+}
+
+bool StateSpriteCache::Put(const StateSpriteKey& key, uint8_t* data)
+{
+    uint32_t size = GetSpriteSize(key);
+    if ((data == nullptr) || (size == 0) || (size > MAX_CACHE_SIZE)) {
+        return false;
+    }
+    while ((entryNum_ == MAX_ENTRY_NUM) || (usedSize_ + size > MAX_CACHE_SIZE)) {
+        uint8_t oldest = 0;
+        for (uint8_t i = 1; i < entryNum_; i++) {
+            if (entries_[i].lastUse < entries_[oldest].lastUse) {
+                oldest = i;
+            }
+        }
+        Remove(oldest);
+    }
+    Entry& entry = entries_[entryNum_++];
+    entry.key = key;
+    entry.data = data;
+    entry.lastUse = ++useCount_;
+    usedSize_ += size;
+    return true;
+}
+
+void StateSpriteCache::Remove(uint8_t index)
+{
+    Entry& entry = entries_[index];
+    usedSize_ -= GetSpriteSize(entry.key);
+    delete[] entry.data;
+    entryNum_--;
+    entries_[index] = entries_[entryNum_];
+    entries_[entryNum_].data = nullptr;
+}
+
+void StateSpriteCache::Clear()
+{
+    while (entryNum_ > 0) {
+        Remove(entryNum_ - 1);
+    }
+    hitCount_ = 0;
+    missCount_ = 0;
+}
+} // namespace OHOS
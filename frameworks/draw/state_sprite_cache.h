@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_STATE_SPRITE_CACHE_H
+#define GRAPHIC_LITE_STATE_SPRITE_CACHE_H
+
+#include "gfx_utils/heap_base.h"
+#include <cstdint>
+
+namespace OHOS {
+/*
+ * Identifies the drawing of a check box, radio button or toggle button state: the view type, the content size the
+ * sprite covers, the view size the geometry of the control is derived from, the color and the animation step, which
+ * packs whatever else the drawing of the control depends on.
+ */
+struct StateSpriteKey {
+    uint8_t type;
+    int16_t width;
+    int16_t height;
+    int16_t viewWidth;
+    int16_t viewHeight;
+    uint32_t color;
+    uint32_t step;
+};
+
+/**
+ * Keeps the states of check boxes, radio buttons and toggle buttons rasterized into ARGB8888 sprites of their
+ * content size, so that the controls are blitted instead of drawn from arcs and lines again. The cache holds at
+ * most MAX_ENTRY_NUM sprites and MAX_CACHE_SIZE bytes, the least recently used sprite is dropped first.
+ */
+class StateSpriteCache : public HeapBase {
+public:
+    static constexpr uint8_t MAX_ENTRY_NUM = 32;
+    static constexpr uint32_t MAX_CACHE_SIZE = 128 * 1024; // 128 * 1024: 128KB
+
+    static StateSpriteCache& GetInstance();
+
+    /* Returns the cached sprite of key, or nullptr. The sprite is valid until the next Put or Clear. */
+    const uint8_t* Get(const StateSpriteKey& key);
+
+    /*
+     * Takes over data, key.width * key.height ARGB8888 pixels, and returns true, or returns false if the sprite is
+     * larger than the whole cache.
+     */
+    bool Put(const StateSpriteKey& key, uint8_t* data);
+
+    void Clear();
+
+    /* Drawing the states through the cache is enabled by default. Disabling it also clears it. */
+    void SetEnable(bool enable)
+    {
+        enable_ = enable;
+        if (!enable) {
+            Clear();
+        }
+    }
+
+    bool IsEnabled() const
+    {
+        return enable_;
+    }
+
+    uint8_t GetEntryNum() const
+    {
+        return entryNum_;
+    }
+
+    uint32_t GetUsedSize() const
+    {
+        return usedSize_;
+    }
+
+    uint32_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint32_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    static uint32_t GetSpriteSize(const StateSpriteKey& key);
+
+private:
+    struct Entry {
+        StateSpriteKey key;
+        uint8_t* data;
+        uint32_t lastUse;
+    };
+
+    StateSpriteCache()
+        : entries_{}, entryNum_(0), usedSize_(0), useCount_(0), hitCount_(0), missCount_(0), enable_(true)
+    {
+    }
+    ~StateSpriteCache()
+    {
+        Clear();
+    }
+
+    static bool IsEqual(const StateSpriteKey& key1, const StateSpriteKey& key2);
+    void Remove(uint8_t index);
+
+    Entry entries_[MAX_ENTRY_NUM];
+    uint8_t entryNum_;
+    uint32_t usedSize_;
+    uint32_t useCount_;
+    uint32_t hitCount_;
+    uint32_t missCount_;
+    bool enable_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_STATE_SPRITE_CACHE_H
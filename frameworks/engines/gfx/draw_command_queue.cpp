@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engines/gfx/draw_command_queue.h"
+
+namespace OHOS {
+bool DrawCommandQueue::AddFill(const Rect& rect, ColorType color, OpacityType opacity)
+{
+    if (commandNum_ >= MAX_COMMAND_NUM) {
+        return false;
+    }
+    FillCommand& command = commands_[commandNum_++];
+    command.rect = rect;
+    command.color = color;
+    command.opacity = opacity;
+    return true;
+}
+
+bool DrawCommandQueue::IsOpaque(const FillCommand& command)
+{
+    /* an opaque fill overwrites the pixels without reading them */
+    Color32 color;
+    color.full = Color::ColorTo32(command.color);
+    return (command.opacity == OPA_OPAQUE) && (color.alpha == OPA_OPAQUE);
+}
+
+void DrawCommandQueue::Optimize()
+{
+    if (commandNum_ < 2) { // 2: nothing to optimize in a single fill
+        return;
+    }
+    for (uint16_t i = 0; i < commandNum_; i++) {
+        dropped_[i] = false;
+    }
+    DropCovered();
+    bool merged = false;
+    while (MergeAdjacent()) {
+        merged = true;
+    }
+    if (merged) {
+        /* a merged fill may cover fills the parts did not */
+        DropCovered();
+    }
+    Compact();
+}
+
+void DrawCommandQueue::DropCovered()
+{
+    /* the later fill overwrites every pixel of the earlier one, whatever was drawn in between */
+    for (uint16_t i = 0; i < commandNum_; i++) {
+        if (dropped_[i]) {
+            continue;
+        }
+        for (uint16_t j = i + 1; j < commandNum_; j++) {
+            if (!dropped_[j] && IsOpaque(commands_[j]) && commands_[j].rect.IsContains(commands_[i].rect)) {
+                dropped_[i] = true;
+                droppedNum_++;
+                break;
+            }
+        }
+    }
+}
+
+bool DrawCommandQueue::CanMerge(const FillCommand& first, const FillCommand& second, Rect& merged)
+{
+    if ((first.opacity != second.opacity) || (Color::ColorTo32(first.color) != Color::ColorTo32(second.color))) {
+        return false;
+    }
+    const Rect& a = first.rect;
+    const Rect& b = second.rect;
+    if ((a.GetTop() == b.GetTop()) && (a.GetBottom() == b.GetBottom()) &&
+        ((a.GetRight() + 1 == b.GetLeft()) || (b.GetRight() + 1 == a.GetLeft()))) {
+        merged.SetRect(MATH_MIN(a.GetLeft(), b.GetLeft()), a.GetTop(), MATH_MAX(a.GetRight(), b.GetRight()),
+                       a.GetBottom());
+        return true;
+    }
+    if ((a.GetLeft() == b.GetLeft()) && (a.GetRight() == b.GetRight()) &&
+        ((a.GetBottom() + 1 == b.GetTop()) || (b.GetBottom() + 1 == a.GetTop()))) {
+        merged.SetRect(a.GetLeft(), MATH_MIN(a.GetTop(), b.GetTop()), a.GetRight(),
+                       MATH_MAX(a.GetBottom(), b.GetBottom()));
+        return true;
+    }
+    return false;
+}
+
+bool DrawCommandQueue::MergeAdjacent()
+{
+    /*
+     * Adjacent fills do not overlap, so one fill of both rects blends every pixel once, as before. The earlier fill
+     * moves to the later one, which is only allowed if no fill in between touches it.
+     */
+    bool changed = false;
+    Rect merged;
+    for (uint16_t i = 0; i < commandNum_; i++) {
+        if (dropped_[i]) {
+            continue;
+        }
+        for (uint16_t j = i + 1; j < commandNum_; j++) {
+            if (dropped_[j]) {
+                continue;
+            }
+            if (CanMerge(commands_[i], commands_[j], merged)) {
+                commands_[j].rect = merged;
+                dropped_[i] = true;
+                mergedNum_++;
+                changed = true;
+                break;
+            }
+            if (commands_[j].rect.IsIntersect(commands_[i].rect)) {
+                break;
+            }
+        }
+    }
+    return changed;
+}
+
+void DrawCommandQueue::Compact()
+{
+    uint16_t num = 0;
+    for (uint16_t i = 0; i < commandNum_; i++) {
+        if (!dropped_[i]) {
+            commands_[num++] = commands_[i];
+        }
+    }
+    commandNum_ = num;
+}
+} // namespace OHOS
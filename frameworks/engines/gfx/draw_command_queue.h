@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_DRAW_COMMAND_QUEUE_H
+#define GRAPHIC_LITE_DRAW_COMMAND_QUEUE_H
+
+#include "engines/gfx/gfx_engine_manager.h"
+
+namespace OHOS {
+/**
+ * Records the fills of BaseGfxEngine in deferred mode. Before they are executed, Optimize drops the fills a later
+ * opaque fill covers completely and merges fills of the same color that share an edge, which leaves the pixels
+ * exactly as executing every fill in order would.
+ */
+class DrawCommandQueue : public HeapBase {
+public:
+    static constexpr uint16_t MAX_COMMAND_NUM = 64;
+
+    DrawCommandQueue() : commandNum_(0), droppedNum_(0), mergedNum_(0) {}
+    ~DrawCommandQueue() {}
+
+    /* Returns false if the queue is full. */
+    bool AddFill(const Rect& rect, ColorType color, OpacityType opacity);
+
+    void Optimize();
+
+    void Clear()
+    {
+        commandNum_ = 0;
+    }
+
+    const FillCommand* GetCommands() const
+    {
+        return commands_;
+    }
+
+    uint16_t GetCommandNum() const
+    {
+        return commandNum_;
+    }
+
+    FillCommand* GetLastCommand()
+    {
+        return (commandNum_ == 0) ? nullptr : &commands_[commandNum_ - 1];
+    }
+
+    void RemoveLastCommand()
+    {
+        if (commandNum_ > 0) {
+            commandNum_--;
+        }
+    }
+
+    /* Number of fills dropped and merged by Optimize since the queue was created. */
+    uint32_t GetDroppedNum() const
+    {
+        return droppedNum_;
+    }
+
+    uint32_t GetMergedNum() const
+    {
+        return mergedNum_;
+    }
+
+    static bool IsOpaque(const FillCommand& command);
+
+private:
+    static bool CanMerge(const FillCommand& first, const FillCommand& second, Rect& merged);
+    void DropCovered();
+    bool MergeAdjacent();
+    void Compact();
+
+    FillCommand commands_[MAX_COMMAND_NUM];
+    bool dropped_[MAX_COMMAND_NUM];
+    uint16_t commandNum_;
+    uint32_t droppedNum_;
+    uint32_t mergedNum_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_DRAW_COMMAND_QUEUE_H
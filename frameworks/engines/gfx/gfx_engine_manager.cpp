@@ -22,9 +22,23 @@
 #include "draw/draw_curve.h"
 #include "draw/draw_line.h"
 #include "draw/draw_rect.h"
+#include "engines/gfx/draw_command_queue.h"
+#include "gfx_utils/graphic_log.h"
 
 namespace OHOS {
+namespace {
+/* 16384: an opaque fill and the blit into it are drawn in bands of about 16KB, which stay in the data cache */
+constexpr int32_t FILL_BLIT_BAND_BYTES = 16384;
+} // namespace
+
 BaseGfxEngine* BaseGfxEngine::baseEngine_ = nullptr;
+
+BaseGfxEngine::~BaseGfxEngine()
+{
+    delete drawQueue_;
+    drawQueue_ = nullptr;
+}
+
 void BaseGfxEngine::DrawArc(BufferInfo& dst,
                             ArcInfo& arcInfo,
                             const Rect& mask,
@@ -32,7 +46,9 @@ void BaseGfxEngine::DrawArc(BufferInfo& dst,
                             OpacityType opacity,
                             uint8_t cap)
 {
+    PauseDeferred();
     DrawArc::GetInstance()->Draw(dst, arcInfo, mask, style, opacity, cap);
+    ResumeDeferred();
 }
 
 void BaseGfxEngine::DrawLine(BufferInfo& dst,
@@ -43,7 +59,9 @@ void BaseGfxEngine::DrawLine(BufferInfo& dst,
                              ColorType color,
                              OpacityType opacity)
 {
+    PauseDeferred();
     DrawLine::Draw(dst, start, end, mask, width, color, opacity);
+    ResumeDeferred();
 }
 
 void BaseGfxEngine::DrawLetter(BufferInfo& gfxDstBuffer,
@@ -54,7 +72,9 @@ void BaseGfxEngine::DrawLetter(BufferInfo& gfxDstBuffer,
                                const ColorType& color,
                                const OpacityType opa)
 {
+    PauseDeferred();
     DrawUtils::GetInstance()->DrawLetter(gfxDstBuffer, fontMap, fontRect, subRect, fontWeight, color, opa);
+    ResumeDeferred();
 }
 
 void BaseGfxEngine::DrawCubicBezier(BufferInfo& dst,
@@ -67,7 +87,22 @@ void BaseGfxEngine::DrawCubicBezier(BufferInfo& dst,
                                     ColorType color,
                                     OpacityType opacity)
 {
+    PauseDeferred();
     DrawCurve::DrawCubicBezier(dst, start, control1, control2, end, mask, width, color, opacity);
+    ResumeDeferred();
+}
+
+void BaseGfxEngine::DrawPolyline(BufferInfo& dst,
+                                 const Point* points,
+                                 uint16_t pointNum,
+                                 const Rect& mask,
+                                 int16_t width,
+                                 ColorType color,
+                                 OpacityType opacity)
+{
+    PauseDeferred();
+    DrawCurve::DrawPolyline(dst, points, pointNum, mask, width, color, opacity);
+    ResumeDeferred();
 }
 
 void BaseGfxEngine::DrawRect(BufferInfo& dst,
@@ -87,8 +122,10 @@ void BaseGfxEngine::DrawTransform(BufferInfo& dst,
                                   const TransformMap& transMap,
                                   const TransformDataInfo& dataInfo)
 {
+    PauseDeferred();
     DrawUtils::GetInstance()->DrawTransform(dst, mask, position, color,
         opacity, transMap, dataInfo);
+    ResumeDeferred();
 }
 
 void BaseGfxEngine::ClipCircle(const ImageInfo* info, float x, float y, float radius)
@@ -115,6 +152,141 @@ void BaseGfxEngine::Fill(BufferInfo& dst, const Rect& fillArea, const ColorType
     DrawUtils::GetInstance()->FillAreaWithSoftWare(dst, fillArea, color, opacity);
 }
 
+void BaseGfxEngine::SetDeferredEnable(bool enable)
+{
+    if (!enable) {
+        EndDeferred();
+        delete drawQueue_;
+        drawQueue_ = nullptr;
+    }
+    deferredEnable_ = enable;
+}
+
+void BaseGfxEngine::BeginDeferred(const BufferInfo& dst)
+{
+    if (!deferredEnable_ || (dst.virAddr == nullptr)) {
+        return;
+    }
+    if (drawQueue_ == nullptr) {
+        drawQueue_ = new DrawCommandQueue();
+        if (drawQueue_ == nullptr) {
+            GRAPHIC_LOGE("BaseGfxEngine::BeginDeferred new DrawCommandQueue fail");
+            return;
+        }
+    }
+    FlushDeferred();
+    deferredDst_ = dst;
+    deferredTarget_ = dst.virAddr;
+    pauseDepth_ = 0;
+}
+
+void BaseGfxEngine::EndDeferred()
+{
+    FlushDeferred();
+    deferredTarget_ = nullptr;
+}
+
+void BaseGfxEngine::PauseDeferred()
+{
+    FlushDeferred();
+    pauseDepth_++;
+}
+
+void BaseGfxEngine::ResumeDeferred()
+{
+    if (pauseDepth_ > 0) {
+        pauseDepth_--;
+    }
+}
+
+void BaseGfxEngine::FlushDeferred()
+{
+    if ((drawQueue_ == nullptr) || (drawQueue_->GetCommandNum() == 0)) {
+        return;
+    }
+    /* the fills drawn by the queue must not be recorded again */
+    pauseDepth_++;
+    drawQueue_->Optimize();
+    ExecuteFills(deferredDst_, drawQueue_->GetCommands(), drawQueue_->GetCommandNum());
+    drawQueue_->Clear();
+    pauseDepth_--;
+}
+
+void BaseGfxEngine::ExecuteFills(BufferInfo& dst, const FillCommand* commands, uint16_t commandNum)
+{
+    for (uint16_t i = 0; i < commandNum; i++) {
+        Fill(dst, commands[i].rect, commands[i].color, commands[i].opacity);
+    }
+}
+
+void BaseGfxEngine::SubmitFill(BufferInfo& dst,
+                               const Rect& fillArea,
+                               const ColorType color,
+                               const OpacityType opacity)
+{
+    if (!IsRecording(dst)) {
+        Fill(dst, fillArea, color, opacity);
+        return;
+    }
+    if (!drawQueue_->AddFill(fillArea, color, opacity)) {
+        FlushDeferred();
+        drawQueue_->AddFill(fillArea, color, opacity);
+    }
+}
+
+void BaseGfxEngine::SubmitBlit(BufferInfo& dst,
+                               const Point& dstPos,
+                               const BufferInfo& src,
+                               const Rect& subRect,
+                               const BlendOption& blendOption)
+{
+    if (!IsRecording(dst) || (drawQueue_->GetCommandNum() == 0)) {
+        Blit(dst, dstPos, src, subRect, blendOption);
+        return;
+    }
+    /* the source of a blit may be gone after the call, so blits are drawn at once, after the queue */
+    drawQueue_->Optimize();
+    FillCommand fill = *drawQueue_->GetLastCommand();
+    bool combine = DrawCommandQueue::IsOpaque(fill) && fill.rect.IsContains(subRect);
+    if (combine) {
+        drawQueue_->RemoveLastCommand();
+    }
+    FlushDeferred();
+    if (combine) {
+        pauseDepth_++;
+        FillAndBlitInBands(dst, fill, dstPos, src, subRect, blendOption);
+        pauseDepth_--;
+    } else {
+        Blit(dst, dstPos, src, subRect, blendOption);
+    }
+}
+
+void BaseGfxEngine::FillAndBlitInBands(BufferInfo& dst,
+                                       const FillCommand& fill,
+                                       const Point& dstPos,
+                                       const BufferInfo& src,
+                                       const Rect& subRect,
+                                       const BlendOption& blendOption)
+{
+    /* each band of the blit is blended right after the band of the fill below it, while it is still in the cache */
+    int32_t rowBytes = static_cast<int32_t>(fill.rect.GetWidth()) * DrawUtils::GetByteSizeByColorMode(dst.mode);
+    int16_t bandHeight = static_cast<int16_t>(MATH_MAX(1, FILL_BLIT_BAND_BYTES / MATH_MAX(rowBytes, 1)));
+    Rect band = fill.rect;
+    while (band.GetTop() <= fill.rect.GetBottom()) {
+        band.SetBottom(MATH_MIN(band.GetTop() + bandHeight - 1, fill.rect.GetBottom()));
+        Fill(dst, band, fill.color, fill.opacity);
+        Rect blitBand = subRect;
+        if (blitBand.Intersect(blitBand, band)) {
+            int16_t offset = blitBand.GetTop() - subRect.GetTop();
+            BufferInfo srcBand = src;
+            srcBand.rect.SetTop(src.rect.GetTop() + offset);
+            srcBand.rect.SetBottom(srcBand.rect.GetTop() + blitBand.GetHeight() - 1);
+            Blit(dst, {dstPos.x, static_cast<int16_t>(dstPos.y + offset)}, srcBand, blitBand, blendOption);
+        }
+        band.SetTop(band.GetBottom() + 1);
+    }
+}
+
 uint8_t* BaseGfxEngine::AllocBuffer(uint32_t size, uint32_t usage)
 {
     return static_cast<uint8_t *>(malloc(size));
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/ui_font_coverage.h"
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
+
+namespace OHOS {
+constexpr uint32_t UIFontCoverage::UNICODE_MAX;
+
+bool UIFontCoverage::Build(FT_Face face)
+{
+    Clear();
+    if (face == nullptr) {
+        return false;
+    }
+    /* the first pass only numbers the pages in use, so the bitmaps can be allocated in one block */
+    FT_UInt glyphIndex = 0;
+    FT_ULong unicode = FT_Get_First_Char(face, &glyphIndex);
+    while (glyphIndex != 0) {
+        if (unicode <= UNICODE_MAX) {
+            uint16_t& page = pageIndex_[unicode >> PAGE_SHIFT];
+            if (page == 0) {
+                page = ++pageNum_;
+            }
+        }
+        unicode = FT_Get_Next_Char(face, unicode, &glyphIndex);
+    }
+
+    if (pageNum_ > 0) {
+        uint32_t size = pageNum_ * PAGE_WORD_NUM * sizeof(uint32_t);
+        bits_ = new uint32_t[pageNum_ * PAGE_WORD_NUM];
+        if (bits_ == nullptr) {
+            GRAPHIC_LOGE("UIFontCoverage::Build new bits fail");
+            Clear();
+            return false;
+        }
+        (void)memset_s(bits_, size, 0, size);
+    }
+    unicode = FT_Get_First_Char(face, &glyphIndex);
+    while (glyphIndex != 0) {
+        if (unicode <= UNICODE_MAX) {
+            uint32_t offset = unicode & PAGE_MASK;
+            uint32_t* word = bits_ + (pageIndex_[unicode >> PAGE_SHIFT] - 1) * PAGE_WORD_NUM + (offset >> WORD_SHIFT);
+            *word |= 1u << (offset & WORD_MASK);
+        }
+        unicode = FT_Get_Next_Char(face, unicode, &glyphIndex);
+    }
+    built_ = true;
+    return true;
+}
+
+void UIFontCoverage::Clear()
+{
+    delete[] bits_;
+    bits_ = nullptr;
+    (void)memset_s(pageIndex_, sizeof(pageIndex_), 0, sizeof(pageIndex_));
+    pageNum_ = 0;
+    built_ = false;
+}
+} // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UI_FONT_COVERAGE_H
+#define UI_FONT_COVERAGE_H
+
+#include "ft2build.h"
+#include "freetype/freetype.h"
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/*
+ * The set of code points a face has glyphs for, as a two-level bitmap over the Unicode planes. The code points are
+ * split into pages of 4096, a page index maps each page to its bitmap and pages without any glyph take no bitmap.
+ * A lookup is two array accesses, so it can replace probing the face with FT_Get_Char_Index.
+ */
+class UIFontCoverage : public HeapBase {
+public:
+    static constexpr uint32_t UNICODE_MAX = 0x10FFFF;
+
+    UIFontCoverage() : pageIndex_{0}, bits_(nullptr), pageNum_(0), built_(false) {}
+    ~UIFontCoverage()
+    {
+        Clear();
+    }
+    UIFontCoverage(const UIFontCoverage&) = delete;
+    UIFontCoverage& operator=(const UIFontCoverage&) = delete;
+
+    /* Walks the character map of the face once. Returns false if the bitmap cannot be allocated. */
+    bool Build(FT_Face face);
+    void Clear();
+
+    bool IsBuilt() const
+    {
+        return built_;
+    }
+
+    bool Has(uint32_t unicode) const
+    {
+        if (unicode > UNICODE_MAX) {
+            return false;
+        }
+        uint16_t page = pageIndex_[unicode >> PAGE_SHIFT];
+        if (page == 0) {
+            return false;
+        }
+        uint32_t offset = unicode & PAGE_MASK;
+        return (bits_[(page - 1) * PAGE_WORD_NUM + (offset >> WORD_SHIFT)] & (1u << (offset & WORD_MASK))) != 0;
+    }
+
+    /* Obtains the bytes taken by the bitmap, including the page index. */
+    uint32_t GetSize() const
+    {
+        return sizeof(pageIndex_) + pageNum_ * PAGE_WORD_NUM * sizeof(uint32_t);
+    }
+
+private:
+    static constexpr uint8_t PAGE_SHIFT = 12;
+    static constexpr uint32_t PAGE_MASK = (1u << PAGE_SHIFT) - 1;
+    static constexpr uint16_t PAGE_NUM = (UNICODE_MAX >> PAGE_SHIFT) + 1;
+    static constexpr uint8_t WORD_SHIFT = 5;
+    static constexpr uint32_t WORD_MASK = (1u << WORD_SHIFT) - 1;
+    static constexpr uint16_t PAGE_WORD_NUM = (1u << PAGE_SHIFT) >> WORD_SHIFT;
+
+    /* 0 for an empty page, otherwise the index of its bitmap plus 1 */
+    uint16_t pageIndex_[PAGE_NUM];
+    uint32_t* bits_;
+    uint16_t pageNum_;
+    bool built_;
+};
+} // namespace OHOS
+#endif // UI_FONT_COVERAGE_H
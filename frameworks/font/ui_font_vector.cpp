@@ -17,9 +17,11 @@
 #include <freetype/ftoutln.h>
 #include <freetype/internal/ftobjs.h>
 #include <freetype/ftbitmap.h>
+#include <freetype/ftsizes.h>
 #include "common/typed_text.h"
 #include "draw/draw_utils.h"
 #include "gfx_utils/file.h"
+#include "gfx_utils/graphic_math.h"
 #include "gfx_utils/graphic_log.h"
 #include "graphic_config.h"
 #include "securec.h"
@@ -28,6 +30,8 @@
 #endif
 
 namespace OHOS {
+constexpr uint8_t UIFontVector::SIZE_CACHE_MAX_NUM;
+
 UIFontVector::UIFontVector()
 {
 #ifdef _WIN32
@@ -44,15 +48,21 @@ UIFontVector::UIFontVector()
     freeTypeInited_ = ((FT_Init_FreeType(&ftLibrary_) == 0) ? true : false);
     SetBaseFontId(FONT_ID_MAX);
     bitmapCache_ = nullptr;
+    ClearFallbackCache();
 }
 
 UIFontVector::~UIFontVector()
 {
     if (freeTypeInited_) {
+        /* the size objects are freed with the library, they must not be freed again when unregistering below */
+        (void)memset_s(sizeCache_, sizeof(sizeCache_), 0, sizeof(sizeCache_));
         FT_Done_FreeType(ftLibrary_);
         freeTypeInited_ = false;
         UnregisterFontInfo(DEFAULT_VECTOR_FONT_FILENAME);
     }
+    for (uint8_t i = 0; i < FONT_ID_MAX; i++) {
+        delete coverages_[i];
+    }
     delete bitmapCache_;
 }
 
@@ -104,6 +114,7 @@ uint8_t UIFontVector::RegisterFontInfo(const char* ttfName, uint8_t shaping)
             fontInfo_[j].shaping = shaping;
             fontInfo_[j].ttfId = j;
             currentFontInfoNum_ = j + 1;
+            ClearFallbackCache();
             if (IsColorEmojiFont(ftFaces_[j])) {
                 SetupColorFont(ftFaces_[j]);
             }
@@ -155,8 +166,12 @@ uint8_t UIFontVector::UnregisterFontInfo(const char* ttfName)
         while (i < FONT_ID_MAX) {
             if ((fontInfo_[i].ttfName != nullptr) && !strncmp(fontInfo_[i].ttfName, ttfName, TTF_NAME_LEN_MAX)) {
                 fontInfo_[i].ttfName = nullptr;
+                ReleaseSizes(static_cast<uint8_t>(i));
                 FT_Done_Face(ftFaces_[i]);
                 ftFaces_[i] = nullptr;
+                delete coverages_[i];
+                coverages_[i] = nullptr;
+                ClearFallbackCache();
                 return static_cast<uint8_t>(i);
             }
             i++;
@@ -238,8 +253,7 @@ int8_t UIFontVector::SetCurrentFontId(uint8_t fontId, uint8_t size)
     }
     if (FT_IS_SCALABLE(ftFaces_[fontId])) {
         // Set the size
-        int32_t error = FT_Set_Char_Size(ftFaces_[fontId], size * FONT_PIXEL_IN_POINT, 0, 0, 0);
-        if (error != 0) {
+        if (ActivateSize(fontId, size) != RET_VALUE_OK) {
             return INVALID_RET_VALUE;
         }
     }
@@ -256,6 +270,106 @@ int8_t UIFontVector::SetCurrentFontId(uint8_t fontId, uint8_t size)
     return RET_VALUE_OK;
 }
 
+int8_t UIFontVector::ActivateSize(uint8_t fontId, uint8_t size)
+{
+    FT_Face face = ftFaces_[fontId];
+    if (sizeCacheNum_ == 0) {
+        return ScaleFace(face, size);
+    }
+    sizeCacheTick_++;
+    SizeEntry* victim = nullptr;
+    for (uint8_t i = 0; i < sizeCacheNum_; i++) {
+        SizeEntry& entry = sizeCache_[i];
+        if (entry.size == nullptr) {
+            if ((victim == nullptr) || (victim->size != nullptr)) {
+                victim = &entry;
+            }
+            continue;
+        }
+        if ((entry.fontId == fontId) && (entry.fontSize == size)) {
+            /* scaling a face is costly, hinted TrueType fonts even run their prep program for each new size */
+            entry.lastUse = sizeCacheTick_;
+            return (FT_Activate_Size(entry.size) == 0) ? RET_VALUE_OK : INVALID_RET_VALUE;
+        }
+        if ((victim == nullptr) || ((victim->size != nullptr) && (entry.lastUse < victim->lastUse))) {
+            victim = &entry;
+        }
+    }
+
+    if (victim->size != nullptr) {
+        /* the size of this face is replaced right below, another face has to keep its scale for fallback loads */
+        ReleaseSize(*victim, victim->fontId != fontId);
+    }
+    FT_Size ftSize = nullptr;
+    if (FT_New_Size(face, &ftSize) != 0) {
+        return INVALID_RET_VALUE;
+    }
+    if ((FT_Activate_Size(ftSize) != 0) || (ScaleFace(face, size) != RET_VALUE_OK)) {
+        FT_Done_Size(ftSize);
+        return INVALID_RET_VALUE;
+    }
+    victim->size = ftSize;
+    victim->lastUse = sizeCacheTick_;
+    victim->fontId = fontId;
+    victim->fontSize = size;
+    return RET_VALUE_OK;
+}
+
+void UIFontVector::ReleaseSize(SizeEntry& entry, bool keepScale)
+{
+    FT_Face face = ftFaces_[entry.fontId];
+    bool isActive = (face != nullptr) && (face->size == entry.size);
+    FT_Done_Size(entry.size);
+    entry.size = nullptr;
+    if (keepScale && isActive) {
+        /* FreeType falls back to the default size of the face, which is scaled to the released size again */
+        (void)ScaleFace(face, entry.fontSize);
+    }
+}
+
+int8_t UIFontVector::ScaleFace(FT_Face face, uint8_t size)
+{
+    sizeScaleCount_++;
+    return (FT_Set_Char_Size(face, size * FONT_PIXEL_IN_POINT, 0, 0, 0) == 0) ? RET_VALUE_OK : INVALID_RET_VALUE;
+}
+
+void UIFontVector::ReleaseSizes(uint8_t fontId)
+{
+    for (uint8_t i = 0; i < SIZE_CACHE_MAX_NUM; i++) {
+        if ((sizeCache_[i].size != nullptr) && (sizeCache_[i].fontId == fontId)) {
+            ReleaseSize(sizeCache_[i], false);
+        }
+    }
+}
+
+void UIFontVector::SetSizeCacheNum(uint8_t num)
+{
+    num = MATH_MIN(num, SIZE_CACHE_MAX_NUM);
+    for (uint8_t i = num; i < SIZE_CACHE_MAX_NUM; i++) {
+        if (sizeCache_[i].size != nullptr) {
+            ReleaseSize(sizeCache_[i], true);
+        }
+    }
+    sizeCacheNum_ = num;
+    /* the current size may have been released, so it is set up again */
+    uint32_t key = key_;
+    key_ = 0;
+    if (key != 0) {
+        SetCurrentFontId(static_cast<uint8_t>(key >> 24), static_cast<uint8_t>(key & 0xFF)); // 24: fontId bit
+    }
+}
+
+uint8_t UIFontVector::GetSizeCacheCount() const
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < SIZE_CACHE_MAX_NUM; i++) {
+        if (sizeCache_[i].size != nullptr) {
+            count++;
+        }
+    }
+    return count;
+}
+
 uint16_t UIFontVector::GetHeight()
 {
     uint8_t fontId_ = GetBaseFontId();
@@ -459,6 +573,61 @@ uint8_t* UIFontVector::GetBitmapSpannable(uint32_t unicode, GlyphNode& glyphNode
     return bitmap;
 }
 
+uint8_t* UIFontVector::GetRotatedBitmap(uint32_t unicode, int16_t angle, int16_t pivotY, GlyphNode& glyphNode)
+{
+    if (!freeTypeInited_ || (IsGlyphFont(unicode) != 0)) {
+        return nullptr;
+    }
+    /* the same face as LoadGlyphIntoFace picks for the unrotated glyph */
+    uint8_t fontId = FindFallbackFace(unicode, 0);
+    if ((fontId >= currentFontInfoNum_) || (ftFaces_[fontId] == nullptr)) {
+        return nullptr;
+    }
+    FT_Face face = ftFaces_[fontId];
+    /* clockwise on the screen, which is also clockwise with the y axis of FreeType pointing up */
+    float sinma = Sin(angle);
+    float cosma = Sin(QUARTER_IN_DEGREE - angle);
+    FT_Matrix matrix;
+    matrix.xx = static_cast<FT_Fixed>(cosma * FIXED_16_16_ONE);
+    matrix.xy = static_cast<FT_Fixed>(sinma * FIXED_16_16_ONE);
+    matrix.yx = -matrix.xy;
+    matrix.yy = matrix.xx;
+    /* moves the pivot back where it was before the rotation around the origin */
+    FT_Vector delta;
+    delta.x = static_cast<FT_Pos>(-sinma * pivotY * FONT_PIXEL_IN_POINT);
+    delta.y = static_cast<FT_Pos>((1 - cosma) * pivotY * FONT_PIXEL_IN_POINT);
+    FT_Set_Transform(face, &matrix, &delta);
+    /* embedded bitmaps cannot be transformed, so the outline is always rendered */
+    int32_t error = FT_Load_Glyph(face, FT_Get_Char_Index(face, unicode), FT_LOAD_NO_BITMAP);
+    if (error == 0) {
+        error = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL);
+    }
+    FT_Set_Transform(face, nullptr, nullptr);
+    FT_Bitmap& bitmap = face->glyph->bitmap;
+    if ((error != 0) || (bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) || (bitmap.pitch < 0) ||
+        (bitmap.width == 0) || (bitmap.rows == 0)) {
+        return nullptr;
+    }
+    uint8_t* coverage = new uint8_t[bitmap.width * bitmap.rows];
+    if (coverage == nullptr) {
+        GRAPHIC_LOGE("UIFontVector::GetRotatedBitmap new coverage fail");
+        return nullptr;
+    }
+    for (uint32_t row = 0; row < bitmap.rows; row++) {
+        if (memcpy_s(coverage + row * bitmap.width, bitmap.width, bitmap.buffer + row * bitmap.pitch,
+                     bitmap.width) != EOK) {
+            delete[] coverage;
+            return nullptr;
+        }
+    }
+    glyphNode.left = face->glyph->bitmap_left;
+    glyphNode.top = face->glyph->bitmap_top;
+    glyphNode.cols = bitmap.width;
+    glyphNode.rows = bitmap.rows;
+    glyphNode.advance = static_cast<uint16_t>(face->glyph->advance.x / FONT_PIXEL_IN_POINT);
+    return coverage;
+}
+
 bool UIFontVector::IsEmojiFont(uint8_t fontId)
 {
     return IsColorEmojiFont(ftFaces_[fontId]);
@@ -519,11 +688,9 @@ int8_t UIFontVector::LoadGlyphIntoFace(uint8_t& fontId, uint32_t unicode)
         error = FT_Load_Glyph(ftFaces_[fontId], unicode, FT_LOAD_RENDER);
         isHaveBitmap = true;
     } else {
-        for (uint8_t i = 0; i < currentFontInfoNum_; i++) {
+        uint8_t i = FindFallbackFace(unicode, 0);
+        for (; i < currentFontInfoNum_; i = FindFallbackFace(unicode, i + 1)) {
             uint32_t glyph_index = FT_Get_Char_Index(ftFaces_[i], unicode);
-            if (glyph_index == 0) {
-                continue;
-            }
             error = FT_Load_Glyph(ftFaces_[i], glyph_index, FT_LOAD_COLOR);
             if (error == RET_VALUE_OK) {
                 isHaveBitmap = true;
@@ -554,18 +721,14 @@ int8_t UIFontVector::LoadGlyphIntoFace(uint8_t& fontId, uint32_t unicode, TextSt
         error = FT_Load_Glyph(ftFaces_[fontId], unicode, FT_LOAD_NO_BITMAP);
         isHaveBitmap = true;
     } else {
-        for (uint8_t i = 0; i < currentFontInfoNum_; i++) {
-            if (ftFaces_[i] != nullptr) {
-                uint32_t glyph_index = FT_Get_Char_Index(ftFaces_[i], unicode);
-                if (glyph_index == 0) {
-                    continue;
-                }
-                error = FT_Load_Glyph(ftFaces_[i], glyph_index, FT_LOAD_COLOR);
-                if (error == RET_VALUE_OK) {
-                    fontId = i;
-                    isHaveBitmap = true;
-                    break;
-                }
+        uint8_t i = FindFallbackFace(unicode, 0);
+        for (; i < currentFontInfoNum_; i = FindFallbackFace(unicode, i + 1)) {
+            uint32_t glyph_index = FT_Get_Char_Index(ftFaces_[i], unicode);
+            error = FT_Load_Glyph(ftFaces_[i], glyph_index, FT_LOAD_COLOR);
+            if (error == RET_VALUE_OK) {
+                fontId = i;
+                isHaveBitmap = true;
+                break;
             }
         }
     }
@@ -590,6 +753,66 @@ int8_t UIFontVector::LoadGlyphIntoFace(uint8_t& fontId, uint32_t unicode, TextSt
 }
 #endif
 
+uint8_t UIFontVector::FindFallbackFace(uint32_t unicode, uint8_t start)
+{
+    /* most text repeats a few code points, so the first face of each is looked up once and then cached */
+    FallbackEntry* entry = nullptr;
+    if (start == 0) {
+        entry = &fallbackCache_[unicode % FALLBACK_CACHE_NUM];
+        if (entry->unicode == unicode) {
+            return entry->fontId;
+        }
+    }
+    uint8_t i = start;
+    while ((i < currentFontInfoNum_) && !HasGlyph(i, unicode)) {
+        i++;
+    }
+    if (entry != nullptr) {
+        entry->unicode = unicode;
+        entry->fontId = i;
+    }
+    return i;
+}
+
+bool UIFontVector::HasGlyph(uint8_t fontId, uint32_t unicode)
+{
+    if (ftFaces_[fontId] == nullptr) {
+        return false;
+    }
+    if (coverages_[fontId] == nullptr) {
+        /* built on the first fallback that reaches the face, most faces are never searched */
+        coverages_[fontId] = new UIFontCoverage();
+        if (coverages_[fontId] == nullptr) {
+            GRAPHIC_LOGE("UIFontVector::HasGlyph new coverage fail");
+            return FT_Get_Char_Index(ftFaces_[fontId], unicode) != 0;
+        }
+        (void)coverages_[fontId]->Build(ftFaces_[fontId]);
+    }
+    if (!coverages_[fontId]->IsBuilt()) {
+        return FT_Get_Char_Index(ftFaces_[fontId], unicode) != 0;
+    }
+    return coverages_[fontId]->Has(unicode);
+}
+
+void UIFontVector::ClearFallbackCache()
+{
+    for (uint8_t i = 0; i < FALLBACK_CACHE_NUM; i++) {
+        fallbackCache_[i].unicode = UINT32_MAX; // UINT32_MAX: no code point
+        fallbackCache_[i].fontId = FONT_INVALID_TTF_ID;
+    }
+}
+
+uint32_t UIFontVector::GetCoverageSize() const
+{
+    uint32_t size = sizeof(fallbackCache_);
+    for (uint8_t i = 0; i < FONT_ID_MAX; i++) {
+        if (coverages_[i] != nullptr) {
+            size += coverages_[i]->GetSize();
+        }
+    }
+    return size;
+}
+
 uint8_t UIFontVector::IsGlyphFont(uint32_t unicode)
 {
     uint8_t unicodeFontId = GetFontId(unicode);
@@ -89,6 +89,10 @@ RetCode FileImgDecoder::GetHeader(ImgResDsc& dsc)
 
 RetCode FileImgDecoder::ReadLine(ImgResDsc& dsc, const Point& start, int16_t len, uint8_t* buf)
 {
+    /* the rows of a row-indexed image are not at fixed positions in the file */
+    if (dsc.imgInfo.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+        return RetCode::FAIL;
+    }
     if (IsImgValidMode(dsc.imgInfo.header.colorMode)) {
         return ReadLineTrueColor(dsc, start, len, buf);
     }
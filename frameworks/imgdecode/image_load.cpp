@@ -17,6 +17,7 @@
 #include "gfx_utils/file.h"
 #include "gfx_utils/graphic_log.h"
 #include "gfx_utils/mem_api.h"
+#include "imgdecode/row_rle_image.h"
 
 namespace {
 const uint8_t BITMAP_ZIP_LEN = 3;
@@ -185,11 +186,33 @@ bool ImageLoad::UnZip2ImageInfo(ImageInfo& imageInfo, uint8_t* buffer, uint32_t
     }
 }
 
+bool ImageLoad::LoadRowRleImage(int32_t fd, uint32_t size, ImageInfo& imageInfo)
+{
+    /* the compressed data is the image in the cache, DrawImage decodes the visible rows straight into the buffer */
+    imageInfo.dataSize = size;
+    imageInfo.data = static_cast<uint8_t*>(ImageCacheMalloc(imageInfo));
+    if (imageInfo.data == nullptr) {
+        GRAPHIC_LOGE("ImageCacheMalloc error.");
+        return false;
+    }
+    if ((read(fd, const_cast<uint8_t*>(imageInfo.data), size) != static_cast<int32_t>(size)) ||
+        !RowRleImage::Check(imageInfo)) {
+        GRAPHIC_LOGE("LoadRowRleImage invalid data.");
+        ImageCacheFree(imageInfo);
+        imageInfo.data = nullptr;
+        return false;
+    }
+    return true;
+}
+
 bool ImageLoad::GetImageInfo(int32_t fd, uint32_t size, ImageInfo& imageInfo)
 {
     if (size == 0) {
         return false;
     }
+    if (imageInfo.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+        return LoadRowRleImage(fd, size, imageInfo);
+    }
 
     uint8_t* buffer = reinterpret_cast<uint8_t*>(UIMalloc(size));
     if (buffer == nullptr) {
@@ -24,6 +24,8 @@ enum CompressMode : uint8_t {
     COMPRESS_MODE__ZIP_ALG,
     COMPRESS_MODE_BITMAP_ALG,
     COMPRESS_MODE_BLOCK_ALG,
+    /* run-length encoded rows behind a row offset table, kept compressed in memory, see RowRleImage */
+    COMPRESS_MODE_ROW_RLE_ALG,
 };
 
 class ImageLoad {
@@ -34,6 +36,7 @@ private:
     ImageLoad() = delete;
     ~ImageLoad() = delete;
 
+    static bool LoadRowRleImage(int32_t fd, uint32_t size, ImageInfo& imageInfo);
     static bool UnZip2ImageInfo(ImageInfo& imageInfo, uint8_t* buffer, uint32_t size);
     static bool UncompressImageInZip(ImageInfo& imageInfo, uint8_t* buffer, uint32_t size);
     static bool CreateImage(ImageInfo& imageInfo);
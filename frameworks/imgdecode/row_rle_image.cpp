@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/row_rle_image.h"
+#include "gfx_utils/graphic_math.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+/* appends len bytes to out, or only counts them when out is nullptr */
+bool Put(uint8_t* out, uint32_t outSize, uint32_t& size, const void* src, uint32_t len)
+{
+    if (out != nullptr) {
+        if ((outSize < size) || (outSize - size < len) || (memcpy_s(out + size, outSize - size, src, len) != EOK)) {
+            return false;
+        }
+    }
+    size += len;
+    return true;
+}
+} // namespace
+
+uint8_t RowRleImage::GetByteSize(uint8_t colorMode)
+{
+    switch (colorMode) {
+        case ARGB8888:
+            return 4; // 4 bytes per pixel
+        case RGB888:
+            return 3; // 3 bytes per pixel
+        case RGB565:
+            return 2; // 2 bytes per pixel
+        default:
+            return 0;
+    }
+}
+
+bool RowRleImage::Check(const ImageInfo& info)
+{
+    uint16_t height = info.header.height;
+    if ((info.data == nullptr) || (GetByteSize(info.header.colorMode) == 0) || (height == 0)) {
+        return false;
+    }
+    uint32_t tableSize = static_cast<uint32_t>(height) * sizeof(uint32_t);
+    if (info.dataSize < tableSize) {
+        return false;
+    }
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(info.data);
+    uint32_t prev = tableSize;
+    for (uint16_t y = 0; y < height; y++) {
+        if ((table[y] < prev) || (table[y] > info.dataSize)) {
+            return false;
+        }
+        prev = table[y];
+    }
+    return true;
+}
+
+const uint8_t* RowRleImage::GetRow(const ImageInfo& info, int16_t y, const uint8_t*& rowEnd)
+{
+    uint16_t height = info.header.height;
+    if ((info.data == nullptr) || (y < 0) || (y >= height)) {
+        return nullptr;
+    }
+    const uint32_t* table = reinterpret_cast<const uint32_t*>(info.data);
+    rowEnd = info.data + ((y + 1 < height) ? table[y + 1] : info.dataSize);
+    return info.data + table[y];
+}
+
+bool RowRleImage::NextPacket(const uint8_t*& pos, const uint8_t* rowEnd, uint8_t byteSize, Packet& packet)
+{
+    if (pos >= rowEnd) {
+        return false;
+    }
+    uint8_t head = *pos++;
+    packet.run = ((head & RUN_FLAG) != 0);
+    packet.count = (head & ~RUN_FLAG) + 1;
+    uint32_t bytes = packet.run ? byteSize : static_cast<uint32_t>(packet.count) * byteSize;
+    if (static_cast<uint32_t>(rowEnd - pos) < bytes) {
+        return false;
+    }
+    packet.pixels = pos;
+    pos += bytes;
+    return true;
+}
+
+bool RowRleImage::DecodeRow(const ImageInfo& info, int16_t y, int16_t x, int16_t len, uint8_t* buf)
+{
+    uint8_t byteSize = GetByteSize(info.header.colorMode);
+    const uint8_t* rowEnd = nullptr;
+    const uint8_t* pos = GetRow(info, y, rowEnd);
+    if ((pos == nullptr) || (byteSize == 0) || (buf == nullptr) || (x < 0) || (len <= 0)) {
+        return false;
+    }
+    int16_t last = x + len;
+    int16_t cur = 0;
+    Packet packet;
+    while ((cur < last) && NextPacket(pos, rowEnd, byteSize, packet)) {
+        int16_t from = MATH_MAX(cur, x);
+        int16_t to = MATH_MIN(cur + packet.count, last);
+        for (int16_t i = from; i < to; i++) {
+            const uint8_t* src = packet.run ? packet.pixels : (packet.pixels + (i - cur) * byteSize);
+            if (memcpy_s(buf, byteSize, src, byteSize) != EOK) {
+                return false;
+            }
+            buf += byteSize;
+        }
+        cur += packet.count;
+    }
+    return cur >= last;
+}
+
+uint16_t RowRleImage::GetRunLength(const uint8_t* pixel, uint16_t num, uint8_t byteSize)
+{
+    uint16_t run = 1;
+    uint16_t max = MATH_MIN(num, MAX_PACKET_PIXELS);
+    while ((run < max) && (memcmp(pixel, pixel + run * byteSize, byteSize) == 0)) {
+        run++;
+    }
+    return run;
+}
+
+uint32_t RowRleImage::Encode(const uint8_t* pixels, uint16_t width, uint16_t height, uint8_t colorMode, uint8_t* out,
+                             uint32_t outSize)
+{
+    uint8_t byteSize = GetByteSize(colorMode);
+    if ((pixels == nullptr) || (byteSize == 0) || (width == 0) || (height == 0)) {
+        return 0;
+    }
+    uint32_t size = static_cast<uint32_t>(height) * sizeof(uint32_t);
+    if ((out != nullptr) && (outSize < size)) {
+        return 0;
+    }
+    for (uint16_t y = 0; y < height; y++) {
+        uint32_t tableSize = y * sizeof(uint32_t);
+        if ((out != nullptr) && !Put(out, outSize, tableSize, &size, sizeof(uint32_t))) {
+            return 0;
+        }
+        const uint8_t* row = pixels + static_cast<uint32_t>(y) * width * byteSize;
+        uint16_t x = 0;
+        while (x < width) {
+            uint16_t count = GetRunLength(row + x * byteSize, width - x, byteSize);
+            uint8_t head;
+            uint32_t bytes;
+            if (count > 1) {
+                head = RUN_FLAG | static_cast<uint8_t>(count - 1);
+                bytes = byteSize;
+            } else {
+                /* a literal ends where two equal pixels start a run */
+                while ((x + count < width) && (count < MAX_PACKET_PIXELS) &&
+                       (GetRunLength(row + (x + count) * byteSize, width - x - count, byteSize) < 2)) { // 2: a run
+                    count++;
+                }
+                head = static_cast<uint8_t>(count - 1);
+                bytes = static_cast<uint32_t>(count) * byteSize;
+            }
+            if (!Put(out, outSize, size, &head, 1) || !Put(out, outSize, size, row + x * byteSize, bytes)) {
+                return 0;
+            }
+            x += count;
+        }
+    }
+    return size;
+}
+} // namespace OHOS
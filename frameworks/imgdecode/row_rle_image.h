@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_ROW_RLE_IMAGE_H
+#define GRAPHIC_LITE_ROW_RLE_IMAGE_H
+
+#include "gfx_utils/image_info.h"
+
+namespace OHOS {
+/**
+ * Data of an image in COMPRESS_MODE_ROW_RLE_ALG. The image stays compressed in memory and is drawn row by row, so
+ * only the rows and columns of the dirty area are decoded.
+ *
+ * The data starts with one uint32_t offset per row, from the start of the data to the row. A row is a list of
+ * packets covering exactly the width of the image. A packet starts with one byte: with RUN_FLAG set, the next pixel
+ * repeats (byte & ~RUN_FLAG) + 1 times, otherwise byte + 1 pixels follow. Pixels are stored in the color mode of the
+ * image, ARGB8888, RGB888 or RGB565, in the byte order of an uncompressed image.
+ */
+class RowRleImage {
+public:
+    static constexpr uint8_t RUN_FLAG = 0x80;
+    static constexpr uint8_t MAX_PACKET_PIXELS = 128;
+
+    struct Packet {
+        const uint8_t* pixels;
+        int16_t count;
+        bool run;
+    };
+
+    /* Returns the bytes per pixel of a supported color mode, or 0. */
+    static uint8_t GetByteSize(uint8_t colorMode);
+
+    /* Checks the offset table of the data, the packets are checked while they are read. */
+    static bool Check(const ImageInfo& info);
+
+    /* Returns the first packet of row y and the end of the row. */
+    static const uint8_t* GetRow(const ImageInfo& info, int16_t y, const uint8_t*& rowEnd);
+
+    /* Reads the packet at pos and moves pos to the next one. Returns false at the end of the row or on bad data. */
+    static bool NextPacket(const uint8_t*& pos, const uint8_t* rowEnd, uint8_t byteSize, Packet& packet);
+
+    /* Decodes len pixels of row y from x into buf. */
+    static bool DecodeRow(const ImageInfo& info, int16_t y, int16_t x, int16_t len, uint8_t* buf);
+
+    /*
+     * Compresses pixels of an uncompressed image into out, without the image header. Returns the size of the data, or
+     * 0 if out is too small. With out nullptr, only the size is returned.
+     */
+    static uint32_t Encode(const uint8_t* pixels, uint16_t width, uint16_t height, uint8_t colorMode, uint8_t* out,
+                           uint32_t outSize);
+
+private:
+    RowRleImage() = delete;
+    ~RowRleImage() = delete;
+
+    static uint16_t GetRunLength(const uint8_t* pixel, uint16_t num, uint8_t byteSize);
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_ROW_RLE_IMAGE_H
@@ -15,491 +15,408 @@
 
 #include "layout/flex_layout.h"
 
+#include <cstdint>
+
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
+
 namespace OHOS {
+FlexLayout::~FlexLayout()
+{
+    delete[] childCache_;
+    delete[] lines_;
+    delete[] prevLines_;
+}
+
 void FlexLayout::LayoutChildren(bool needInvalidate)
 {
     if (childrenHead_ == nullptr) {
         return;
     }
 
-    if ((direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R)) {
-        LayoutHorizontal();
-    } else {
-        LayoutVertical();
+    uint16_t start = UpdateCache();
+    if (start < cachedChildNum_) {
+        if ((direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R)) {
+            LayoutHorizontal(start);
+        } else {
+            LayoutVertical(start);
+        }
+    }
+    /* nested layouts keep their own cache, so this is cheap when nothing inside them changed */
+    for (uint16_t i = 0; i < cachedChildNum_; i++) {
+        if (childCache_[i].visible) {
+            childCache_[i].view->LayoutChildren();
+        }
     }
     if (needInvalidate) {
         Invalidate();
     }
 }
 
-void FlexLayout::GetStartPos(const int16_t& length,
-                             int16_t& pos,
-                             int16_t& interval,
-                             int16_t count,
-                             uint16_t* validLengths,
-                             uint16_t* childsNum)
+bool FlexLayout::ReserveCache(uint16_t childNum)
 {
-    if (!validLengths || !childsNum) {
-        return;
+    if (childNum < cacheCapacity_) {
+        return true;
     }
-    pos = 0;
-    interval = 0;
-
-    if (majorAlign_ == ALIGN_START) {
-        pos = 0;
-    } else if (majorAlign_ == ALIGN_END) {
-        pos = length - validLengths[count];
-        /* if total length of children is too long or only one child, layout them centerly no matter what key word set.
-         */
-    } else if ((majorAlign_ == ALIGN_CENTER) || (validLengths[count] >= length) || (childsNum[count] == 1)) {
-        pos = (length - validLengths[count]) / 2; // 2: half
-    } else if (majorAlign_ == ALIGN_AROUND) {
-        if (childsNum[count] == 0) {
-            return;
-        }
-        interval = (length - validLengths[count]) / childsNum[count];
-        pos = interval / 2; // 2: half
-    } else if (majorAlign_ == ALIGN_EVENLY) {
-        interval = (length - validLengths[count]) / (childsNum[count] + 1);
-        pos = interval;
-    } else {
-        if (childsNum[count] == 1) {
-            return;
-        }
-        interval = (length - validLengths[count]) / (childsNum[count] - 1);
-        pos = 0;
+    delete[] childCache_;
+    delete[] lines_;
+    delete[] prevLines_;
+    uint16_t oldCapacity = cacheCapacity_;
+    cacheValid_ = false;
+    cachedChildNum_ = 0;
+    cacheCapacity_ = 0;
+
+    /* one more entry keeps the layout state after the last child, so appended children can be placed alone */
+    uint32_t capacity = MATH_MAX(static_cast<uint32_t>(childNum) + 1, static_cast<uint32_t>(oldCapacity) << 1);
+    capacity = MATH_MIN(capacity, UINT16_MAX);
+    childCache_ = new ChildCache[capacity]();
+    lines_ = new LineInfo[capacity];
+    prevLines_ = new LineInfo[capacity];
+    if ((childCache_ == nullptr) || (lines_ == nullptr) || (prevLines_ == nullptr)) {
+        GRAPHIC_LOGE("FlexLayout::ReserveCache new failed");
+        delete[] childCache_;
+        delete[] lines_;
+        delete[] prevLines_;
+        childCache_ = nullptr;
+        lines_ = nullptr;
+        prevLines_ = nullptr;
+        return false;
     }
+    uint32_t size = capacity * sizeof(LineInfo);
+    if ((memset_s(lines_, size, 0, size) != EOK) || (memset_s(prevLines_, size, 0, size) != EOK)) {
+        return false;
+    }
+    cacheCapacity_ = capacity;
+    return true;
 }
 
-void FlexLayout::GetNoWrapStartPos(const int16_t& length, int16_t& majorPos, int16_t& interval)
-{
-    uint16_t childrenNum = 0;
-    uint16_t totalValidLength = 0;
-
-    CalValidLength(totalValidLength, childrenNum);
-    GetStartPos(length, majorPos, interval, 0, &totalValidLength, &childrenNum);
-}
-
-void FlexLayout::GetRowStartPos(int16_t& pos,
-                                int16_t& interval,
-                                int16_t count,
-                                uint16_t* rowsWidth,
-                                uint16_t* rowsChildNum)
-{
-    GetStartPos(GetWidth(), pos, interval, count, rowsWidth, rowsChildNum);
-}
-
-void FlexLayout::GetColumnStartPos(int16_t& pos,
-                                   int16_t& interval,
-                                   int16_t count,
-                                   uint16_t* columnsHeight,
-                                   uint16_t* columnsChildNum)
+uint16_t FlexLayout::UpdateCache()
 {
-    GetStartPos(GetHeight(), pos, interval, count, columnsHeight, columnsChildNum);
-}
+    uint16_t childNum = 0;
+    for (UIView* child = childrenHead_; child != nullptr; child = child->GetNextSibling()) {
+        childNum++;
+    }
+    if (!ReserveCache(childNum)) {
+        cachedChildNum_ = 0;
+        return 0;
+    }
 
-void FlexLayout::CalValidLength(uint16_t& totalValidLength, uint16_t& allChildNum)
-{
-    UIView* child = childrenHead_;
-    int16_t left;
-    int16_t right;
-    int16_t top;
-    int16_t bottom;
+    uint16_t firstChanged = MATH_MIN(childNum, cachedChildNum_);
+    if (!cacheValid_ || (cachedWidth_ != GetWidth()) || (cachedHeight_ != GetHeight()) ||
+        (cachedDirection_ != direction_) || (cachedMajorAlign_ != majorAlign_) ||
+        (cachedSecondaryAlign_ != secondaryAlign_) || (cachedWrap_ != wrap_)) {
+        firstChanged = 0;
+    }
 
-    /* calculate valid length of all children views */
-    while (child != nullptr) {
-        if (child->IsVisible()) {
+    uint16_t index = 0;
+    for (UIView* child = childrenHead_; child != nullptr; child = child->GetNextSibling()) {
+        ChildCache& item = childCache_[index];
+        bool visible = child->IsVisible();
+        int16_t width = 0;
+        int16_t height = 0;
+        int16_t marginLeft = 0;
+        int16_t marginRight = 0;
+        int16_t marginTop = 0;
+        int16_t marginBottom = 0;
+        if (visible) {
             child->ReMeasure();
-            if ((direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R)) {
-                left = child->GetStyle(STYLE_MARGIN_LEFT);
-                right = child->GetStyle(STYLE_MARGIN_RIGHT);
-                totalValidLength += (child->GetRelativeRect().GetWidth() + left + right);
-            } else {
-                top = child->GetStyle(STYLE_MARGIN_TOP);
-                bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-                totalValidLength += (child->GetRelativeRect().GetHeight() + top + bottom);
+            width = child->GetRelativeRect().GetWidth();
+            height = child->GetRelativeRect().GetHeight();
+            marginLeft = child->GetStyle(STYLE_MARGIN_LEFT);
+            marginRight = child->GetStyle(STYLE_MARGIN_RIGHT);
+            marginTop = child->GetStyle(STYLE_MARGIN_TOP);
+            marginBottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
+        }
+        if (index < firstChanged) {
+            bool changed = (item.view != child) || (item.visible != visible) || (item.width != width) ||
+                           (item.height != height) || (item.marginLeft != marginLeft) ||
+                           (item.marginRight != marginRight) || (item.marginTop != marginTop) ||
+                           (item.marginBottom != marginBottom);
+            /* a child moved by someone else has to be placed again, just like a resized one */
+            changed = changed || (visible && ((item.x != child->GetX()) || (item.y != child->GetY())));
+            if (changed) {
+                firstChanged = index;
             }
-            allChildNum++;
         }
-        child = child->GetNextSibling();
+        item.view = child;
+        item.visible = visible;
+        item.width = width;
+        item.height = height;
+        item.marginLeft = marginLeft;
+        item.marginRight = marginRight;
+        item.marginTop = marginTop;
+        item.marginBottom = marginBottom;
+        index++;
     }
-}
 
-void FlexLayout::CalRowCount()
-{
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t left;
-    int16_t right;
-
-    rowCount_ = 1;
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            child->ReMeasure();
-            left = child->GetStyle(STYLE_MARGIN_LEFT);
-            right = child->GetStyle(STYLE_MARGIN_RIGHT);
-            pos += left;
-            if ((pos + child->GetRelativeRect().GetWidth() + right) > GetWidth()) {
-                pos = left;
-                rowCount_++;
-            }
-            pos += child->GetRelativeRect().GetWidth() + right;
+    /* the start positions and intervals depend on every child, so a change there moves all of them */
+    uint16_t prevLineCount = ((direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R)) ? rowCount_ : columnCount_;
+    LineInfo* lines = prevLines_;
+    prevLines_ = lines_;
+    lines_ = lines;
+    uint32_t size = (childNum + 1) * sizeof(LineInfo);
+    if (memset_s(lines_, size, 0, size) != EOK) {
+        return 0;
+    }
+    CalLines(childNum);
+    bool horizontal = (direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R);
+    int16_t length = horizontal ? GetWidth() : GetHeight();
+    /* the placing loop may wrap more often than the lines counted, so every entry gets a start position */
+    for (uint16_t i = 0; i <= childNum; i++) {
+        GetStartPos(length, lines_[i].startPos, lines_[i].interval, i);
+    }
+    uint16_t lineCount = horizontal ? rowCount_ : columnCount_;
+    if (lineCount != prevLineCount) {
+        firstChanged = 0;
+    }
+    for (uint16_t i = 0; (i <= childNum) && (firstChanged != 0); i++) {
+        if ((lines_[i].cross != prevLines_[i].cross) || (lines_[i].startPos != prevLines_[i].startPos) ||
+            (lines_[i].interval != prevLines_[i].interval)) {
+            firstChanged = 0;
         }
-        child = child->GetNextSibling();
     }
+
+    cacheValid_ = true;
+    cachedChildNum_ = childNum;
+    cachedWidth_ = GetWidth();
+    cachedHeight_ = GetHeight();
+    cachedDirection_ = direction_;
+    cachedMajorAlign_ = majorAlign_;
+    cachedSecondaryAlign_ = secondaryAlign_;
+    cachedWrap_ = wrap_;
+    return firstChanged;
 }
 
-void FlexLayout::GetRowMaxHeight(uint16_t size, uint16_t* maxRosHegiht)
+void FlexLayout::CalLines(uint16_t childNum)
 {
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t left;
-    int16_t right;
-    int16_t top;
-    int16_t bottom;
-    uint16_t i = 0;
-    uint16_t height = 0;
-
-    if ((maxRosHegiht == nullptr) || (size > rowCount_)) {
+    bool horizontal = (direction_ == LAYOUT_HOR) || (direction_ == LAYOUT_HOR_R);
+    if (wrap_ != WRAP) {
+        /* one line holding every visible child, the secondary axis sizes are not used */
+        for (uint16_t i = 0; i < childNum; i++) {
+            const ChildCache& item = childCache_[i];
+            if (!item.visible) {
+                continue;
+            }
+            if (horizontal) {
+                lines_[0].length += (item.width + item.marginLeft + item.marginRight);
+            } else {
+                lines_[0].length += (item.height + item.marginTop + item.marginBottom);
+            }
+            lines_[0].childNum++;
+        }
         return;
     }
 
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            left = child->GetStyle(STYLE_MARGIN_LEFT);
-            right = child->GetStyle(STYLE_MARGIN_RIGHT);
-            top = child->GetStyle(STYLE_MARGIN_TOP);
-            bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-            pos += left;
-            if ((pos + child->GetRelativeRect().GetWidth() + right) > GetWidth()) {
-                pos = left;
-                maxRosHegiht[i] = height;
-                height = 0;
-                i++;
+    int16_t pos = 0;
+    int16_t crossPos = 0;
+    uint16_t line = 0;
+    uint16_t crossLine = 0;
+    uint16_t length = 0;
+    uint16_t cross = 0;
+    uint16_t lineChildNum = 0;
+    for (uint16_t i = 0; i < childNum; i++) {
+        const ChildCache& item = childCache_[i];
+        if (!item.visible) {
+            continue;
+        }
+        if (horizontal) {
+            pos += item.marginLeft;
+            if ((pos + item.width + item.marginRight) > GetWidth()) {
+                pos = item.marginLeft;
+                line++;
+                length = 0;
+                cross = 0;
+                lineChildNum = 0;
+            }
+            length += item.width + item.marginRight + item.marginLeft;
+            cross = MATH_MAX(cross, item.height + item.marginTop + item.marginBottom);
+            lines_[line].cross = cross;
+            pos += item.width + item.marginRight;
+        } else {
+            pos += item.marginTop;
+            if ((pos + item.height + item.marginBottom) > GetHeight()) {
+                pos = item.marginTop;
+                line++;
+                length = 0;
+                lineChildNum = 0;
             }
-            height = MATH_MAX(height, child->GetRelativeRect().GetHeight() + top + bottom);
-            maxRosHegiht[i] = height;
-            pos += child->GetRelativeRect().GetWidth() + right;
+            length += item.height + item.marginTop + item.marginBottom;
+            pos += item.height + item.marginBottom;
+            /* the widest child of a column is searched with the left margin as start of the column */
+            crossPos += item.marginLeft;
+            if ((crossPos + item.height + item.marginBottom) > GetHeight()) {
+                crossPos = item.marginLeft;
+                crossLine++;
+                cross = 0;
+            }
+            cross = MATH_MAX(cross, item.width + item.marginLeft + item.marginRight);
+            lines_[crossLine].cross = cross;
+            crossPos += item.height + item.marginBottom;
         }
-        child = child->GetNextSibling();
+        lineChildNum++;
+        lines_[line].length = length;
+        lines_[line].childNum = lineChildNum;
+    }
+    if (horizontal) {
+        rowCount_ = line + 1;
+    } else {
+        columnCount_ = line + 1;
     }
 }
 
-void FlexLayout::GetRowsWidth(uint16_t rowNum, uint16_t* rowsWidth, uint16_t* rowsChildNum)
+void FlexLayout::GetStartPos(const int16_t& length, int16_t& pos, int16_t& interval, uint16_t count)
 {
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t left;
-    int16_t right;
-    uint16_t rowChildNum = 0;
-    uint16_t rowCount = 0;
-    uint16_t width = 0;
-
-    if ((rowsWidth == nullptr) || (rowsChildNum == nullptr) || (rowNum > rowCount_)) {
-        return;
-    }
+    uint16_t validLength = lines_[count].length;
+    uint16_t childNum = lines_[count].childNum;
+    pos = 0;
+    interval = 0;
 
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            left = child->GetStyle(STYLE_MARGIN_LEFT);
-            right = child->GetStyle(STYLE_MARGIN_RIGHT);
-            pos += left;
-            if ((pos + child->GetRelativeRect().GetWidth() + right) > GetWidth()) {
-                pos = left;
-                rowsWidth[rowCount] = width;
-                width = 0;
-                rowsChildNum[rowCount] = rowChildNum;
-                rowChildNum = 0;
-                rowCount++;
-            }
-            width += child->GetRelativeRect().GetWidth() + right + left;
-            rowsWidth[rowCount] = width;
-            rowChildNum++;
-            rowsChildNum[rowCount] = rowChildNum;
-            pos += child->GetRelativeRect().GetWidth() + right;
+    if (majorAlign_ == ALIGN_START) {
+        pos = 0;
+    } else if (majorAlign_ == ALIGN_END) {
+        pos = length - validLength;
+        /* if total length of children is too long or only one child, layout them centerly no matter what key word set.
+         */
+    } else if ((majorAlign_ == ALIGN_CENTER) || (validLength >= length) || (childNum == 1)) {
+        pos = (length - validLength) / 2; // 2: half
+    } else if (majorAlign_ == ALIGN_AROUND) {
+        if (childNum == 0) {
+            return;
+        }
+        interval = (length - validLength) / childNum;
+        pos = interval / 2; // 2: half
+    } else if (majorAlign_ == ALIGN_EVENLY) {
+        interval = (length - validLength) / (childNum + 1);
+        pos = interval;
+    } else {
+        if (childNum == 1) {
+            return;
         }
-        child = child->GetNextSibling();
+        interval = (length - validLength) / (childNum - 1);
+        pos = 0;
     }
 }
 
-void FlexLayout::GetCrossAxisPosY(int16_t& posY, uint16_t& count, uint16_t* rowsMaxHeight, UIView* child)
+void FlexLayout::GetCrossAxisPos(int16_t length,
+                                 int16_t& pos,
+                                 uint16_t count,
+                                 uint16_t lineNum,
+                                 int16_t size,
+                                 int16_t startMargin,
+                                 int16_t endMargin)
 {
-    if ((rowsMaxHeight == nullptr) || (child == nullptr)) {
-        return;
-    }
-
     uint16_t i = 0;
     uint16_t offset = 0;
-    int16_t top = child->GetStyle(STYLE_MARGIN_TOP);
-    int16_t bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
 
     if (secondaryAlign_ == ALIGN_START) {
         for (i = 0; i < count; i++) {
-            offset += rowsMaxHeight[i];
+            offset += lines_[i].cross;
         }
-        posY = top + offset;
+        pos = startMargin + offset;
     } else if (secondaryAlign_ == ALIGN_END) {
-        for (i = rowCount_ - 1; i > count; i--) {
-            offset += rowsMaxHeight[i];
+        for (i = lineNum - 1; i > count; i--) {
+            offset += lines_[i].cross;
         }
-        posY = GetHeight() - child->GetRelativeRect().GetHeight() - bottom - offset;
+        pos = length - size - endMargin - offset;
     } else {
-        for (i = 0; i < rowCount_; i++) {
-            offset += rowsMaxHeight[i];
+        for (i = 0; i < lineNum; i++) {
+            offset += lines_[i].cross;
         }
-        offset = (rowsMaxHeight[0] - offset) / 2; // 2: half
+        offset = (lines_[0].cross - offset) / 2; // 2: half
         for (i = 1; i <= count; i++) {
-            offset += (rowsMaxHeight[i - 1] + rowsMaxHeight[i]) / 2; // 2: half
+            offset += (lines_[i - 1].cross + lines_[i].cross) / 2; // 2: half
         }
-        posY = (GetHeight() - child->GetRelativeRect().GetHeight() - top - bottom) / 2 + top + offset; // 2: half
+        pos = (length - size - startMargin - endMargin) / 2 + startMargin + offset; // 2: half
     }
 }
 
-void FlexLayout::LayoutHorizontal()
+void FlexLayout::LayoutHorizontal(uint16_t start)
 {
-    UIView* child = childrenHead_;
     int16_t interval = 0;
     int16_t posX = 0;
     int16_t posY = 0;
     uint16_t count = 0;
-    uint16_t widthsBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t maxHeightsBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t childsNumBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t* rowsWidth = widthsBuf;
-    uint16_t* rowsMaxHeight = maxHeightsBuf;
-    uint16_t* rowsChildNum = childsNumBuf;
-    bool allocFlag = false;
+    uint16_t lineNum = (wrap_ == WRAP) ? rowCount_ : 1;
 
-    if (wrap_ == WRAP) {
-        CalRowCount();
-        if (rowCount_ > MAX_COUNT_DEFAULT) {
-            rowsWidth = new uint16_t[rowCount_]();
-            rowsMaxHeight = new uint16_t[rowCount_]();
-            rowsChildNum = new uint16_t[rowCount_]();
-            allocFlag = true;
-        }
-        GetRowMaxHeight(rowCount_, rowsMaxHeight);
-        GetRowsWidth(rowCount_, rowsWidth, rowsChildNum);
-        GetRowStartPos(posX, interval, count, rowsWidth, rowsChildNum);
+    if (start == 0) {
+        posX = lines_[count].startPos;
+        interval = lines_[count].interval;
     } else {
-        GetNoWrapStartPos(GetWidth(), posX, interval);
-    }
-
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            int16_t left = child->GetStyle(STYLE_MARGIN_LEFT);
-            int16_t right = child->GetStyle(STYLE_MARGIN_RIGHT);
-            posX += left;
-            if (((posX + child->GetRelativeRect().GetWidth() + right) > GetWidth()) && (wrap_ == WRAP)) {
-                GetRowStartPos(posX, interval, ++count, rowsWidth, rowsChildNum);
-                posX += left;
-            }
-
-            GetCrossAxisPosY(posY, count, rowsMaxHeight, child);
-            if (direction_ == LAYOUT_HOR_R) {
-                child->SetPosition(GetWidth() - posX - child->GetRelativeRect().GetWidth() - right,
-                                   posY - child->GetStyle(STYLE_MARGIN_TOP));
-            } else {
-                child->SetPosition(posX - left, posY - child->GetStyle(STYLE_MARGIN_TOP));
-            }
-            posX += child->GetRelativeRect().GetWidth() + right + interval;
-            child->LayoutChildren();
-        }
-        child = child->GetNextSibling();
-    }
-
-    if (allocFlag) {
-        delete[] rowsWidth;
-        delete[] rowsMaxHeight;
-        delete[] rowsChildNum;
-    }
-}
-
-void FlexLayout::CalColumnCount()
-{
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t top;
-    int16_t bottom;
-
-    columnCount_ = 1;
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            child->ReMeasure();
-            top = child->GetStyle(STYLE_MARGIN_TOP);
-            bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-            pos += top;
-            if ((pos + child->GetRelativeRect().GetHeight() + bottom) > GetHeight()) {
-                pos = top;
-                columnCount_++;
-            }
-            pos += child->GetRelativeRect().GetHeight() + bottom;
-        }
-        child = child->GetNextSibling();
-    }
-}
-
-void FlexLayout::GetColumnMaxWidth(uint16_t size, uint16_t* maxColumnsWidth)
-{
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t left;
-    int16_t right;
-    int16_t bottom;
-    uint16_t i = 0;
-    uint16_t width = 0;
-
-    if ((maxColumnsWidth == nullptr) || (size > columnCount_)) {
-        return;
+        posX = childCache_[start].majorPos;
+        interval = childCache_[start].interval;
+        count = childCache_[start].line;
     }
 
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            left = child->GetStyle(STYLE_MARGIN_LEFT);
-            right = child->GetStyle(STYLE_MARGIN_RIGHT);
-            bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-            pos += left;
-            if ((pos + child->GetRelativeRect().GetHeight() + bottom) > GetHeight()) {
-                pos = left;
-                maxColumnsWidth[i] = width;
-                width = 0;
-                i++;
-            }
-            width = MATH_MAX(width, child->GetRelativeRect().GetWidth() + left + right);
-            maxColumnsWidth[i] = width;
-            pos += child->GetRelativeRect().GetHeight() + bottom;
+    for (uint16_t i = start; i <= cachedChildNum_; i++) {
+        ChildCache& item = childCache_[i];
+        item.majorPos = posX;
+        item.interval = interval;
+        item.line = count;
+        if ((i == cachedChildNum_) || !item.visible) {
+            continue;
         }
-        child = child->GetNextSibling();
-    }
-}
-
-void FlexLayout::GetColumnsHeight(uint16_t columnNum, uint16_t* columnsHeight, uint16_t* columnsChildNum)
-{
-    UIView* child = childrenHead_;
-    int16_t pos = 0;
-    int16_t top;
-    int16_t bottom;
-    uint16_t columnChildNum = 0;
-    uint16_t columnCount = 0;
-    uint16_t height = 0;
-
-    if ((columnsHeight == nullptr) || (columnsChildNum == nullptr) || (columnNum > columnCount_)) {
-        return;
-    }
-
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            top = child->GetStyle(STYLE_MARGIN_TOP);
-            bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-            pos += top;
-            if ((pos + child->GetRelativeRect().GetHeight() + bottom) > GetHeight()) {
-                pos = top;
-                columnsHeight[columnCount] = height;
-                height = 0;
-                columnsChildNum[columnCount] = columnChildNum;
-                columnChildNum = 0;
-                columnCount++;
-            }
-            height += child->GetRelativeRect().GetHeight() + top + bottom;
-            columnsHeight[columnCount] = height;
-            columnChildNum++;
-            columnsChildNum[columnCount] = columnChildNum;
-            pos += child->GetRelativeRect().GetHeight() + bottom;
+        posX += item.marginLeft;
+        if (((posX + item.width + item.marginRight) > GetWidth()) && (wrap_ == WRAP)) {
+            count++;
+            posX = lines_[count].startPos;
+            interval = lines_[count].interval;
+            posX += item.marginLeft;
         }
-        child = child->GetNextSibling();
-    }
-}
-
-void FlexLayout::GetCrossAxisPosX(int16_t& posX, uint16_t& count, uint16_t* columnsMaxWidth, UIView* child)
-{
-    if ((columnsMaxWidth == nullptr) || (child == nullptr)) {
-        return;
-    }
 
-    uint16_t i = 0;
-    uint16_t offset = 0;
-    int16_t left = child->GetStyle(STYLE_MARGIN_LEFT);
-    int16_t right = child->GetStyle(STYLE_MARGIN_RIGHT);
-
-    if (secondaryAlign_ == ALIGN_START) {
-        for (i = 0; i < count; i++) {
-            offset += columnsMaxWidth[i];
+        GetCrossAxisPos(GetHeight(), posY, count, lineNum, item.height, item.marginTop, item.marginBottom);
+        if (direction_ == LAYOUT_HOR_R) {
+            item.view->SetPosition(GetWidth() - posX - item.width - item.marginRight, posY - item.marginTop);
+        } else {
+            item.view->SetPosition(posX - item.marginLeft, posY - item.marginTop);
         }
-        posX = left + offset;
-    } else if (secondaryAlign_ == ALIGN_END) {
-        for (i = columnCount_ - 1; i > count; i--) {
-            offset += columnsMaxWidth[i];
-        }
-        posX = GetWidth() - child->GetRelativeRect().GetWidth() - right - offset;
-    } else {
-        for (i = 0; i < columnCount_; i++) {
-            offset += columnsMaxWidth[i];
-        }
-        offset = (columnsMaxWidth[0] - offset) / 2; // 2: half
-        for (i = 1; i <= count; i++) {
-            offset += (columnsMaxWidth[i - 1] + columnsMaxWidth[i]) / 2; // 2: half
-        }
-        posX = (GetWidth() - child->GetRelativeRect().GetWidth() - left - right) / 2 + left + offset; // 2: half
+        item.x = item.view->GetX();
+        item.y = item.view->GetY();
+        posX += item.width + item.marginRight + interval;
     }
 }
 
-void FlexLayout::LayoutVertical()
+void FlexLayout::LayoutVertical(uint16_t start)
 {
-    UIView* child = childrenHead_;
     int16_t interval = 0;
     int16_t posX = 0;
     int16_t posY = 0;
     uint16_t count = 0;
-    uint16_t heightsBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t maxWidthsBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t childsNumBuf[MAX_COUNT_DEFAULT] = {0};
-    uint16_t* columnsHeight = heightsBuf;
-    uint16_t* columnsMaxWidth = maxWidthsBuf;
-    uint16_t* columnsChildNum = childsNumBuf;
-    bool allocFlag = false;
+    uint16_t lineNum = (wrap_ == WRAP) ? columnCount_ : 1;
 
-    if (wrap_ == WRAP) {
-        CalColumnCount();
-        if (columnCount_ > MAX_COUNT_DEFAULT) {
-            columnsHeight = new uint16_t[columnCount_]();
-            columnsMaxWidth = new uint16_t[columnCount_]();
-            columnsChildNum = new uint16_t[columnCount_]();
-            allocFlag = true;
-        }
-        GetColumnMaxWidth(columnCount_, columnsMaxWidth);
-        GetColumnsHeight(columnCount_, columnsHeight, columnsChildNum);
-        GetColumnStartPos(posY, interval, count, columnsHeight, columnsChildNum);
+    if (start == 0) {
+        posY = lines_[count].startPos;
+        interval = lines_[count].interval;
     } else {
-        GetNoWrapStartPos(GetHeight(), posY, interval);
+        posY = childCache_[start].majorPos;
+        interval = childCache_[start].interval;
+        count = childCache_[start].line;
     }
 
-    while (child != nullptr) {
-        if (child->IsVisible()) {
-            int16_t top = child->GetStyle(STYLE_MARGIN_TOP);
-            int16_t bottom = child->GetStyle(STYLE_MARGIN_BOTTOM);
-            posY += top;
-            if (((posY + child->GetRelativeRect().GetHeight() + bottom) > GetHeight()) && (wrap_ == WRAP)) {
-                GetColumnStartPos(posY, interval, ++count, columnsHeight, columnsChildNum);
-                posY += top;
-            }
-
-            GetCrossAxisPosX(posX, count, columnsMaxWidth, child);
-            if (direction_ == LAYOUT_VER_R) {
-                child->SetPosition(posX - child->GetStyle(STYLE_MARGIN_LEFT),
-                                   GetHeight() - posY - child->GetRelativeRect().GetHeight() - bottom);
-            } else {
-                child->SetPosition(posX - child->GetStyle(STYLE_MARGIN_LEFT), posY - top);
-            }
-            posY += child->GetRelativeRect().GetHeight() + bottom + interval;
-            child->LayoutChildren();
+    for (uint16_t i = start; i <= cachedChildNum_; i++) {
+        ChildCache& item = childCache_[i];
+        item.majorPos = posY;
+        item.interval = interval;
+        item.line = count;
+        if ((i == cachedChildNum_) || !item.visible) {
+            continue;
+        }
+        posY += item.marginTop;
+        if (((posY + item.height + item.marginBottom) > GetHeight()) && (wrap_ == WRAP)) {
+            count++;
+            posY = lines_[count].startPos;
+            interval = lines_[count].interval;
+            posY += item.marginTop;
         }
-        child = child->GetNextSibling();
-    }
 
-    if (allocFlag) {
-        delete[] columnsHeight;
-        delete[] columnsMaxWidth;
-        delete[] columnsChildNum;
+        GetCrossAxisPos(GetWidth(), posX, count, lineNum, item.width, item.marginLeft, item.marginRight);
+        if (direction_ == LAYOUT_VER_R) {
+            item.view->SetPosition(posX - item.marginLeft, GetHeight() - posY - item.height - item.marginBottom);
+        } else {
+            item.view->SetPosition(posX - item.marginLeft, posY - item.marginTop);
+        }
+        item.x = item.view->GetX();
+        item.y = item.view->GetY();
+        posY += item.height + item.marginBottom + interval;
     }
 }
 } // namespace OHOS
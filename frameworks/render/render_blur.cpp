@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render/render_blur.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RENDER_BLUR_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RENDER_BLUR_SSE2 1
+#endif
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t BOX_BLUR_PASSES = 3;
+/* keeps the window sum of 255 * (2 * 127 + 1) plus rounding inside 16 bits */
+constexpr uint16_t MAX_BOX_RADIUS = 127;
+constexpr uint8_t RECIPROCAL_SHIFT = 16;
+constexpr uint32_t RECIPROCAL_ONE = 1 << RECIPROCAL_SHIFT;
+constexpr int16_t TRANSPOSE_BLOCK = 16;
+#if defined(RENDER_BLUR_NEON) || defined(RENDER_BLUR_SSE2)
+constexpr int16_t SIMD_LANES = 8;
+#endif
+} // namespace
+
+uint16_t RenderBlur::GetBoxRadius(uint16_t radius)
+{
+    /* three boxes of width radius have the variance of a gaussian with sigma radius / 2 */
+    uint16_t boxRadius = (radius + 1) / 2; // 2: half
+    return MATH_MIN(boxRadius, MAX_BOX_RADIUS);
+}
+
+uint16_t RenderBlur::GetBoxBlurExtent(uint16_t radius)
+{
+    return GetBoxRadius(radius) * BOX_BLUR_PASSES;
+}
+
+bool RenderBlur::BoxBlurAlpha(uint8_t* mask, int16_t width, int16_t height, uint16_t radius)
+{
+    if ((mask == nullptr) || (width <= 0) || (height <= 0)) {
+        return false;
+    }
+    uint16_t boxRadius = GetBoxRadius(radius);
+    if (boxRadius == 0) {
+        return true;
+    }
+    uint32_t size = static_cast<uint32_t>(width) * height;
+    uint8_t* buffer = new uint8_t[size];
+    if (buffer == nullptr) {
+        GRAPHIC_LOGE("RenderBlur::BoxBlurAlpha new buffer fail");
+        return false;
+    }
+    uint16_t* sums = new uint16_t[MATH_MAX(width, height)];
+    if (sums == nullptr) {
+        GRAPHIC_LOGE("RenderBlur::BoxBlurAlpha new sums fail");
+        delete[] buffer;
+        return false;
+    }
+
+    /* an odd number of passes leaves each axis in buffer, which is transposed back into mask */
+    BlurColumns(mask, buffer, width, height, boxRadius, sums);
+    BlurColumns(buffer, mask, width, height, boxRadius, sums);
+    BlurColumns(mask, buffer, width, height, boxRadius, sums);
+    Transpose(buffer, mask, width, height);
+    BlurColumns(mask, buffer, height, width, boxRadius, sums);
+    BlurColumns(buffer, mask, height, width, boxRadius, sums);
+    BlurColumns(mask, buffer, height, width, boxRadius, sums);
+    Transpose(buffer, mask, height, width);
+
+    delete[] sums;
+    delete[] buffer;
+    return true;
+}
+
+void RenderBlur::BlurColumns(const uint8_t* src, uint8_t* dst, int16_t rowLength, int16_t rowNum,
+                             uint16_t boxRadius, uint16_t* sums)
+{
+    uint16_t window = 2 * boxRadius + 1; // 2: both sides of the center pixel
+    uint16_t reciprocal = static_cast<uint16_t>((RECIPROCAL_ONE + window / 2) / window); // 2: round to nearest
+    uint16_t half = window / 2; // 2: round to nearest
+    (void)memset_s(sums, rowLength * sizeof(uint16_t), 0, rowLength * sizeof(uint16_t));
+
+    int32_t preload = MATH_MIN(static_cast<int32_t>(boxRadius), static_cast<int32_t>(rowNum));
+    for (int32_t y = 0; y < preload; y++) {
+        AddRow(sums, src + y * rowLength, rowLength);
+    }
+    for (int32_t y = 0; y < rowNum; y++) {
+        if (y + boxRadius < rowNum) {
+            AddRow(sums, src + (y + boxRadius) * rowLength, rowLength);
+        }
+        StoreRow(dst + y * rowLength, sums, reciprocal, half, rowLength);
+        if (y >= boxRadius) {
+            SubRow(sums, src + (y - boxRadius) * rowLength, rowLength);
+        }
+    }
+}
+
+void RenderBlur::Transpose(const uint8_t* src, uint8_t* dst, int16_t width, int16_t height)
+{
+    for (int32_t blockY = 0; blockY < height; blockY += TRANSPOSE_BLOCK) {
+        int32_t endY = MATH_MIN(blockY + TRANSPOSE_BLOCK, static_cast<int32_t>(height));
+        for (int32_t blockX = 0; blockX < width; blockX += TRANSPOSE_BLOCK) {
+            int32_t endX = MATH_MIN(blockX + TRANSPOSE_BLOCK, static_cast<int32_t>(width));
+            for (int32_t y = blockY; y < endY; y++) {
+                const uint8_t* srcRow = src + y * width;
+                for (int32_t x = blockX; x < endX; x++) {
+                    dst[x * height + y] = srcRow[x];
+                }
+            }
+        }
+    }
+}
+
+void RenderBlur::AddRow(uint16_t* sums, const uint8_t* row, int16_t length)
+{
+    int16_t i = 0;
+#if defined(RENDER_BLUR_NEON)
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        vst1q_u16(sums + i, vaddw_u8(vld1q_u16(sums + i), vld1_u8(row + i)));
+    }
+#elif defined(RENDER_BLUR_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        __m128i pixels = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + i)), zero);
+        __m128i sum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sums + i), _mm_add_epi16(sum, pixels));
+    }
+#endif
+    for (; i < length; i++) {
+        sums[i] += row[i];
+    }
+}
+
+void RenderBlur::SubRow(uint16_t* sums, const uint8_t* row, int16_t length)
+{
+    int16_t i = 0;
+#if defined(RENDER_BLUR_NEON)
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        vst1q_u16(sums + i, vsubw_u8(vld1q_u16(sums + i), vld1_u8(row + i)));
+    }
+#elif defined(RENDER_BLUR_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        __m128i pixels = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + i)), zero);
+        __m128i sum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sums + i), _mm_sub_epi16(sum, pixels));
+    }
+#endif
+    for (; i < length; i++) {
+        sums[i] -= row[i];
+    }
+}
+
+void RenderBlur::StoreRow(uint8_t* dst, const uint16_t* sums, uint16_t reciprocal, uint16_t half, int16_t length)
+{
+    int16_t i = 0;
+#if defined(RENDER_BLUR_NEON)
+    uint16x8_t halfVec = vdupq_n_u16(half);
+    uint16x4_t reciprocalVec = vdup_n_u16(reciprocal);
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        uint16x8_t sum = vaddq_u16(vld1q_u16(sums + i), halfVec);
+        uint16x4_t low = vshrn_n_u32(vmull_u16(vget_low_u16(sum), reciprocalVec), RECIPROCAL_SHIFT);
+        uint16x4_t high = vshrn_n_u32(vmull_u16(vget_high_u16(sum), reciprocalVec), RECIPROCAL_SHIFT);
+        vst1_u8(dst + i, vmovn_u16(vcombine_u16(low, high)));
+    }
+#elif defined(RENDER_BLUR_SSE2)
+    const __m128i halfVec = _mm_set1_epi16(static_cast<int16_t>(half));
+    const __m128i reciprocalVec = _mm_set1_epi16(static_cast<int16_t>(reciprocal));
+    for (; i + SIMD_LANES <= length; i += SIMD_LANES) {
+        __m128i sum = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sums + i)), halfVec);
+        __m128i value = _mm_mulhi_epu16(sum, reciprocalVec);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(value, value));
+    }
+#endif
+    for (; i < length; i++) {
+        dst[i] = static_cast<uint8_t>((static_cast<uint32_t>(sums[i] + half) * reciprocal) >> RECIPROCAL_SHIFT);
+    }
+}
+} // namespace OHOS
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file render_blur.h
+ * @brief Defines the separable box blur of alpha masks
+ * @since 1.0
+ * @version 1.0
+ */
+
+#ifndef GRAPHIC_LITE_RENDER_BLUR_H
+#define GRAPHIC_LITE_RENDER_BLUR_H
+
+#include "gfx_utils/heap_base.h"
+#include <cstdint>
+
+namespace OHOS {
+/**
+ * @brief Blurs 8 bit alpha masks with three box blur passes per axis, which approximates a gaussian blur whose
+ *        standard deviation is half of the blur radius.
+ * Each axis is blurred by sliding a window over whole rows, so one step adds and subtracts a full row of pixels.
+ * These row kernels use NEON or SSE2 when the target supports them and plain loops otherwise, and all of them
+ * give the same result. Horizontal passes run on the transposed mask so they can use the same row kernels.
+ */
+class RenderBlur : public HeapBase {
+public:
+    /**
+     * @brief Gets how far the blur spreads a pixel, the mask should be padded by this on every side.
+     * @param radius the blur radius
+     * @return the spread in pixels
+     */
+    static uint16_t GetBoxBlurExtent(uint16_t radius);
+
+    /**
+     * @brief Blurs an alpha mask in place. The pixels outside of the mask are taken as transparent.
+     * @param mask the alpha mask, width * height bytes without row padding
+     * @param width the width of the mask
+     * @param height the height of the mask
+     * @param radius the blur radius
+     * @return true if the mask is blurred, false if the parameters are invalid or memory runs out
+     */
+    static bool BoxBlurAlpha(uint8_t* mask, int16_t width, int16_t height, uint16_t radius);
+
+private:
+    static uint16_t GetBoxRadius(uint16_t radius);
+    static void BlurColumns(const uint8_t* src, uint8_t* dst, int16_t rowLength, int16_t rowNum,
+                            uint16_t boxRadius, uint16_t* sums);
+    static void Transpose(const uint8_t* src, uint8_t* dst, int16_t width, int16_t height);
+    static void AddRow(uint16_t* sums, const uint8_t* row, int16_t length);
+    static void SubRow(uint16_t* sums, const uint8_t* row, int16_t length);
+    static void StoreRow(uint8_t* dst, const uint16_t* sums, uint16_t reciprocal, uint16_t half, int16_t length);
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_RENDER_BLUR_H
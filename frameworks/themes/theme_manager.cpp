@@ -14,6 +14,7 @@
  */
 
 #include "themes/theme_manager.h"
+#include "draw/state_sprite_cache.h"
 
 namespace OHOS {
 ThemeManager& ThemeManager::GetInstance()
@@ -25,5 +26,7 @@ ThemeManager& ThemeManager::GetInstance()
 void ThemeManager::SetCurrent(Theme* theme)
 {
     theme_ = theme;
+    /* the controls drawn from cached sprites are drawn again with the new theme */
+    StateSpriteCache::GetInstance().Clear();
 }
 } // namespace OHOS
@@ -53,6 +53,11 @@ public:
      */
     void Clear();
 
+    /**
+     * Dispatch the samples held back by devices that coalesce their events.
+     */
+    void FlushEvents();
+
     void Callback() override;
 
 private:
@@ -74,6 +74,14 @@ struct TransformDataInfo {
     TransformAlgorithm algorithm;
 };
 
+struct FillCommand {
+    Rect rect;
+    ColorType color;
+    OpacityType opacity;
+};
+
+class DrawCommandQueue;
+
 enum BufferInfoUsage {
     BUFFER_FB_SURFACE,
     BUFFER_MAP_SURFACE,
@@ -82,6 +90,9 @@ enum BufferInfoUsage {
 
 class BaseGfxEngine : public HeapBase {
 public:
+    BaseGfxEngine() {}
+    virtual ~BaseGfxEngine();
+
     virtual void DrawArc(BufferInfo& dst, ArcInfo& arcInfo, const Rect& mask,
                          const Style& style, OpacityType opacity, uint8_t cap);
 
@@ -100,6 +111,9 @@ public:
                                  const Point& control2, const Point& end, const Rect& mask,
                                  int16_t width, ColorType color, OpacityType opacity);
 
+    virtual void DrawPolyline(BufferInfo& dst, const Point* points, uint16_t pointNum, const Rect& mask,
+                              int16_t width, ColorType color, OpacityType opacity);
+
     virtual void DrawRect(BufferInfo& dst,
                           const Rect& rect,
                           const Rect& dirtyRect,
@@ -128,6 +142,47 @@ public:
                       const ColorType color,
                       const OpacityType opacity);
 
+    /*
+     * Deferred mode. While a buffer is recorded, fills into it are queued instead of drawn, and the queue is optimized
+     * before it is executed: fills covered by a later opaque fill are dropped, adjacent fills of the same color are
+     * merged, and an opaque fill is drawn in row bands together with a blit into it. The pixels are the same as
+     * without the queue. Every other draw method of this class flushes the queue first, so an engine overriding one
+     * of them must call PauseDeferred and ResumeDeferred around it. Disabled by default.
+     */
+    void SetDeferredEnable(bool enable);
+
+    bool IsDeferredEnable() const
+    {
+        return deferredEnable_;
+    }
+
+    /* Starts recording the fills into dst, if deferred mode is enabled. */
+    void BeginDeferred(const BufferInfo& dst);
+
+    /* Executes the queue and stops recording. */
+    void EndDeferred();
+
+    /* Executes the queue and draws immediately until ResumeDeferred, for code that writes pixels itself. */
+    void PauseDeferred();
+
+    void ResumeDeferred();
+
+    void FlushDeferred();
+
+    /* Fill and Blit, recorded while dst is recorded. */
+    void SubmitFill(BufferInfo& dst, const Rect& fillArea, const ColorType color, const OpacityType opacity);
+
+    void SubmitBlit(BufferInfo& dst,
+                    const Point& dstPos,
+                    const BufferInfo& src,
+                    const Rect& subRect,
+                    const BlendOption& blendOption);
+
+    const DrawCommandQueue* GetDrawCommandQueue() const
+    {
+        return drawQueue_;
+    }
+
     virtual uint8_t* AllocBuffer(uint32_t size, uint32_t usage);
 
     virtual void FreeBuffer(uint8_t* buffer);
@@ -137,6 +192,15 @@ public:
         return nullptr;
     }
 
+    /*
+     * Age of the buffer returned by GetFBBufferInfo: 0 if its contents are undefined, otherwise the number of frames
+     * since it was last presented. The default single buffer always holds the previous frame.
+     */
+    virtual uint8_t GetFBBufferAge()
+    {
+        return 1;
+    }
+
     virtual void Flush() {}
 
     virtual uint16_t GetScreenWidth()
@@ -174,10 +238,31 @@ public:
         baseEngine_ = gfxEngine;
     }
 protected:
+    /* Executes optimized fills in order. Engines that batch fills in hardware override this. */
+    virtual void ExecuteFills(BufferInfo& dst, const FillCommand* commands, uint16_t commandNum);
+
     static BaseGfxEngine* baseEngine_;
     uint16_t width_ = HORIZONTAL_RESOLUTION;
     uint16_t height_ = VERTICAL_RESOLUTION;
     ScreenShape screenShape_ = RECTANGLE;
+
+private:
+    bool IsRecording(const BufferInfo& dst) const
+    {
+        return (deferredTarget_ != nullptr) && (pauseDepth_ == 0) && (dst.virAddr == deferredTarget_);
+    }
+    void FillAndBlitInBands(BufferInfo& dst,
+                            const FillCommand& fill,
+                            const Point& dstPos,
+                            const BufferInfo& src,
+                            const Rect& subRect,
+                            const BlendOption& blendOption);
+
+    DrawCommandQueue* drawQueue_ = nullptr;
+    BufferInfo deferredDst_ = {};
+    const void* deferredTarget_ = nullptr;
+    uint8_t pauseDepth_ = 0;
+    bool deferredEnable_ = false;
 };
 }
 
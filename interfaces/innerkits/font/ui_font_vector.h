@@ -21,6 +21,7 @@
 #include "freetype/freetype.h"
 #include "freetype/tttables.h"
 #include "font/ui_font_cache.h"
+#include "font/ui_font_coverage.h"
 #include <memory>
 
 namespace OHOS {
@@ -57,12 +58,36 @@ public:
     uint16_t GetHeightByFontId(uint8_t fontId, uint8_t size = 0) override;
     int16_t GetWidthSpannable(uint32_t unicode, uint8_t fontId, uint8_t size) override;
     uint8_t* GetBitmapSpannable(uint32_t unicode, GlyphNode& glyphNode, uint8_t fontId, uint8_t size = 0) override;
+    uint8_t* GetRotatedBitmap(uint32_t unicode, int16_t angle, int16_t pivotY, GlyphNode& glyphNode) override;
     bool IsEmojiFont(uint8_t fontId) override;
+
+    /* Maximum number of FreeType size objects kept for the (font, size) pairs in use */
+    static constexpr uint8_t SIZE_CACHE_MAX_NUM = 8;
+    /*
+     * Sets how many size objects are kept, at most SIZE_CACHE_MAX_NUM. Switching to a kept (font, size) pair only
+     * activates its size object instead of scaling the face again, the least recently used one is replaced when all
+     * are taken. 0 scales the shared size of the face on every switch.
+     */
+    void SetSizeCacheNum(uint8_t num);
+    uint8_t GetSizeCacheNum() const
+    {
+        return sizeCacheNum_;
+    }
+    /* Obtains the number of size objects currently kept */
+    uint8_t GetSizeCacheCount() const;
+    /* Obtains how many times a face has been scaled to a size, kept size objects avoid most of them */
+    uint32_t GetSizeScaleCount() const
+    {
+        return sizeScaleCount_;
+    }
+    /* Obtains the bytes taken by the coverage maps built so far and by the fallback cache */
+    uint32_t GetCoverageSize() const;
 private:
     static constexpr uint8_t FONT_ID_MAX = 0xFF;
     static constexpr uint8_t FONT_INVALID_TTF_ID = 0xFF;
     static constexpr uint8_t TTF_NAME_LEN_MAX = 128;
     static constexpr uint8_t FONT_BPP_8 = 8;
+    static constexpr uint32_t FIXED_16_16_ONE = 0x10000;
     UITextLanguageFontParam fontInfo_[FONT_ID_MAX] = {{0}};
     std::string ttfDir_;
     FT_Library ftLibrary_;
@@ -71,6 +96,24 @@ private:
     bool freeTypeInited_;
     uint32_t key_ = 0;
     UIFontCache* bitmapCache_;
+    struct SizeEntry {
+        FT_Size size;
+        uint32_t lastUse;
+        uint8_t fontId;
+        uint8_t fontSize;
+    };
+    SizeEntry sizeCache_[SIZE_CACHE_MAX_NUM] = {};
+    uint8_t sizeCacheNum_ = SIZE_CACHE_MAX_NUM;
+    uint32_t sizeCacheTick_ = 0;
+    uint32_t sizeScaleCount_ = 0;
+    /* the face found for a code point that the face asked for has no glyph of, cleared when faces change */
+    static constexpr uint8_t FALLBACK_CACHE_NUM = 64;
+    struct FallbackEntry {
+        uint32_t unicode;
+        uint8_t fontId;
+    };
+    FallbackEntry fallbackCache_[FALLBACK_CACHE_NUM];
+    UIFontCoverage* coverages_[FONT_ID_MAX] = {nullptr};
     struct Metric {
         int left;
         int top;
@@ -85,6 +128,14 @@ private:
 #endif
     uint8_t GetFontId(uint32_t unicode) const;
     uint32_t GetKey(uint8_t fontId, uint32_t size);
+    int8_t ActivateSize(uint8_t fontId, uint8_t size);
+    /* Releases a kept size, and keeps its face at that scale if it was the active size of the face and keepScale. */
+    int8_t ScaleFace(FT_Face face, uint8_t size);
+    void ReleaseSize(SizeEntry& entry, bool keepScale);
+    void ReleaseSizes(uint8_t fontId);
+    uint8_t FindFallbackFace(uint32_t unicode, uint8_t start);
+    bool HasGlyph(uint8_t fontId, uint32_t unicode);
+    void ClearFallbackCache();
 #if ENABLE_VECTOR_FONT
     int8_t LoadGlyphIntoFace(uint8_t& fontId, uint32_t unicode, TextStyle textStyle);
 #endif
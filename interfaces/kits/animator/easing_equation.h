@@ -72,6 +72,17 @@ public:
      */
     static void SetBackOvershoot(double overshoot);
 
+    /**
+     * @brief Obtains the parameter <b>s</b> used by all the back-ease animations.
+     *
+     * @return Returns the overshoot <b>s</b>.
+     * @see SetBackOvershoot
+     */
+    static double GetBackOvershoot()
+    {
+        return overshoot_;
+    }
+
     /**
      * @brief Eases in with an overshoot.
      *
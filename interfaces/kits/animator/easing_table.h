@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_Animator
+ * @{
+ *
+ * @brief Defines UI animation effects and provides matched curves.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file easing_table.h
+ *
+ * @brief Defines easing functions that look their curves up in precomputed fixed-point tables.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+#ifndef GRAPHIC_LITE_EASING_TABLE_H
+#define GRAPHIC_LITE_EASING_TABLE_H
+
+#include "animator/easing_equation.h"
+
+namespace OHOS {
+/**
+ * @brief Defines easing functions that interpolate precomputed curve tables.
+ *
+ * Each curve is sampled once into a table of {@link TABLE_SEGMENT_NUM} + 1 fixed-point values with 14 fraction
+ * bits. A call then only does integer math: one division to find the position in the table, a linear interpolation
+ * between two entries and a multiplication by the distance to move. The table of a curve is built on its first
+ * call and takes {@link GetCurveTableSize} bytes. The circular curves get vertical at one end, where no table is
+ * fine enough, so the segments next to that end are calculated with an integer square root instead.
+ *
+ * The tables pay off where floating-point math is slow or missing, and for the sine and cubic-bezier curves, whose
+ * equations call Sin or iterate. On an x86 desktop the polynomial curves of {@link EasingEquation} are faster than
+ * their tables, while a bezier table call is more than four times faster than {@link Interpolation::GetBezierY}.
+ *
+ * The functions have the same parameters and curves as their counterparts in {@link EasingEquation}, so they can be
+ * used wherever an {@link EasingFunc} is accepted. {@link EasingEquation::LinearEaseNone} is already integer math
+ * and has no counterpart here. The result differs from the exact curve by at most one step for distances of up to
+ * 1000, see the easing table unit tests for the measured bounds.
+ *
+ * Cubic-bezier curves are created with {@link CreateBezier}. Because an {@link EasingFunc} carries no context, each
+ * bezier curve takes one of {@link BEZIER_SLOT_NUM} slots, and the returned function reads the table of its slot.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+class EasingTable : public HeapBase {
+public:
+    static constexpr uint16_t TABLE_SEGMENT_NUM = 256;
+    static constexpr uint8_t BEZIER_SLOT_NUM = 8;
+
+    /** Identifies the predefined curves in {@link GetCurveValue}. */
+    enum Curve : uint8_t {
+        BACK_IN,
+        BACK_OUT,
+        BACK_IN_OUT,
+        CIRC_IN,
+        CIRC_OUT,
+        CIRC_IN_OUT,
+        CUBIC_IN,
+        CUBIC_OUT,
+        CUBIC_IN_OUT,
+        QUAD_IN,
+        QUAD_OUT,
+        QUAD_IN_OUT,
+        QUINT_IN,
+        QUINT_OUT,
+        QUINT_IN_OUT,
+        SINE_IN,
+        SINE_OUT,
+        SINE_IN_OUT,
+        CURVE_NUM
+    };
+
+    /**
+     * @brief Creates an easing function for the cubic-bezier curve from (0, 0) to (1, 1) with control points
+     *        (x1, y1) and (x2, y2), as used by CSS <b>cubic-bezier()</b>.
+     *
+     * x1 and x2 are clamped to [0, 1] so that the curve is a function of time. Creating the same curve again returns
+     * the same function and counts one more reference.
+     *
+     * @param x1 Indicates the x coordinate of the first control point.
+     * @param y1 Indicates the y coordinate of the first control point.
+     * @param x2 Indicates the x coordinate of the second control point.
+     * @param y2 Indicates the y coordinate of the second control point.
+     * @return Returns the easing function, or <b>nullptr</b> if all slots are taken or the table cannot be allocated.
+     * @see ReleaseBezier
+     */
+    static EasingFunc CreateBezier(float x1, float y1, float x2, float y2);
+
+    /**
+     * @brief Releases one reference of a function returned by {@link CreateBezier}. The slot and its table are freed
+     *        with the last reference, the function must not be called afterwards.
+     *
+     * @param func Indicates the function to release.
+     */
+    static void ReleaseBezier(EasingFunc func);
+
+    /**
+     * @brief Frees the tables of the predefined curves. They are built again on their next call.
+     */
+    static void ReleaseTables();
+
+    /**
+     * @brief Obtains the bytes taken by all the tables built so far, including the bezier tables.
+     *
+     * @return Returns the size in bytes.
+     */
+    static uint32_t GetTableSize();
+
+    /**
+     * @brief Obtains the bytes taken by the table of one curve.
+     *
+     * @return Returns the size in bytes.
+     */
+    static constexpr uint32_t GetCurveTableSize()
+    {
+        return (TABLE_SEGMENT_NUM + 1) * sizeof(int16_t);
+    }
+
+    /* The following functions follow the curves of the same names in EasingEquation. */
+    static int16_t BackEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t BackEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t BackEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CircEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CircEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CircEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CubicEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CubicEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t CubicEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuadEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuadEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuadEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuintEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuintEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t QuintEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t SineEaseIn(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t SineEaseOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int16_t SineEaseInOut(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+
+    /**
+     * @brief Calculates the exact value of a predefined curve in double precision. Used to build the tables, and when
+     *        a table cannot be allocated.
+     *
+     * @param curve Indicates the curve, one of the <b>Curve</b> values.
+     * @param t     Indicates the time in [0, 1].
+     * @return Returns the eased progress, 0 at the start and 1 at the end.
+     */
+    static double GetCurveValue(uint8_t curve, double t);
+
+private:
+    static constexpr uint8_t FRACTION_BITS = 14;
+    static constexpr int32_t FRACTION_ONE = 1 << FRACTION_BITS;
+    /* segments next to the vertical end of a circle curve, where a chord is more than a step off the curve */
+    static constexpr uint16_t CIRCLE_EDGE_SEGMENT_NUM = 8;
+
+    struct BezierSlot {
+        float x1;
+        float y1;
+        float x2;
+        float y2;
+        int16_t* table;
+        uint16_t refCount;
+    };
+
+    static int16_t Ease(uint8_t curve, int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+    static int32_t Lookup(const int16_t* table, uint32_t time);
+    static bool IsCircleEdge(uint8_t curve, uint32_t time);
+    static int32_t GetCircProgress(uint8_t curve, uint32_t curTime, uint32_t durationTime);
+    static int32_t CircleY(uint32_t x, uint32_t radius);
+    static int16_t Move(int16_t startPos, int16_t endPos, int32_t progress);
+    static const int16_t* GetTable(uint8_t curve);
+    static int16_t* BuildBezierTable(float x1, float y1, float x2, float y2);
+    template<uint8_t SLOT>
+    static int16_t BezierEase(int16_t startPos, int16_t endPos, uint16_t curTime, uint16_t durationTime);
+
+    static int16_t* tables_[CURVE_NUM];
+    static double backOvershoot_;
+    static BezierSlot bezierSlots_[BEZIER_SLOT_NUM];
+    static const EasingFunc BEZIER_FUNCS[BEZIER_SLOT_NUM];
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_EASING_TABLE_H
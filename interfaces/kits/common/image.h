@@ -42,6 +42,8 @@
 #include "gfx_utils/style.h"
 
 namespace OHOS {
+class ClipMask;
+
 /**
  * @brief Represents basic image attributes, including the image type and path.
  *
@@ -147,7 +149,8 @@ public:
                    const Rect& coords,
                    const Rect& mask,
                    const Style& style,
-                   uint8_t opaScale) const;
+                   uint8_t opaScale,
+                   const ClipMask* clipMask = nullptr) const;
 
 protected:
     const ImageInfo* imageInfo_;
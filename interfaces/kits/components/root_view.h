@@ -261,12 +261,23 @@ public:
     void DrawTop(UIView* view, const Rect& rect);
 
     /**
-     * @brief Measure all child view under RootView
+     * @brief Measure the child views under RootView which are waiting for a measure pass
      */
     void Measure();
 
     void MeasureView(UIView* view);
 
+    /**
+     * @brief Obtains the number of views remeasured by the last measure pass.
+     *
+     * @return Returns the number of views.
+     * @since 6
+     */
+    uint16_t GetMeasuredViewCount() const
+    {
+        return measuredViewCount_;
+    }
+
     /**
      * @brief update momory info based on FB buffer info.
      *
@@ -317,6 +328,9 @@ private:
     void ClearMapBuffer();
     void UpdateMapBufferInfo(Rect& invalidatedArea);
     void RestoreMapBufferInfo();
+    bool UpdateScreenRowBounds();
+    bool ClipToScreenShape(Rect& rect);
+    static void DrawView(UIView* view, BufferInfo& gfxDstBuffer, const Rect& rect, bool postDraw);
 #if LOCAL_RENDER
     void RemoveViewFromInvalidMap(UIView *view);
     void DrawInvalidMap(const Rect &buffRect);
@@ -328,9 +342,33 @@ private:
     void OptimizeAddRect(Rect& rect);
     void OptimizeInvalidateRects();
     List<Rect> invalidateRects_;
+#if (FULLY_RENDER != 1)
+    void AddBufferAgeDamage();
+
+    /* frames kept in the damage history, which is also the oldest buffer age redrawn partially */
+    static constexpr uint8_t MAX_BUFFER_AGE = 3;
+    /* rects kept per frame, the rest are joined into the last one */
+    static constexpr uint8_t MAX_FRAME_DAMAGE_SIZE = 8;
+    struct FrameDamage {
+        Rect rects[MAX_FRAME_DAMAGE_SIZE];
+        uint8_t rectNum;
+    };
+    FrameDamage damageHistory_[MAX_BUFFER_AGE];
+    uint8_t damageHead_ {0};
+    uint8_t damageFrameNum_ {0};
+#endif
 #endif
 
+    /*
+     * Left and right column of every screen row that can be seen on a round screen, nullptr on a rectangle one.
+     * Dirty rects are clipped to them, and fills and blits skip the columns outside.
+     */
+    int16_t* screenRowBounds_ {nullptr};
+    int16_t screenBoundWidth_ {0};
+    int16_t screenBoundHeight_ {0};
+
     OnKeyActListener* onKeyActListener_ {nullptr};
+    uint16_t measuredViewCount_ {0};
     OnVirtualDeviceEventListener* onVirtualEventListener_ {nullptr};
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_t lock_;
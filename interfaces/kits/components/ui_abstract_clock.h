@@ -220,6 +220,17 @@ public:
     }
 
 protected:
+    /**
+     * @brief Invalidates the clock after {@link IncOneSecond} changed the time. The whole clock is invalidated by
+     *        default, a clock that invalidates the changed parts itself in {@link UpdateClock} can skip it.
+     *
+     * @since 6
+     */
+    virtual void InvalidateTimeChange()
+    {
+        Invalidate();
+    }
+
     /**
      * @brief Represents the current number of hours.
      */
@@ -62,7 +62,7 @@ public:
      * @since 1.0
      * @version 1.0
      */
-    virtual ~UIAnalogClock() {}
+    virtual ~UIAnalogClock();
 
     /**
      * @brief Enumerates the clock hand types.
@@ -336,10 +336,69 @@ public:
      */
     void UpdateClock(bool clockInit) override;
 
+    /**
+     * @brief Sets whether the dial is drawn from a retained layer.
+     *
+     * When enabled, the background and all the child views of the clock are rendered once into an ARGB8888 layer,
+     * and each frame only blits the layer under the hands. A time change then only invalidates the strips that the
+     * hands sweep instead of the whole clock. The child views are taken as static: call {@link RefreshDial} after
+     * changing one of them in place. All layers together use at most {@link DIAL_CACHE_MAX_SIZE} bytes, a clock whose
+     * layer does not fit draws its dial directly.
+     *
+     * @param enable Specifies whether to use the layer. The default value is <b>false</b>.
+     */
+    void SetDialCacheEnable(bool enable);
+
+    /**
+     * @brief Checks whether the dial is drawn from a retained layer.
+     *
+     * @return Returns <b>true</b> if the layer is enabled; returns <b>false</b> otherwise.
+     */
+    bool IsDialCacheEnabled() const
+    {
+        return useDialCache_;
+    }
+
+    /**
+     * @brief Renders the retained dial layer again on the next frame.
+     */
+    void RefreshDial();
+
+    /**
+     * @brief Obtains the bytes held by the dial layers of all analog clocks.
+     *
+     * @return Returns the bytes held by the layers.
+     */
+    static uint32_t GetDialCacheSize();
+
+    static constexpr uint32_t DIAL_CACHE_MAX_SIZE = 1024 * 1024; // 1024 * 1024: 1MB
+
+protected:
+    void OnChildChanged() override;
+    void InvalidateTimeChange() override;
+
 private:
+    /* number of strips a hand is split into when its swept area is invalidated */
+    static constexpr uint8_t HAND_PIECE_NUM = 4;
+    /* pixels added around each strip for anti-aliased edges */
+    static constexpr int16_t HAND_PIECE_MARGIN = 2;
+
     Hand hourHand_;
     Hand minuteHand_;
     Hand secondHand_;
+    uint8_t* dialCache_;
+    int16_t dialCacheWidth_;
+    int16_t dialCacheHeight_;
+    OpacityType dialCacheOpa_;
+    bool dialCacheValid_;
+    bool useDialCache_;
+    static uint32_t dialCacheSize_;
+
+    /* whether the dial is drawn from the layer, so moving hands only needs the strips they sweep redrawn */
+    bool IsDialCacheReady() const
+    {
+        return useDialCache_ && (dialCache_ != nullptr);
+    }
 
     void DrawHand(BufferInfo& gfxDstBuffer, const Rect& current, const Rect& invalidatedArea, Hand& hand);
     void DrawHandImage(BufferInfo& gfxDstBuffer, const Rect& current, const Rect& invalidatedArea, Hand& hand);
@@ -347,6 +406,11 @@ private:
     uint16_t ConvertHandValueToAngle(uint8_t handValue, uint8_t range, uint8_t secondHandValue, uint8_t ratio) const;
     uint16_t ConvertHandValueToAngle(uint8_t handValue, uint8_t range) const;
     void CalculateRedrawArea(const Rect& current, Hand& hand, bool clockInit);
+    void InvalidateHand(const Rect& current, const Hand& hand, uint16_t angle);
+    void GetHandLine(const Rect& current, const Hand& hand, uint16_t angle, Point& start, Point& end) const;
+    bool DrawDialCache(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea);
+    bool BuildDialCache(const Rect& rect);
+    void ReleaseDialCache();
 };
 } // namespace OHOS
 #endif // UI_ANALOG_CLOCK_H
@@ -41,6 +41,8 @@
 #include "components/ui_view.h"
 
 namespace OHOS {
+class ArcTextCache;
+
 /**
  * @brief Defines functions related to an arc label.
  *
@@ -337,6 +339,38 @@ public:
         return orientation_;
     }
 
+    /**
+     * @brief Sets whether the arc text is drawn from a cache.
+     *
+     * The cache keeps the coverage of the whole arc text, so that a redraw only blends the invalidated part of it
+     * with the text color instead of rotating every letter again. It is rendered again when the text, font,
+     * radius, angles or orientation change. A label of more than {@link TEXT_CACHE_MAX_SIZE} pixels draws its
+     * letters directly. The cache takes one byte per pixel of the label, up to 64 KB, so it is meant for the few
+     * labels that are redrawn often, such as one under an animation.
+     *
+     * @param enable Specifies whether to use the cache. The default value is <b>false</b>.
+     */
+    void SetTextCacheEnable(bool enable);
+
+    /**
+     * @brief Checks whether the arc text is drawn from a cache.
+     *
+     * @return Returns <b>true</b> if the cache is enabled; returns <b>false</b> otherwise.
+     */
+    bool IsTextCacheEnabled() const
+    {
+        return useTextCache_;
+    }
+
+    /**
+     * @brief Obtains the bytes held by the text cache of this label.
+     *
+     * @return Returns the bytes held by the cache.
+     */
+    uint32_t GetTextCacheSize() const;
+
+    static constexpr uint32_t TEXT_CACHE_MAX_SIZE = 64 * 1024; // 64 * 1024: 64K pixels of one byte
+
     /**
      * @brief Draws an arc text.
      *
@@ -377,8 +411,11 @@ private:
     void ReMeasure() override;
     void MeasureArcTextInfo();
     void DrawArcText(BufferInfo& gfxDstBuffer, const Rect& mask, OpacityType opaScale);
+    bool DrawTextCache(BufferInfo& gfxDstBuffer, const Rect& mask, OpacityType opaScale);
+    void ReleaseTextCache();
 
     bool needRefresh_;
+    bool useTextCache_;
     Point textSize_;
     uint16_t radius_;
     int16_t startAngle_;
@@ -387,6 +424,7 @@ private:
     TextOrientation orientation_;
 
     ArcTextInfo arcTextInfo_;
+    ArcTextCache* textCache_;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_UI_ARC_LABEL_H
@@ -1703,6 +1703,19 @@ protected:
                              const Rect& invalidatedArea,
                              const Style& style,
                              const bool& isStroke);
+#if GRAPHIC_ENABLE_BLUR_EFFECT_FLAG
+    /**
+     * Draws the shadow through a cached blurred alpha mask, returns false if the mask is too large to be kept.
+     */
+    static bool DrawShadowMask(RenderBase& renBase,
+                               const PathParam& pathParam,
+                               const Paint& paint,
+                               const TransAffine& shadowTransform,
+                               const Rect& invalidatedArea,
+                               const Rgba8T& shadowColor,
+                               const bool& isStroke);
+    static uint64_t GetShadowParamHash(const Paint& paint, const float* matrix, const bool& isStroke);
+#endif
 #endif
    static void  BlitMapBuffer(BufferInfo &gfxDstBuffer, BufferInfo& gfxMapBuffer,
                               Rect& textRect, TransformMap& transMap, const Rect& invalidatedArea);
@@ -256,6 +256,13 @@ protected:
                                         Rect trunc,
                                         int16_t borderRadius,
                                         int16_t rectLineWidth);
+    /* Draws the state without images as if the content rect of this view were contentRect. */
+    virtual void DrawSoftwareState(BufferInfo& gfxDstBuffer, const Rect& contentRect, const Rect& trunc);
+    /* Obtains the color and the animation step the drawing of DrawSoftwareState depends on besides the sizes. */
+    virtual void GetSoftwareStateKey(uint32_t& color, uint32_t& step) const;
+    /* Blits the cached sprite of the state, rasterizing it by DrawSoftwareState first if needed. */
+    void DrawSoftwareStateSprite(BufferInfo& gfxDstBuffer, const Rect& trunc);
+    uint8_t* RasterizeSoftwareState(int16_t width, int16_t height);
 #if DEFAULT_ANIMATION
     virtual void ResetCallback();
     void Callback(UIView* view) override;
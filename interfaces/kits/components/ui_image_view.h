@@ -223,6 +223,29 @@ public:
         return static_cast<TransformAlgorithm>(algorithm_);
     }
 
+    /**
+     * @brief Clips this image to a circle.
+     *
+     * Only the pixels inside the circle are drawn, the image data stays untouched. The clip is not applied when the
+     * image is rotated or scaled.
+     *
+     * @param center Indicates the center of the circle, relative to the top left pixel of the image.
+     * @param radius Indicates the radius of the circle. <b>0</b> removes the clip.
+     * @since 6
+     */
+    void SetClipCircle(const Point& center, int16_t radius);
+
+    /**
+     * @brief Obtains the radius of the circle this image is clipped to.
+     *
+     * @return Returns the radius, or <b>0</b> if the image is not clipped.
+     * @since 6
+     */
+    int16_t GetClipRadius() const
+    {
+        return clipRadius_;
+    }
+
     /**
      * @brief Obtains the image path in binary.
      *
@@ -315,6 +338,12 @@ protected:
 
 private:
     void ReMeasure() override;
+    const ClipMask* GetClipMask();
+
+    /* built on the next draw from the circle, for the size of the image at that time */
+    ClipMask* clipMask_ = nullptr;
+    Point clipCenter_ = {0, 0};
+    int16_t clipRadius_ = 0;
 #if (ENABLE_GIF == 1)
     friend class GifImageAnimator;
     void AddAndStartGifAnimator();
@@ -43,6 +43,8 @@
 #endif
 
 namespace OHOS {
+class LabelStrip;
+
 /**
  * @brief Defines the functions for presenting a label in a specified area, setting the style and background color
  *        of a label, and setting the display mode of a long label text.
@@ -399,6 +401,37 @@ public:
      */
     int16_t GetRollStartPos() const;
 
+    /**
+     * @brief Sets whether a rolling text is drawn from a pre-rendered strip.
+     *
+     * When enabled, the text of a {@link LINE_BREAK_MARQUEE} label that rolls is rendered once into an ARGB8888
+     * strip and each frame only blits the strip at the current roll position. The strip is rendered again when the
+     * text, font, color or size changes. All strips together use at most {@link MARQUEE_STRIP_MAX_SIZE} bytes, a
+     * label whose strip does not fit draws its text directly.
+     *
+     * @param enable Specifies whether to use the strip. The default value is <b>false</b>.
+     */
+    void SetMarqueeStripEnable(bool enable);
+
+    /**
+     * @brief Checks whether a rolling text is drawn from a pre-rendered strip.
+     *
+     * @return Returns <b>true</b> if the strip is enabled; returns <b>false</b> otherwise.
+     */
+    bool IsMarqueeStripEnabled() const
+    {
+        return useMarqueeStrip_;
+    }
+
+    /**
+     * @brief Obtains the bytes held by the marquee strips of all labels.
+     *
+     * @return Returns the bytes held by the strips.
+     */
+    static uint32_t GetMarqueeStripSize();
+
+    static constexpr uint32_t MARQUEE_STRIP_MAX_SIZE = 128 * 1024; // 128 * 1024: 128KB
+
     /**
      * @brief Sets the width for this label.
      *
@@ -452,14 +485,19 @@ private:
     friend class LabelAnimator;
 
     void RemeasureForMarquee(int16_t textWidth);
+    bool DrawMarqueeStrip(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea, const Style& style,
+                          OpacityType opa);
+    void ReleaseMarqueeStrip();
 
     bool needRefresh_ : 1;
     bool useTextColor_ : 1;
     bool hasAnimator_ : 1;
     uint8_t lineBreakMode_ : 4;
+    bool useMarqueeStrip_ : 1;
     uint16_t ellipsisIndex_;
     int16_t offsetX_;
     ColorType textColor_;
+    LabelStrip* strip_;
 
     static constexpr uint16_t DEFAULT_ANIMATOR_SPEED = 35;
     union {
@@ -134,6 +134,8 @@ public:
 
 protected:
     void CalculateSize() override;
+    void DrawSoftwareState(BufferInfo& gfxDstBuffer, const Rect& contentRect, const Rect& trunc) override;
+    void GetSoftwareStateKey(uint32_t& color, uint32_t& step) const override;
 #if DEFAULT_ANIMATION
     void Callback(UIView* view) override;
 #endif
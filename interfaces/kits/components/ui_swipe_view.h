@@ -296,6 +296,68 @@ public:
         return alignMode_;
     }
 
+    /**
+     * @brief Sets whether the pages are drawn from snapshots while they swipe.
+     *
+     * When enabled, the current page and the pages next to it are rendered once into ARGB8888 buffers when a drag or
+     * an animated page switch starts, and each frame of the swipe only blits the buffers at the current offset. The
+     * pages are drawn live again when the swipe settles, so changes of their contents during the swipe show once it
+     * has settled. A page whose snapshot does not fit into {@link SetSnapshotMaxSize} bytes is drawn live during the
+     * swipe, and no snapshots are taken when this view or a view in a page is transformed. A page that is not fully
+     * covered by its own opaque background is snapshot over the background of this view, so it is drawn live when
+     * neither background is opaque.
+     *
+     * @param enable Specifies whether to use snapshots. The default value is <b>false</b>.
+     * @since 6
+     */
+    void SetSnapshotEnable(bool enable);
+
+    /**
+     * @brief Checks whether the pages are drawn from snapshots while they swipe.
+     *
+     * @return Returns <b>true</b> if snapshots are enabled; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool IsSnapshotEnabled() const
+    {
+        return useSnapshot_;
+    }
+
+    /**
+     * @brief Sets the bytes the snapshots of this view may use together.
+     *
+     * @param size Indicates the size in bytes. The default value is {@link DEFAULT_SNAPSHOT_MAX_SIZE}.
+     * @since 6
+     */
+    void SetSnapshotMaxSize(uint32_t size)
+    {
+        snapshotMaxSize_ = size;
+    }
+
+    /**
+     * @brief Obtains the bytes the snapshots of this view may use together.
+     *
+     * @return Returns the size in bytes.
+     * @since 6
+     */
+    uint32_t GetSnapshotMaxSize() const
+    {
+        return snapshotMaxSize_;
+    }
+
+    /**
+     * @brief Obtains the bytes held by the snapshots of this view, <b>0</b> when no swipe is drawn from snapshots.
+     *
+     * @return Returns the size in bytes.
+     * @since 6
+     */
+    uint32_t GetSnapshotSize() const
+    {
+        return snapshotSize_;
+    }
+
+    void OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea) override;
+
     /**
      * @brief Indicates the horizontal direction.
      *
@@ -312,6 +374,13 @@ public:
      */
     static constexpr uint8_t VERTICAL = 1;
 
+    /**
+     * @brief Indicates the default bytes the snapshots of a view may use together.
+     *
+     * @since 6
+     */
+    static constexpr uint32_t DEFAULT_SNAPSHOT_MAX_SIZE = 1024 * 1024; // 1024 * 1024: 1MB
+
     void SetXScrollBarVisible(bool visible) = delete;
 
     void SetYScrollBarVisible(bool visible) = delete;
@@ -376,6 +445,28 @@ private:
     void CurrentIndexInc();
     void CurrentIndexDec();
     void Vibrator();
+
+    /* the current page and the pages before and after it */
+    static constexpr uint8_t SNAPSHOT_PAGE_NUM = 3;
+
+    struct PageSnapshot {
+        UIView* view;
+        uint8_t* data;
+        int16_t width;
+        int16_t height;
+    };
+
+    void StartSnapshot();
+    void StopSnapshot();
+    void ReleaseSnapshots();
+    bool IsOpaqueOver(const UIView& view, const Rect& area) const;
+    bool TakeSnapshot(PageSnapshot& snapshot, UIView* view);
+    const PageSnapshot* GetSnapshot(const UIView* view) const;
+
+    PageSnapshot snapshots_[SNAPSHOT_PAGE_NUM];
+    uint32_t snapshotMaxSize_;
+    uint32_t snapshotSize_;
+    bool useSnapshot_;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_UI_SWIPE_VIEW_H
@@ -438,6 +438,18 @@ public:
      */
     virtual ~UIView();
 
+    /**
+     * @brief Obtains a number that changes whenever a view is destroyed.
+     *
+     * While this number is unchanged, a pointer to a view that was valid before is still valid.
+     *
+     * @return Returns the destroy generation.
+     */
+    static uint32_t GetDestroyGeneration()
+    {
+        return destroyGeneration_;
+    }
+
     /**
      * @brief Called before a view is drawn. This function is used to check whether the invalidated area
      *        can be fully cover by this view so as to optimize the drawing process.
@@ -471,6 +483,23 @@ public:
      */
     virtual void ReMeasure() {}
 
+    /**
+     * @brief Marks the view as waiting for a measure pass. The mark is propagated to the ancestors so that the
+     *        measure pass only walks the subtrees that contain marked views.
+     * @since 6
+     */
+    void RequestMeasure();
+
+    /**
+     * @brief Checks whether the view or one of its descendants waits for a measure pass.
+     * @return Returns <b>true</b> if a measure pass is needed; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool IsNeedMeasure() const
+    {
+        return needMeasure_;
+    }
+
     /**
      * @brief Refreshes the invalidated area of the view.
      * @since 1.0
@@ -918,6 +947,7 @@ public:
             int16_t newWidth = width + style_->paddingLeft_ + style_->paddingRight_ +
                                (style_->borderWidth_ * 2); /* 2: left and right border */
             rect_.SetWidth(newWidth);
+            RequestMeasure();
         }
     }
 
@@ -953,6 +983,7 @@ public:
             int16_t newHeight = height + style_->paddingTop_ + style_->paddingBottom_ +
                                 (style_->borderWidth_ * 2); /* 2: top and bottom border */
             rect_.SetHeight(newHeight);
+            RequestMeasure();
         }
     }
 
@@ -1433,6 +1464,9 @@ public:
     /**
      * @brief Sets a style.
      *
+     * The view does not keep a private copy of the changed style. Views whose styles have the same values share one
+     * pooled style, so the style obtained by {@link GetStyleConst} must not be changed.
+     *
      * @param key Indicates the key of the style to set.
      * @param value Indicates the value matching the key.
      * @since 1.0
@@ -1719,6 +1753,7 @@ protected:
     bool needRedraw_ : 1;
     bool styleAllocFlag_ : 1;
     bool isIntercept_ : 1;
+    bool needMeasure_ : 1;
 #if ENABLE_FOCUS_MANAGER
     bool focusable_ : 1;
 #endif
@@ -1747,6 +1782,10 @@ protected:
     void UpdateRectInfo(uint8_t key, const Rect& rect);
 
 private:
+    friend class RootView;
+
+    static uint32_t destroyGeneration_;
+
     Rect rect_;
     Rect* visibleRect_;
     void SetupThemeStyles();
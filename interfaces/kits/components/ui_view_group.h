@@ -174,6 +174,19 @@ public:
         return childrenTail_;
     }
 
+    /**
+     * @brief Obtains a number that changes whenever a view is added to or removed from any view group.
+     *
+     * A view that was in a view tree is still in it as long as this number is unchanged, so code that holds on to
+     * such a view can skip searching the tree for it again.
+     *
+     * @return Returns the attach generation.
+     */
+    static uint32_t GetAttachGeneration()
+    {
+        return attachGeneration_;
+    }
+
     /**
      * @brief Sets whether this view group is intercepted upon touch events.
      *
@@ -210,6 +223,18 @@ public:
         isAutoSize_ = state;
     }
 
+    /**
+     * @brief Checks whether this view group draws its child views itself in <b>OnDraw</b>. The render loop then does
+     *        not visit the child views.
+     *
+     * @return Returns <b>true</b> if the child views are drawn by this view group; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool IsChildrenDrawnByGroup() const
+    {
+        return childrenDrawnByGroup_;
+    }
+
 #if ENABLE_FOCUS_MANAGER
     /**
      * @brief 设置组件是否拦截焦点.
@@ -246,6 +271,29 @@ protected:
      */
     Rect GetAllChildRelativeRect() const;
 
+    /**
+     * @brief Draws a view and its children into a buffer the way the root view draws them, for groups that draw
+     *        their children themselves.
+     *
+     * @param gfxDstBuffer Indicates the buffer to draw into.
+     * @param view Indicates the view to draw.
+     * @param mask Indicates the area to draw.
+     * @param depth Indicates the nesting depth of the view.
+     * @since 6
+     */
+    static void DrawViewTree(BufferInfo& gfxDstBuffer, UIView* view, const Rect& mask, uint8_t depth = 0);
+
+    /**
+     * @brief Checks whether a view or any of its children is drawn through the map buffer of the root view, which
+     *        {@link DrawViewTree} does not have.
+     *
+     * @param view Indicates the view to check.
+     * @param depth Indicates the nesting depth of the view.
+     * @return Returns <b>true</b> if a view is transformed; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    static bool IsViewTreeTransformed(UIView* view, uint8_t depth = 0);
+
     /**
      * @brief Performs operations needed after a child view is added or removed.
      *
@@ -284,7 +332,14 @@ protected:
      */
     bool isAutoSize_;
 
+    /**
+     * @brief Specifies whether this view group draws its child views itself, see {@link IsChildrenDrawnByGroup}.
+     */
+    bool childrenDrawnByGroup_;
+
 private:
+    static uint32_t attachGeneration_;
+
     void AutoResize();
 #if ENABLE_FOCUS_MANAGER
     bool isInterceptFocus_ : 1;
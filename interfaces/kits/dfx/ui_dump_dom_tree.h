@@ -52,6 +52,18 @@ enum DumpMode {
     /** DOM node */
     DUMP_NODE
 };
+
+/**
+ * @brief Enumerates the formats of an exported DOM tree.
+ */
+enum DumpFormat {
+    /** The JSON text printed by cJSON_Print */
+    DUMP_FORMAT_JSON,
+    /** A compact binary form for very large trees, see DumpBinaryWriter */
+    DUMP_FORMAT_BINARY
+};
+
+class DumpDomWriter;
 #endif // ENABLE_DEBUG
 
 /**
@@ -99,6 +111,21 @@ public:
         return DumpDomTree(id, nullptr);
     }
 
+#if ENABLE_DEBUG
+    /**
+     * @brief Exports information about a DOM tree starting from a specified DOM node and saves the information to
+     * a specified path in a specified format. The tree is written to the file while it is traversed, without
+     * building it in memory first.
+     *
+     * @param id Indicates the pointer to the DOM node ID, or <b>nullptr</b> for the whole tree.
+     * @param path Indicates the pointer to the specified path, or <b>nullptr</b> for the default path.
+     * @param format Indicates the format of the file. For details, see {@link DumpFormat}.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool DumpDomTree(const char* id, const char* path, DumpFormat format);
+#endif // ENABLE_DEBUG
+
     /**
      * @brief Exports information about a specified DOM node.
      *
@@ -112,41 +139,28 @@ public:
 
 private:
 #if ENABLE_DEBUG
-    bool searchFlag_;     // Search flag, set when find the view with right id.
-    bool allocErrorFlag_; // Alloc error flag, set when cJSON fails to allocate memory.
-    char* pJson_;         // Pointer for returning cJSON string.
-    cJSON* rootJson_;     // Root pointer of cJSON structure.
-    const char* path_;
+    UIView* SearchViewById(UIView* view, const char* id) const;
 
-    void DumpJsonById(UIView* view, const char* id, DumpMode mode);
+    void AddNameField(UIViewType type, DumpDomWriter& writer) const;
+    void AddCommonField(UIView* view, DumpDomWriter& writer) const;
+    void AddImageViewSpecialField(const UIView* view, DumpDomWriter& writer) const;
+    void AddLabelField(const UIView* view, DumpDomWriter& writer) const;
+    void AddLabelButtonField(const UIView* view, DumpDomWriter& writer) const;
+    void AddCheckboxField(const UIView* view, DumpDomWriter& writer) const;
+    void AddToggleButtonField(const UIView* view, DumpDomWriter& writer) const;
+    void AddProgressField(const UIView* view, DumpDomWriter& writer) const;
+    void AddScrollViewField(const UIView* view, DumpDomWriter& writer) const;
+    void AddListField(const UIView* view, DumpDomWriter& writer) const;
+    void AddClockField(const UIView* view, DumpDomWriter& writer) const;
+    void AddPickerField(const UIView* view, DumpDomWriter& writer) const;
+    void AddSwipeViewField(const UIView* view, DumpDomWriter& writer) const;
+    void AddTimePickerField(const UIView* view, DumpDomWriter& writer) const;
+    void AddSpecialField(const UIView* view, DumpDomWriter& writer) const;
+    void OutputDomNode(UIView* view, DumpDomWriter& writer) const;
+    void OutputDomTree(UIView* view, DumpDomWriter& writer, const char* key) const;
+    bool WriteDumpFile(UIView* view, const char* path, DumpFormat format) const;
 
-    void AddNameField(UIViewType type, cJSON* usr) const;
-    void AddCommonField(UIView* view, cJSON* usr) const;
-    void AddImageViewSpecialField(const UIView* view, cJSON* usr) const;
-    void AddLabelField(const UIView* view, cJSON* usr) const;
-    void AddLabelButtonField(const UIView* view, cJSON* usr) const;
-    void AddCheckboxField(const UIView* view, cJSON* usr) const;
-    void AddToggleButtonField(const UIView* view, cJSON* usr) const;
-    void AddProgressField(const UIView* view, cJSON* usr) const;
-    void AddScrollViewField(const UIView* view, cJSON* usr) const;
-    void AddListField(const UIView* view, cJSON* usr) const;
-    void AddClockField(const UIView* view, cJSON* usr) const;
-    void AddPickerField(const UIView* view, cJSON* usr) const;
-    void AddSwipeViewField(const UIView* view, cJSON* usr) const;
-    void AddTimePickerField(const UIView* view, cJSON* usr) const;
-    void AddSpecialField(const UIView* view, cJSON* usr) const;
-    void OutputDomNode(UIView* view);
-    void OutputDomTree(UIView* view, cJSON* usr);
-    bool WriteDumpFile() const;
-
-    UIDumpDomTree()
-        : searchFlag_(false),
-          allocErrorFlag_(false),
-          pJson_(nullptr),
-          rootJson_(nullptr),
-          path_(DEFAULT_DUMP_DOM_TREE_PATH)
-    {
-    }
+    UIDumpDomTree() {}
 #else
     UIDumpDomTree() {}
 #endif // ENABLE_DEBUG
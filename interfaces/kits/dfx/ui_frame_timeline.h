@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_DFX
+ * @{
+ *
+ * @brief Provides test and analysis capabilities, such as stimulating input events and viewing information about a
+ *        Document Object Model (DOM) tree.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ui_frame_timeline.h
+ *
+ * @brief Declares the frame timeline recorder, which keeps the timestamps of every frame phase in a ring buffer and
+ *        exports them in the Chrome trace-event format.
+ *
+ * The recorder only exists when both <b>ENABLE_DEBUG</b> and <b>ENABLE_DEBUG_FRAME_TIMELINE</b> are set. Otherwise
+ * the recording macros expand to nothing, so the render path carries no cost at all. While recording, a scope costs
+ * two clock reads and one ring buffer store, about 0.1 us on an x86 desktop; once recording is stopped, it costs a
+ * single branch, a few nanoseconds.
+ *
+ * @since 6
+ */
+#ifndef GRAPHIC_LITE_UI_FRAME_TIMELINE_H
+#define GRAPHIC_LITE_UI_FRAME_TIMELINE_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/** Maximum number of events kept in the ring buffer of the frame timeline */
+static constexpr uint16_t FRAME_TIMELINE_MAX_EVENT_NUM = 1024;
+
+/**
+ * @brief Enumerates the phases of a frame recorded by the timeline.
+ *
+ * @since 6
+ */
+enum FramePhase : uint8_t {
+    /** One run of <b>TaskManager::TaskHandler</b> */
+    FRAME_PHASE_TASK_HANDLER,
+    /** Reading and dispatching the events of one input device */
+    FRAME_PHASE_INPUT,
+    /** One <b>RenderManager::Callback</b>, the whole frame */
+    FRAME_PHASE_RENDER,
+    /** Measure pass of the view tree */
+    FRAME_PHASE_MEASURE,
+    /** Merging of the invalidated rectangles */
+    FRAME_PHASE_MERGE_RECTS,
+    /** Drawing of one invalidated rectangle */
+    FRAME_PHASE_DRAW_TOP,
+    /** Flushing the frame buffer to the display */
+    FRAME_PHASE_FLUSH,
+    FRAME_PHASE_MAX
+};
+
+/**
+ * @brief Stores one recorded phase.
+ *
+ * @since 6
+ */
+struct FrameTimelineEvent {
+    /** Start time of the phase, in microseconds */
+    uint64_t startUs;
+    /** Duration of the phase, in microseconds */
+    uint32_t durationUs;
+    /** Frame counter when the phase started */
+    uint32_t frameId;
+    /** Phase, as defined in {@link FramePhase} */
+    FramePhase phase;
+};
+
+/**
+ * @brief Records frame phases into a fixed-size ring buffer. When the buffer is full the oldest events are
+ *        overwritten, so the recorder never allocates memory after construction.
+ *
+ * @since 6
+ */
+class UIFrameTimeline : public HeapBase {
+public:
+    /**
+     * @brief Obtains a singleton <b>UIFrameTimeline</b> instance.
+     *
+     * @return Returns the <b>UIFrameTimeline</b> instance.
+     * @since 6
+     */
+    static UIFrameTimeline* GetInstance();
+
+    /**
+     * @brief Obtains the current time of a monotonic clock.
+     *
+     * @return Returns the time in microseconds.
+     * @since 6
+     */
+    static uint64_t GetTimeUs();
+
+    /**
+     * @brief Starts or stops recording. Recording is stopped by default.
+     *
+     * @param record Specifies whether to record the frame phases.
+     * @since 6
+     */
+    void SetRecordState(bool record)
+    {
+        record_ = record;
+    }
+
+    /**
+     * @brief Obtains whether frame phases are being recorded.
+     *
+     * @return Returns <b>true</b> if recording; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool GetRecordState() const
+    {
+        return record_;
+    }
+
+    /**
+     * @brief Increases the frame counter. Called at the start of every frame.
+     *
+     * @since 6
+     */
+    void BeginFrame()
+    {
+        frameId_++;
+    }
+
+    /**
+     * @brief Records a finished phase.
+     *
+     * @param phase Indicates the phase.
+     * @param startUs Indicates the start time of the phase, in microseconds.
+     * @param endUs Indicates the end time of the phase, in microseconds.
+     * @since 6
+     */
+    void Record(FramePhase phase, uint64_t startUs, uint64_t endUs);
+
+    /**
+     * @brief Obtains the number of events in the ring buffer.
+     *
+     * @return Returns the number of events.
+     * @since 6
+     */
+    uint16_t GetEventCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Obtains a recorded event. Index <b>0</b> is the oldest event.
+     *
+     * @param index Indicates the index of the event.
+     * @param event Indicates the event to output.
+     * @return Returns <b>true</b> if the event exists; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool GetEvent(uint16_t index, FrameTimelineEvent& event) const;
+
+    /**
+     * @brief Discards all recorded events.
+     *
+     * @since 6
+     */
+    void Clear()
+    {
+        head_ = 0;
+        count_ = 0;
+    }
+
+    /**
+     * @brief Obtains the name of a phase as used in the exported trace.
+     *
+     * @param phase Indicates the phase.
+     * @return Returns the name of the phase.
+     * @since 6
+     */
+    static const char* GetPhaseName(FramePhase phase);
+
+    /**
+     * @brief Exports the recorded events as Chrome trace-event JSON, which can be opened in chrome://tracing or
+     *        Perfetto.
+     *
+     * @param path Indicates the pointer to the path of the output file.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool ExportChromeTrace(const char* path) const;
+
+private:
+    UIFrameTimeline() : record_(false), head_(0), count_(0), frameId_(0) {}
+    virtual ~UIFrameTimeline() {}
+
+    UIFrameTimeline(const UIFrameTimeline&) = delete;
+    UIFrameTimeline& operator=(const UIFrameTimeline&) = delete;
+    UIFrameTimeline(UIFrameTimeline&&) = delete;
+    UIFrameTimeline& operator=(UIFrameTimeline&&) = delete;
+
+    bool record_;
+    uint16_t head_;
+    uint16_t count_;
+    uint32_t frameId_;
+    FrameTimelineEvent events_[FRAME_TIMELINE_MAX_EVENT_NUM];
+};
+
+/**
+ * @brief Records the lifetime of a scope as one phase.
+ *
+ * @since 6
+ */
+class FrameTimelineScope {
+public:
+    explicit FrameTimelineScope(FramePhase phase)
+        : phase_(phase), startUs_(UIFrameTimeline::GetInstance()->GetRecordState() ? UIFrameTimeline::GetTimeUs() : 0)
+    {
+    }
+
+    ~FrameTimelineScope()
+    {
+        UIFrameTimeline* timeline = UIFrameTimeline::GetInstance();
+        if (timeline->GetRecordState() && (startUs_ != 0)) {
+            timeline->Record(phase_, startUs_, UIFrameTimeline::GetTimeUs());
+        }
+    }
+
+private:
+    FrameTimelineScope(const FrameTimelineScope&) = delete;
+    FrameTimelineScope& operator=(const FrameTimelineScope&) = delete;
+
+    FramePhase phase_;
+    uint64_t startUs_;
+};
+} // namespace OHOS
+#define DEBUG_FRAME_TIMELINE_BEGIN_FRAME() OHOS::UIFrameTimeline::GetInstance()->BeginFrame()
+#define DEBUG_FRAME_TIMELINE_SCOPE(phase) OHOS::FrameTimelineScope frameTimelineScope(phase)
+#else
+#define DEBUG_FRAME_TIMELINE_BEGIN_FRAME()
+#define DEBUG_FRAME_TIMELINE_SCOPE(phase)
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
+#endif // GRAPHIC_LITE_UI_FRAME_TIMELINE_H
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_DFX
+ * @{
+ *
+ * @brief Provides test and analysis capabilities, such as stimulating input events and viewing information about a
+ *        Document Object Model (DOM) tree.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ui_input_latency.h
+ *
+ * @brief Declares the input latency histogram, which measures the time from reading an input sample to flushing the
+ *        first frame after it.
+ *
+ * The histogram only exists when both <b>ENABLE_DEBUG</b> and <b>ENABLE_DEBUG_INPUT_LATENCY</b> are set. Otherwise
+ * the recording macros expand to nothing, so the input and render paths carry no cost at all.
+ *
+ * @since 6
+ */
+#ifndef GRAPHIC_LITE_UI_INPUT_LATENCY_H
+#define GRAPHIC_LITE_UI_INPUT_LATENCY_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/** Number of histogram buckets. Bucket <b>i</b> counts latencies below 2^i milliseconds, the last one the rest. */
+static constexpr uint8_t INPUT_LATENCY_BUCKET_NUM = 10;
+/** Maximum number of samples waiting for a flush, later samples are only counted as dropped */
+static constexpr uint8_t INPUT_LATENCY_MAX_PENDING_NUM = 32;
+
+/**
+ * @brief Collects the latency from input samples to the flush of the next frame into a histogram.
+ *
+ * Every sample read by an input device is stamped when it is read. When the root view flushes a frame, all the
+ * samples read before get the time to that flush as their latency, so a sample that changes nothing on screen is
+ * counted with the next frame that does change.
+ *
+ * @since 6
+ */
+class UIInputLatency : public HeapBase {
+public:
+    /**
+     * @brief Obtains a singleton <b>UIInputLatency</b> instance.
+     *
+     * @return Returns the <b>UIInputLatency</b> instance.
+     * @since 6
+     */
+    static UIInputLatency* GetInstance();
+
+    /**
+     * @brief Obtains the current time of a monotonic clock.
+     *
+     * @return Returns the time in microseconds.
+     * @since 6
+     */
+    static uint64_t GetTimeUs();
+
+    /**
+     * @brief Starts or stops recording. Recording is stopped by default.
+     *
+     * @param record Specifies whether to record latencies.
+     * @since 6
+     */
+    void SetRecordState(bool record)
+    {
+        record_ = record;
+        pendingNum_ = 0;
+    }
+
+    /**
+     * @brief Obtains whether latencies are being recorded.
+     *
+     * @return Returns <b>true</b> if recording; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool GetRecordState() const
+    {
+        return record_;
+    }
+
+    /**
+     * @brief Records that an input sample was read.
+     *
+     * @param timeUs Indicates the time the sample was read, in microseconds.
+     * @since 6
+     */
+    void RecordInput(uint64_t timeUs);
+
+    /**
+     * @brief Records that a frame was flushed and adds the latency of every sample read before it.
+     *
+     * @param timeUs Indicates the time of the flush, in microseconds.
+     * @since 6
+     */
+    void RecordFlush(uint64_t timeUs);
+
+    /**
+     * @brief Obtains the number of samples in the histogram.
+     *
+     * @return Returns the number of samples.
+     * @since 6
+     */
+    uint32_t GetSampleCount() const
+    {
+        return sampleCount_;
+    }
+
+    /**
+     * @brief Obtains the number of samples of a bucket.
+     *
+     * @param index Indicates the index of the bucket.
+     * @return Returns the number of samples, or <b>0</b> if the bucket does not exist.
+     * @since 6
+     */
+    uint32_t GetBucketCount(uint8_t index) const
+    {
+        return (index < INPUT_LATENCY_BUCKET_NUM) ? buckets_[index] : 0;
+    }
+
+    /**
+     * @brief Obtains the exclusive upper bound of a bucket.
+     *
+     * @param index Indicates the index of the bucket.
+     * @return Returns the bound in microseconds, <b>UINT32_MAX</b> for the last bucket.
+     * @since 6
+     */
+    static uint32_t GetBucketUpperUs(uint8_t index);
+
+    /**
+     * @brief Obtains the largest latency recorded.
+     *
+     * @return Returns the latency in microseconds.
+     * @since 6
+     */
+    uint32_t GetMaxUs() const
+    {
+        return maxUs_;
+    }
+
+    /**
+     * @brief Obtains the average latency.
+     *
+     * @return Returns the latency in microseconds, or <b>0</b> if no sample was recorded.
+     * @since 6
+     */
+    uint32_t GetAverageUs() const
+    {
+        return (sampleCount_ == 0) ? 0 : static_cast<uint32_t>(sumUs_ / sampleCount_);
+    }
+
+    /**
+     * @brief Obtains the number of samples that were not recorded because more than
+     *        {@link INPUT_LATENCY_MAX_PENDING_NUM} samples were read between two flushes.
+     *
+     * @return Returns the number of samples.
+     * @since 6
+     */
+    uint32_t GetDroppedCount() const
+    {
+        return droppedCount_;
+    }
+
+    /**
+     * @brief Discards the histogram and the samples waiting for a flush.
+     *
+     * @since 6
+     */
+    void Clear();
+
+private:
+    UIInputLatency()
+        : record_(false), pendingNum_(0), sampleCount_(0), droppedCount_(0), maxUs_(0), sumUs_(0), buckets_{0},
+          pendingUs_{0}
+    {
+    }
+    virtual ~UIInputLatency() {}
+
+    UIInputLatency(const UIInputLatency&) = delete;
+    UIInputLatency& operator=(const UIInputLatency&) = delete;
+    UIInputLatency(UIInputLatency&&) = delete;
+    UIInputLatency& operator=(UIInputLatency&&) = delete;
+
+    bool record_;
+    uint8_t pendingNum_;
+    uint32_t sampleCount_;
+    uint32_t droppedCount_;
+    uint32_t maxUs_;
+    uint64_t sumUs_;
+    uint32_t buckets_[INPUT_LATENCY_BUCKET_NUM];
+    uint64_t pendingUs_[INPUT_LATENCY_MAX_PENDING_NUM];
+};
+} // namespace OHOS
+#define DEBUG_INPUT_LATENCY_RECORD_INPUT()                                                          \
+    do {                                                                                            \
+        if (OHOS::UIInputLatency::GetInstance()->GetRecordState()) {                                \
+            OHOS::UIInputLatency::GetInstance()->RecordInput(OHOS::UIInputLatency::GetTimeUs());    \
+        }                                                                                           \
+    } while (0)
+#define DEBUG_INPUT_LATENCY_RECORD_FLUSH()                                                          \
+    do {                                                                                            \
+        if (OHOS::UIInputLatency::GetInstance()->GetRecordState()) {                                \
+            OHOS::UIInputLatency::GetInstance()->RecordFlush(OHOS::UIInputLatency::GetTimeUs());    \
+        }                                                                                           \
+    } while (0)
+#else
+#define DEBUG_INPUT_LATENCY_RECORD_INPUT()
+#define DEBUG_INPUT_LATENCY_RECORD_FLUSH()
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
+#endif // GRAPHIC_LITE_UI_INPUT_LATENCY_H
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_DFX
+ * @{
+ *
+ * @brief Provides test and analysis capabilities, such as stimulating input events and viewing information about a
+ *        Document Object Model (DOM) tree.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ui_render_profiler.h
+ *
+ * @brief Declares the render profiler, which measures what every view costs to draw and shows how many times each
+ *        pixel of the screen is drawn.
+ *
+ * The profiler only exists when both <b>ENABLE_DEBUG</b> and <b>ENABLE_DEBUG_RENDER_PROFILER</b> are set. Otherwise
+ * the profiling macros expand to nothing, so the render path carries no cost at all.
+ *
+ * @since 6
+ */
+#ifndef GRAPHIC_LITE_UI_RENDER_PROFILER_H
+#define GRAPHIC_LITE_UI_RENDER_PROFILER_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
+#include "components/ui_view.h"
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/** Maximum number of views the profiler keeps costs for */
+static constexpr uint16_t RENDER_PROFILER_MAX_VIEW_NUM = 128;
+/** Maximum length of a view ID copied into {@link ViewRenderCost}, including the terminating null */
+static constexpr uint8_t RENDER_PROFILER_MAX_ID_LEN = 24;
+/** Default number of frames the costs are aggregated over */
+static constexpr uint16_t RENDER_PROFILER_DEFAULT_FRAME_NUM = 60;
+
+/**
+ * @brief Stores the drawing cost of one view, aggregated over the frames of a window.
+ *
+ * @since 6
+ */
+struct ViewRenderCost {
+    /** Address of the view. It only identifies the view and must not be dereferenced, the view may be gone. */
+    const UIView* view;
+    /** Type of the view */
+    UIViewType type;
+    /** ID of the view, truncated, or an empty string if it has none */
+    char id[RENDER_PROFILER_MAX_ID_LEN];
+    /** Number of <b>OnDraw</b> calls */
+    uint32_t drawCount;
+    /** Time spent in <b>OnDraw</b>, in microseconds */
+    uint32_t drawUs;
+    /** Time spent in <b>OnPostDraw</b>, in microseconds */
+    uint32_t postDrawUs;
+    /** Number of pixels of the areas passed to <b>OnDraw</b> */
+    uint64_t pixels;
+
+    uint32_t GetTotalUs() const
+    {
+        return drawUs + postDrawUs;
+    }
+};
+
+/**
+ * @brief Records the time every view spends in <b>OnDraw</b> and <b>OnPostDraw</b>, and the area it draws. The costs
+ *        are aggregated over a window of frames, and at the end of each window they become the report, sorted from
+ *        the most to the least expensive view. Only the time of a view itself is counted, its children are drawn
+ *        separately.
+ *
+ * In overdraw mode the profiler also counts how many times each pixel was drawn in the current frame, at the
+ * granularity of the areas passed to <b>OnDraw</b>, and paints the counts over the screen as a heatmap: a pixel drawn
+ * twice is tinted blue, three times green, four times pink and five times or more red.
+ *
+ * @since 6
+ */
+class UIRenderProfiler : public HeapBase {
+public:
+    /**
+     * @brief Obtains a singleton <b>UIRenderProfiler</b> instance.
+     *
+     * @return Returns the <b>UIRenderProfiler</b> instance.
+     * @since 6
+     */
+    static UIRenderProfiler* GetInstance();
+
+    /**
+     * @brief Obtains the current time of a monotonic clock.
+     *
+     * @return Returns the time in microseconds.
+     * @since 6
+     */
+    static uint64_t GetTimeUs();
+
+    /**
+     * @brief Starts or stops profiling the views. Profiling is stopped by default.
+     *
+     * @param profile Specifies whether to profile the views.
+     * @since 6
+     */
+    void SetProfileState(bool profile)
+    {
+        profile_ = profile;
+    }
+
+    /**
+     * @brief Obtains whether the views are being profiled.
+     *
+     * @return Returns <b>true</b> if profiling; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool GetProfileState() const
+    {
+        return profile_;
+    }
+
+    /**
+     * @brief Sets the number of frames the costs are aggregated over. The default value is
+     *        {@link RENDER_PROFILER_DEFAULT_FRAME_NUM}.
+     *
+     * @param frameNum Indicates the number of frames, at least <b>1</b>.
+     * @since 6
+     */
+    void SetFrameWindow(uint16_t frameNum)
+    {
+        frameWindow_ = (frameNum == 0) ? 1 : frameNum;
+    }
+
+    /**
+     * @brief Obtains the number of frames the costs are aggregated over.
+     *
+     * @return Returns the number of frames.
+     * @since 6
+     */
+    uint16_t GetFrameWindow() const
+    {
+        return frameWindow_;
+    }
+
+    /**
+     * @brief Counts a frame. Called at the start of every frame, the report is updated when a window is complete.
+     *
+     * @since 6
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Records one <b>OnDraw</b> or <b>OnPostDraw</b> call of a view.
+     *
+     * @param view Indicates the view.
+     * @param postDraw Specifies whether the call was <b>OnPostDraw</b>.
+     * @param startUs Indicates the start time of the call, in microseconds.
+     * @param endUs Indicates the end time of the call, in microseconds.
+     * @param area Indicates the area the view was asked to draw.
+     * @since 6
+     */
+    void Record(const UIView* view, bool postDraw, uint64_t startUs, uint64_t endUs, const Rect& area);
+
+    /**
+     * @brief Ends the current window early and makes the costs recorded so far the report.
+     *
+     * @since 6
+     */
+    void Publish();
+
+    /**
+     * @brief Obtains the report of the last complete window, sorted by the total time from the most expensive view.
+     *
+     * @param costs Indicates the array to output the costs to.
+     * @param num Indicates the size of the array.
+     * @return Returns the number of costs output.
+     * @since 6
+     */
+    uint16_t GetReport(ViewRenderCost* costs, uint16_t num) const;
+
+    /**
+     * @brief Obtains the number of frames of the report.
+     *
+     * @return Returns the number of frames.
+     * @since 6
+     */
+    uint16_t GetReportFrameNum() const
+    {
+        return reportFrameNum_;
+    }
+
+    /**
+     * @brief Obtains the number of draw calls that were not recorded because the table of views was full.
+     *
+     * @return Returns the number of draw calls.
+     * @since 6
+     */
+    uint32_t GetDroppedNum() const
+    {
+        return droppedNum_;
+    }
+
+    /**
+     * @brief Writes the report to a file as text, one view per line, from the most expensive view.
+     *
+     * @param path Indicates the pointer to the path of the output file.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool DumpReport(const char* path) const;
+
+    /**
+     * @brief Discards the recorded costs and the report.
+     *
+     * @since 6
+     */
+    void Clear();
+
+    /**
+     * @brief Shows or hides the overdraw heatmap. Showing it allocates one counter byte per pixel of the screen.
+     *
+     * @param show Specifies whether to show the heatmap.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool SetOverdrawState(bool show);
+
+    /**
+     * @brief Obtains whether the overdraw heatmap is shown.
+     *
+     * @return Returns <b>true</b> if the heatmap is shown; returns <b>false</b> otherwise.
+     * @since 6
+     */
+    bool GetOverdrawState() const
+    {
+        return overdrawCounts_ != nullptr;
+    }
+
+    /**
+     * @brief Resets the overdraw counts of an area before it is drawn.
+     *
+     * @param dst Indicates the buffer of the screen the area is drawn into.
+     * @param rect Indicates the area in screen coordinates.
+     * @since 6
+     */
+    void BeginOverdraw(const BufferInfo& dst, const Rect& rect);
+
+    /**
+     * @brief Counts one <b>OnDraw</b> call of a view in the overdraw counts. Calls drawing into another buffer than
+     *        the one passed to {@link BeginOverdraw}, such as the buffer of a transformed view, are not counted.
+     *
+     * @param view Indicates the view.
+     * @param dst Indicates the buffer the view draws into.
+     * @param area Indicates the area the view was asked to draw.
+     * @since 6
+     */
+    void AddOverdraw(const UIView* view, const BufferInfo& dst, const Rect& area);
+
+    /**
+     * @brief Paints the overdraw counts of an area over the buffer it was drawn into.
+     *
+     * @param dst Indicates the buffer.
+     * @param rect Indicates the area in screen coordinates.
+     * @since 6
+     */
+    void EndOverdraw(BufferInfo& dst, const Rect& rect);
+
+    /**
+     * @brief Obtains how many times a pixel was drawn in the current frame.
+     *
+     * @param x Indicates the x-coordinate of the pixel on the screen.
+     * @param y Indicates the y-coordinate of the pixel on the screen.
+     * @return Returns the count, which saturates at <b>255</b>, or <b>0</b> if the heatmap is not shown.
+     * @since 6
+     */
+    uint8_t GetOverdrawCount(int16_t x, int16_t y) const;
+
+private:
+    UIRenderProfiler()
+        : profile_(false),
+          frameWindow_(RENDER_PROFILER_DEFAULT_FRAME_NUM),
+          frameNum_(0),
+          reportFrameNum_(0),
+          reportNum_(0),
+          droppedNum_(0),
+          overdrawCounts_(nullptr),
+          overdrawBuffer_(nullptr),
+          overdrawWidth_(0),
+          overdrawHeight_(0)
+    {
+        Clear();
+    }
+    virtual ~UIRenderProfiler();
+
+    UIRenderProfiler(const UIRenderProfiler&) = delete;
+    UIRenderProfiler& operator=(const UIRenderProfiler&) = delete;
+    UIRenderProfiler(UIRenderProfiler&&) = delete;
+    UIRenderProfiler& operator=(UIRenderProfiler&&) = delete;
+
+    ViewRenderCost* FindCost(const UIView* view);
+    static bool IsDrawingNothing(const UIView* view);
+
+    bool profile_;
+    uint16_t frameWindow_;
+    uint16_t frameNum_;
+    uint16_t reportFrameNum_;
+    uint16_t reportNum_;
+    uint32_t droppedNum_;
+    uint8_t* overdrawCounts_;
+    const void* overdrawBuffer_;
+    int16_t overdrawWidth_;
+    int16_t overdrawHeight_;
+    /* open addressing by view address, a slot is free while its view is nullptr */
+    ViewRenderCost costs_[RENDER_PROFILER_MAX_VIEW_NUM];
+    ViewRenderCost report_[RENDER_PROFILER_MAX_VIEW_NUM];
+};
+
+/**
+ * @brief Records the lifetime of a scope as one draw call of a view.
+ *
+ * @since 6
+ */
+class RenderProfilerScope {
+public:
+    RenderProfilerScope(const UIView* view, const BufferInfo& dst, const Rect& area, bool postDraw)
+        : view_(view),
+          dst_(dst),
+          area_(area),
+          postDraw_(postDraw),
+          startUs_(UIRenderProfiler::GetInstance()->GetProfileState() ? UIRenderProfiler::GetTimeUs() : 0)
+    {
+    }
+
+    ~RenderProfilerScope()
+    {
+        UIRenderProfiler* profiler = UIRenderProfiler::GetInstance();
+        if (profiler->GetProfileState() && (startUs_ != 0)) {
+            profiler->Record(view_, postDraw_, startUs_, UIRenderProfiler::GetTimeUs(), area_);
+        }
+        if (!postDraw_ && profiler->GetOverdrawState()) {
+            profiler->AddOverdraw(view_, dst_, area_);
+        }
+    }
+
+private:
+    RenderProfilerScope(const RenderProfilerScope&) = delete;
+    RenderProfilerScope& operator=(const RenderProfilerScope&) = delete;
+
+    const UIView* view_;
+    const BufferInfo& dst_;
+    const Rect& area_;
+    bool postDraw_;
+    uint64_t startUs_;
+};
+} // namespace OHOS
+#define DEBUG_RENDER_PROFILER_BEGIN_FRAME() OHOS::UIRenderProfiler::GetInstance()->BeginFrame()
+#define DEBUG_RENDER_PROFILER_SCOPE(view, dst, area, postDraw) \
+    OHOS::RenderProfilerScope renderProfilerScope(view, dst, area, postDraw)
+#define DEBUG_RENDER_PROFILER_BEGIN_OVERDRAW(dst, rect) OHOS::UIRenderProfiler::GetInstance()->BeginOverdraw(dst, rect)
+#define DEBUG_RENDER_PROFILER_END_OVERDRAW(dst, rect) OHOS::UIRenderProfiler::GetInstance()->EndOverdraw(dst, rect)
+#else
+#define DEBUG_RENDER_PROFILER_BEGIN_FRAME()
+#define DEBUG_RENDER_PROFILER_SCOPE(view, dst, area, postDraw)
+#define DEBUG_RENDER_PROFILER_BEGIN_OVERDRAW(dst, rect)
+#define DEBUG_RENDER_PROFILER_END_OVERDRAW(dst, rect)
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
+#endif // GRAPHIC_LITE_UI_RENDER_PROFILER_H
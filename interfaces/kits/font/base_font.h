@@ -83,6 +83,19 @@ public:
 
     virtual uint8_t* GetBitmapSpannable(uint32_t unicode, GlyphNode& glyphNode, uint8_t fontId, uint8_t size) = 0;
 
+    /**
+     * @brief Rasterizes a glyph of the current font rotated clockwise by angle degrees, around the point pivotY pixels
+     *        above the origin of the glyph on the baseline. glyphNode.left and glyphNode.top place the rotated bitmap
+     *        like those of an unrotated one.
+     *
+     * @return uint8_t*: a new 8 bit coverage bitmap of glyphNode.cols * glyphNode.rows bytes released by the caller
+     *         with delete[], or nullptr if the font library cannot rasterize rotated glyphs
+     */
+    virtual uint8_t* GetRotatedBitmap(uint32_t unicode, int16_t angle, int16_t pivotY, GlyphNode& glyphNode)
+    {
+        return nullptr;
+    }
+
     /**
      * @brief Get font header
      *
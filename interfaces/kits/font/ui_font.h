@@ -126,6 +126,16 @@ public:
 
     uint8_t* GetBitmapSpannable(uint32_t unicode, GlyphNode& glyphNode, uint8_t fontId, uint8_t size);
 
+    /**
+     * @brief Get a glyph rasterized at an angle, see BaseFont::GetRotatedBitmap
+     *
+     * @return uint8_t*: a new 8 bit coverage bitmap released with delete[], or nullptr
+     */
+    uint8_t* GetRotatedBitmap(uint32_t unicode, int16_t angle, int16_t pivotY, GlyphNode& glyphNode)
+    {
+        return instance_->GetRotatedBitmap(unicode, angle, pivotY, glyphNode);
+    }
+
     /**
      * @brief Indicates whether the current font library is a vector font library.
      * @return uint8_t: 0 BitmapFont  1 VectorFont
@@ -64,7 +64,7 @@ public:
      * @since 1.0
      * @version 1.0
      */
-    virtual ~FlexLayout() {}
+    virtual ~FlexLayout();
 
     /**
      * @brief Sets the alignment mode of the primary axis (the axis where the layout direction is located).
@@ -103,7 +103,9 @@ public:
     }
 
     /**
-     * @brief Lays out all child views according to the preset arrangement mode.
+     * @brief Lays out all child views according to the preset arrangement mode. The sizes and margins of the
+     *        children are cached, so only the children from the first changed one on are placed again, and nothing
+     *        is placed if neither the children nor the layout attributes changed.
      * @param needInvalidate Specifies whether to refresh the invalidated area after the layout is complete.
      *                       Value <b>true</b> means to refresh the invalidated area after the layout is complete,
      *                       and <b>false</b> means the opposite.
@@ -113,30 +115,66 @@ public:
     void LayoutChildren(bool needInvalidate = false) override;
 
 private:
-    void LayoutHorizontal();
-    void LayoutVertical();
-    void CalValidLength(uint16_t& totalValidLength, uint16_t& allChildNum);
-    void GetStartPos(const int16_t& length, int16_t& pos, int16_t& interval, int16_t count,
-        uint16_t* validLengths, uint16_t* childsNum);
-    void GetNoWrapStartPos(const int16_t& length, int16_t& majorPos, int16_t& interval);
-    void CalRowCount();
-    void GetRowMaxHeight(uint16_t size, uint16_t* maxRosHegiht);
-    void GetRowsWidth(uint16_t rowNum, uint16_t* rowsWidth, uint16_t* rowsChildNum);
-    void GetRowStartPos(int16_t& pos, int16_t& interval, int16_t count,
-        uint16_t* rowsWidth, uint16_t* rowsChildNum);
-    void CalColumnCount();
-    void GetColumnMaxWidth(uint16_t size, uint16_t* maxColumnsWidth);
-    void GetColumnsHeight(uint16_t columnNum, uint16_t* columnsHeight, uint16_t* columnsChildNum);
-    void GetColumnStartPos(int16_t& pos, int16_t& interval, int16_t count,
-        uint16_t* columnsHeight, uint16_t* columnsChildNum);
-    void GetCrossAxisPosY(int16_t& posY, uint16_t& count, uint16_t* rowsMaxHeight, UIView* child);
-    void GetCrossAxisPosX(int16_t& posX, uint16_t& count, uint16_t* columnsMaxWidth, UIView* child);
-    static constexpr uint16_t MAX_COUNT_DEFAULT = 100;
+    /* size and margins of a child when it was last laid out, and the layout state right before it */
+    struct ChildCache {
+        UIView* view;
+        bool visible;
+        int16_t width;
+        int16_t height;
+        int16_t marginLeft;
+        int16_t marginRight;
+        int16_t marginTop;
+        int16_t marginBottom;
+        int16_t x;
+        int16_t y;
+        int16_t majorPos;
+        int16_t interval;
+        uint16_t line;
+    };
+
+    /* a row or column: children length on the major axis, maximum size on the secondary axis, number of children,
+     * and where its first child starts and the interval between its children */
+    struct LineInfo {
+        uint16_t length;
+        uint16_t cross;
+        uint16_t childNum;
+        int16_t startPos;
+        int16_t interval;
+    };
+
+    bool ReserveCache(uint16_t childNum);
+    uint16_t UpdateCache();
+    void CalLines(uint16_t childNum);
+    void LayoutHorizontal(uint16_t start);
+    void LayoutVertical(uint16_t start);
+    void GetStartPos(const int16_t& length, int16_t& pos, int16_t& interval, uint16_t count);
+    void GetCrossAxisPos(int16_t length,
+                         int16_t& pos,
+                         uint16_t count,
+                         uint16_t lineNum,
+                         int16_t size,
+                         int16_t startMargin,
+                         int16_t endMargin);
+
     AlignType majorAlign_;
     AlignType secondaryAlign_;
     uint8_t wrap_;
     uint16_t rowCount_;
     uint16_t columnCount_;
+
+    ChildCache* childCache_ = nullptr;
+    LineInfo* lines_ = nullptr;
+    LineInfo* prevLines_ = nullptr;
+    /* number of entries of the arrays above, one more than the number of children they can hold */
+    uint16_t cacheCapacity_ = 0;
+    uint16_t cachedChildNum_ = 0;
+    bool cacheValid_ = false;
+    int16_t cachedWidth_ = 0;
+    int16_t cachedHeight_ = 0;
+    DirectionType cachedDirection_ = LAYOUT_HOR;
+    AlignType cachedMajorAlign_ = ALIGN_START;
+    AlignType cachedSecondaryAlign_ = ALIGN_CENTER;
+    uint8_t cachedWrap_ = NOWRAP;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_FLEX_LAYOUT_H
@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "components/root_view.h"
+
+#if !LOCAL_RENDER && (FULLY_RENDER != 1) && !ENABLE_WINDOW
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "components/ui_image_view.h"
+#include "core/render_manager.h"
+#include "engines/gfx/draw_command_queue.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "securec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr uint8_t BUFFER_NUM = 3;
+constexpr uint8_t FRAME_NUM = 12;
+constexpr int16_t VIEW_SIZE = 40;
+constexpr int16_t VIEW_STEP = 17;
+constexpr int16_t ROUND_SCREEN_SIZE = 466;
+constexpr int16_t IMAGE_SIZE = 64;
+constexpr uint32_t UNTOUCHED_COLOR = 0x12345678;
+
+bool IsInsideCircle(int16_t x, int16_t y)
+{
+    /* the pixel center in units of half a pixel, compared with the radius of the inscribed circle */
+    int32_t dx = 2 * x + 1 - ROUND_SCREEN_SIZE; // 2: half pixels
+    int32_t dy = 2 * y + 1 - ROUND_SCREEN_SIZE; // 2: half pixels
+    return dx * dx + dy * dy <= ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE;
+}
+} // namespace
+
+/* presents its buffers round robin and reports the age of the back buffer like EGL_EXT_buffer_age */
+class MultiBufferGfxEngine : public BaseGfxEngine {
+public:
+    MultiBufferGfxEngine()
+    {
+        bufferSize_ = width_ * height_ * sizeof(uint32_t);
+        for (uint8_t i = 0; i < BUFFER_NUM; i++) {
+            buffers_[i] = new uint8_t[bufferSize_];
+            (void)memset_s(buffers_[i], bufferSize_, 0, bufferSize_);
+            ages_[i] = 0;
+        }
+        reference_ = new uint8_t[bufferSize_];
+        fb_.rect = Rect(0, 0, width_ - 1, height_ - 1);
+        fb_.mode = ARGB8888;
+        fb_.color = 0;
+        fb_.phyAddr = fb_.virAddr = buffers_[0];
+        fb_.stride = width_ * sizeof(uint32_t);
+        fb_.width = width_;
+        fb_.height = height_;
+    }
+
+    virtual ~MultiBufferGfxEngine()
+    {
+        for (uint8_t i = 0; i < BUFFER_NUM; i++) {
+            delete[] buffers_[i];
+        }
+        delete[] reference_;
+    }
+
+    BufferInfo* GetFBBufferInfo() override
+    {
+        return &fb_;
+    }
+
+    uint8_t GetFBBufferAge() override
+    {
+        return ages_[back_];
+    }
+
+    void Flush() override
+    {
+        for (uint8_t i = 0; i < BUFFER_NUM; i++) {
+            if (ages_[i] != 0) {
+                ages_[i]++;
+            }
+        }
+        ages_[back_] = 1;
+        front_ = back_;
+        back_ = (back_ + 1) % BUFFER_NUM;
+        fb_.phyAddr = fb_.virAddr = buffers_[back_];
+    }
+
+    /* draws the whole tree into a separate buffer and compares it with the presented one */
+    bool IsFrontSameAsFullRedraw(RootView* rootView)
+    {
+        fb_.phyAddr = fb_.virAddr = reference_;
+        RenderManager::RenderRect(Rect(0, 0, width_ - 1, height_ - 1), rootView);
+        fb_.phyAddr = fb_.virAddr = buffers_[back_];
+        return memcmp(reference_, buffers_[front_], bufferSize_) == 0;
+    }
+
+private:
+    BufferInfo fb_;
+    uint8_t* buffers_[BUFFER_NUM];
+    uint8_t ages_[BUFFER_NUM];
+    uint8_t* reference_;
+    uint32_t bufferSize_;
+    uint8_t front_ = 0;
+    uint8_t back_ = 0;
+};
+
+/* a single buffered round screen of 466 x 466 */
+class RoundGfxEngine : public BaseGfxEngine {
+public:
+    RoundGfxEngine()
+    {
+        width_ = ROUND_SCREEN_SIZE;
+        height_ = ROUND_SCREEN_SIZE;
+        pixels_ = new Color32[ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE];
+        fb_.rect = Rect(0, 0, width_ - 1, height_ - 1);
+        fb_.mode = ARGB8888;
+        fb_.color = 0;
+        fb_.phyAddr = fb_.virAddr = pixels_;
+        fb_.stride = width_ * sizeof(Color32);
+        fb_.width = width_;
+        fb_.height = height_;
+    }
+
+    virtual ~RoundGfxEngine()
+    {
+        delete[] pixels_;
+    }
+
+    BufferInfo* GetFBBufferInfo() override
+    {
+        return &fb_;
+    }
+
+    /* marks every pixel as untouched, redraws the whole screen and returns the number of pixels written */
+    uint32_t RedrawAll(RootView* rootView)
+    {
+        for (int32_t i = 0; i < ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE; i++) {
+            pixels_[i].full = UNTOUCHED_COLOR;
+        }
+        rootView->Invalidate();
+        RenderManager::GetInstance().Callback();
+        uint32_t count = 0;
+        for (int32_t i = 0; i < ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE; i++) {
+            if (pixels_[i].full != UNTOUCHED_COLOR) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    const Color32* GetPixels() const
+    {
+        return pixels_;
+    }
+
+private:
+    BufferInfo fb_;
+    Color32* pixels_;
+};
+
+class RootViewTest : public testing::Test {
+public:
+    RootViewTest() {}
+    virtual ~RootViewTest() {}
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: RootViewBufferAge_001
+ * @tc.desc: Verify every presented buffer of a triple buffered screen equals a full redraw while only the damage
+ *           since each buffer was last shown is drawn.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RootViewTest, RootViewBufferAge_001, TestSize.Level0)
+{
+    /* kept alive for the rest of the process, the root view keeps pointing to its buffer info */
+    static MultiBufferGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+
+    UIView* view = new UIView();
+    view->SetPosition(0, 0, VIEW_SIZE, VIEW_SIZE);
+    view->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    rootView->Add(view);
+    rootView->Invalidate();
+    for (uint8_t frame = 0; frame < FRAME_NUM; frame++) {
+        view->Invalidate();
+        view->SetPosition(frame * VIEW_STEP, frame * VIEW_STEP / 2); // 2: move slower vertically
+        view->SetStyle(STYLE_BACKGROUND_COLOR, (frame % 2 == 0) ? Color::Red().full : Color::Blue().full);
+        view->Invalidate();
+        RenderManager::GetInstance().Callback();
+        EXPECT_EQ(engine.IsFrontSameAsFullRedraw(rootView), true);
+    }
+
+    rootView->Remove(view);
+    delete view;
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+
+/* an opaque root background, a translucent view over the top edge and an image over the bottom right corner */
+struct RoundScreenTree {
+    Color32 imagePixels[IMAGE_SIZE * IMAGE_SIZE];
+    ImageInfo imageInfo;
+    UIView translucentView;
+    UIImageView imageView;
+    Rect oldRect;
+};
+
+void AddRoundScreenTree(RootView* rootView, RoundScreenTree& tree)
+{
+    tree.oldRect = rootView->GetRect();
+    rootView->SetPosition(0, 0, ROUND_SCREEN_SIZE, ROUND_SCREEN_SIZE);
+    rootView->SetStyle(STYLE_BACKGROUND_COLOR, Color::Gray().full);
+    rootView->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+
+    tree.translucentView.SetPosition(100, 0, 266, 80); // 100, 266, 80: across the top of the circle
+    tree.translucentView.SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+    tree.translucentView.SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE / 2); // 2: half
+    rootView->Add(&tree.translucentView);
+
+    for (int32_t i = 0; i < IMAGE_SIZE * IMAGE_SIZE; i++) {
+        tree.imagePixels[i].full = 0x80000000 | (i * 0x010203); // 0x80000000: translucent, 0x010203: any colors
+    }
+    tree.imageInfo = {};
+    tree.imageInfo.header.colorMode = ARGB8888;
+    tree.imageInfo.header.width = IMAGE_SIZE;
+    tree.imageInfo.header.height = IMAGE_SIZE;
+    tree.imageInfo.dataSize = IMAGE_SIZE * IMAGE_SIZE * sizeof(Color32);
+    tree.imageInfo.data = reinterpret_cast<const uint8_t*>(tree.imagePixels);
+    tree.imageView.SetSrc(&tree.imageInfo);
+    /* 20: margin, the image still crosses the edge of the circle */
+    tree.imageView.SetPosition(ROUND_SCREEN_SIZE - IMAGE_SIZE - 20, ROUND_SCREEN_SIZE - IMAGE_SIZE - 20);
+    rootView->Add(&tree.imageView);
+}
+
+void RemoveRoundScreenTree(RootView* rootView, RoundScreenTree& tree)
+{
+    rootView->Remove(&tree.translucentView);
+    rootView->Remove(&tree.imageView);
+    rootView->SetPosition(tree.oldRect.GetX(), tree.oldRect.GetY(), tree.oldRect.GetWidth(),
+                          tree.oldRect.GetHeight());
+}
+
+/**
+ * @tc.name: RootViewRoundScreen_001
+ * @tc.desc: Verify a round screen draws every pixel inside the circle like a rectangle screen, and leaves the
+ *           corners outside untouched.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RootViewTest, RootViewRoundScreen_001, TestSize.Level1)
+{
+    /* kept alive for the rest of the process, the root view keeps pointing to its buffer info */
+    static RoundGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+    RoundScreenTree* tree = new RoundScreenTree();
+    AddRoundScreenTree(rootView, *tree);
+
+    engine.SetScreenShape(ScreenShape::RECTANGLE);
+    uint32_t rectCount = engine.RedrawAll(rootView);
+    Color32* expect = new Color32[ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE];
+    (void)memcpy_s(expect, ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE * sizeof(Color32), engine.GetPixels(),
+                   ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE * sizeof(Color32));
+    engine.SetScreenShape(ScreenShape::CIRCLE);
+    uint32_t circleCount = engine.RedrawAll(rootView);
+
+    EXPECT_EQ(rectCount, static_cast<uint32_t>(ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE));
+    EXPECT_LT(circleCount, rectCount);
+    const Color32* pixels = engine.GetPixels();
+    for (int16_t y = 0; y < ROUND_SCREEN_SIZE; y++) {
+        for (int16_t x = 0; x < ROUND_SCREEN_SIZE; x++) {
+            if (IsInsideCircle(x, y)) {
+                ASSERT_EQ(pixels[y * ROUND_SCREEN_SIZE + x].full, expect[y * ROUND_SCREEN_SIZE + x].full)
+                    << x << ", " << y;
+            }
+        }
+    }
+    EXPECT_EQ(pixels[0].full, UNTOUCHED_COLOR);
+    EXPECT_EQ(pixels[ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE - 1].full, UNTOUCHED_COLOR);
+
+    engine.SetScreenShape(ScreenShape::RECTANGLE);
+    RemoveRoundScreenTree(rootView, *tree);
+    delete tree;
+    delete[] expect;
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+
+/**
+ * @tc.name: RootViewRoundScreen_002
+ * @tc.desc: Verify a full redraw of a round screen writes the pixels of the circle and at most a few more at both
+ *           ends of each row, about a quarter fewer pixels than a rectangle screen.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RootViewTest, RootViewRoundScreen_002, TestSize.Level1)
+{
+    static RoundGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+    RoundScreenTree* tree = new RoundScreenTree();
+    AddRoundScreenTree(rootView, *tree);
+
+    uint32_t insideCount = 0;
+    for (int16_t y = 0; y < ROUND_SCREEN_SIZE; y++) {
+        for (int16_t x = 0; x < ROUND_SCREEN_SIZE; x++) {
+            insideCount += IsInsideCircle(x, y) ? 1 : 0;
+        }
+    }
+    engine.SetScreenShape(ScreenShape::CIRCLE);
+    uint32_t circleCount = engine.RedrawAll(rootView);
+    EXPECT_GE(circleCount, insideCount);
+    /* 6: the row bounds keep the pixels the circle touches and one more, with the error of Sqrt on each side */
+    EXPECT_LE(circleCount, insideCount + ROUND_SCREEN_SIZE * 6);
+    /* 4, 5: the circle covers pi / 4 of the screen, under four fifths */
+    EXPECT_LT(circleCount * 5, static_cast<uint32_t>(ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE * 4));
+
+    engine.SetScreenShape(ScreenShape::RECTANGLE);
+    RemoveRoundScreenTree(rootView, *tree);
+    delete tree;
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+
+/**
+ * @tc.name: RootViewDeferred_001
+ * @tc.desc: Verify a frame drawn with the deferred draw queue equals the frame drawn without it, on rectangle and
+ *           round screens.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RootViewTest, RootViewDeferred_001, TestSize.Level1)
+{
+    static RoundGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+    RoundScreenTree* tree = new RoundScreenTree();
+    AddRoundScreenTree(rootView, *tree);
+    /* an opaque group hiding part of the root background, with an opaque child and the image on top */
+    UIViewGroup* group = new UIViewGroup();
+    group->SetPosition(50, 120, 300, 300); // 50, 120, 300: inside the screen
+    group->SetStyle(STYLE_BACKGROUND_COLOR, Color::Blue().full);
+    group->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    UIViewGroup* child = new UIViewGroup();
+    child->SetPosition(10, 10, 200, 100); // 10, 200, 100: inside the group
+    child->SetStyle(STYLE_BACKGROUND_COLOR, Color::Green().full);
+    child->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    group->Add(child);
+    rootView->Add(group);
+    tree->imageView.SetStyle(STYLE_BACKGROUND_COLOR, Color::Black().full);
+    tree->imageView.SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+
+    const ScreenShape shapes[] = {ScreenShape::RECTANGLE, ScreenShape::CIRCLE};
+    Color32* expect = new Color32[ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE];
+    uint32_t size = ROUND_SCREEN_SIZE * ROUND_SCREEN_SIZE * sizeof(Color32);
+    for (uint8_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        engine.SetScreenShape(shapes[i]);
+        engine.SetDeferredEnable(false);
+        engine.RedrawAll(rootView);
+        (void)memcpy_s(expect, size, engine.GetPixels(), size);
+        engine.SetDeferredEnable(true);
+        engine.RedrawAll(rootView);
+        EXPECT_EQ(memcmp(engine.GetPixels(), expect, size), 0);
+    }
+    ASSERT_NE(engine.GetDrawCommandQueue(), nullptr);
+    EXPECT_GT(engine.GetDrawCommandQueue()->GetDroppedNum(), 0U);
+
+    engine.SetDeferredEnable(false);
+    engine.SetScreenShape(ScreenShape::RECTANGLE);
+    rootView->Remove(group);
+    group->Remove(child);
+    delete child;
+    delete group;
+    RemoveRoundScreenTree(rootView, *tree);
+    delete tree;
+    delete[] expect;
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+} // namespace OHOS
+#endif // !LOCAL_RENDER && (FULLY_RENDER != 1) && !ENABLE_WINDOW
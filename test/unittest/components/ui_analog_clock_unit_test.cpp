@@ -16,8 +16,15 @@
 #include "components/ui_analog_clock.h"
 
 #include <climits>
+#include <cstring>
 #include <gtest/gtest.h>
 
+#include "components/root_view.h"
+#include "components/ui_image_view.h"
+#include "core/render_manager.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "securec.h"
+
 using namespace testing::ext;
 
 namespace OHOS {
@@ -229,4 +236,278 @@ HWTEST_F(UIAnalogClockTest, UIAnalogClockSetInitTime12Hour_002, TestSize.Level1)
     EXPECT_EQ(clock_->GetHandInitAngle(UIAnalogClock::HandType::HOUR_HAND), SEMICIRCLE_IN_DEGREE);
     EXPECT_EQ(clock_->GetHandCurrentAngle(UIAnalogClock::HandType::HOUR_HAND), SEMICIRCLE_IN_DEGREE);
 }
+
+#if !LOCAL_RENDER && (FULLY_RENDER != 1) && !ENABLE_WINDOW
+namespace {
+constexpr int16_t DIAL_SIZE = 200;
+constexpr int16_t DIAL_CENTER = DIAL_SIZE / 2; // 2: half
+constexpr uint8_t MARK_NUM = 12;
+constexpr int16_t MARK_SIZE = 10;
+constexpr int16_t HAND_IMAGE_WIDTH = 8;
+constexpr int16_t HAND_IMAGE_HEIGHT = 70;
+constexpr uint8_t TICK_NUM = 12;
+constexpr uint8_t ONE_MINUTE_TICK_NUM = 60;
+} // namespace
+
+/* a single screen buffer that keeps its contents between frames */
+class ClockGfxEngine : public BaseGfxEngine {
+public:
+    ClockGfxEngine() : dialArea_(0)
+    {
+        uint32_t size = width_ * height_ * sizeof(uint32_t);
+        buffer_ = new uint8_t[size];
+        (void)memset_s(buffer_, size, 0, size);
+        fb_.rect = Rect(0, 0, width_ - 1, height_ - 1);
+        fb_.mode = ARGB8888;
+        fb_.color = 0;
+        fb_.phyAddr = fb_.virAddr = buffer_;
+        fb_.stride = width_ * sizeof(uint32_t);
+        fb_.width = width_;
+        fb_.height = height_;
+    }
+
+    virtual ~ClockGfxEngine()
+    {
+        delete[] buffer_;
+    }
+
+    BufferInfo* GetFBBufferInfo() override
+    {
+        return &fb_;
+    }
+
+    uint8_t GetFBBufferAge() override
+    {
+        return 1;
+    }
+
+    void Flush() override {}
+
+    /* counts the pixels the views of a clock placed at the origin paint on the screen */
+    void DrawRect(BufferInfo& dst, const Rect& rect, const Rect& dirtyRect, const Style& style,
+                  OpacityType opacity) override
+    {
+        Rect area;
+        if ((dst.virAddr == buffer_) && (rect.GetRight() < DIAL_SIZE) && (rect.GetBottom() < DIAL_SIZE) &&
+            area.Intersect(rect, dirtyRect)) {
+            dialArea_ += area.GetSize();
+        }
+        BaseGfxEngine::DrawRect(dst, rect, dirtyRect, style, opacity);
+    }
+
+    uint32_t GetDialArea() const
+    {
+        return dialArea_;
+    }
+
+    void ResetDialArea()
+    {
+        dialArea_ = 0;
+    }
+
+    /* copies the pixels of a clock placed at the origin */
+    void CopyDial(uint8_t* dst) const
+    {
+        uint32_t rowSize = DIAL_SIZE * sizeof(uint32_t);
+        for (int16_t y = 0; y < DIAL_SIZE; y++) {
+            (void)memcpy_s(dst + y * rowSize, rowSize, buffer_ + y * fb_.stride, rowSize);
+        }
+    }
+
+private:
+    BufferInfo fb_;
+    uint8_t* buffer_;
+    uint32_t dialArea_;
+};
+
+ImageInfo GetHandImageInfo(Color32* pixels)
+{
+    for (uint16_t i = 0; i < HAND_IMAGE_WIDTH * HAND_IMAGE_HEIGHT; i++) {
+        pixels[i].full = Color::Blue().full;
+    }
+    ImageInfo info = {};
+    info.header.colorMode = ARGB8888;
+    info.header.width = HAND_IMAGE_WIDTH;
+    info.header.height = HAND_IMAGE_HEIGHT;
+    info.dataSize = HAND_IMAGE_WIDTH * HAND_IMAGE_HEIGHT * sizeof(Color32);
+    info.data = reinterpret_cast<const uint8_t*>(pixels);
+    return info;
+}
+
+UIAnalogClock* NewDialClock(UIImageView& handImage)
+{
+    UIAnalogClock* clock = new UIAnalogClock();
+    clock->SetPosition(0, 0, DIAL_SIZE, DIAL_SIZE);
+    clock->SetStyle(STYLE_BACKGROUND_COLOR, Color::Gray().full);
+    clock->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    for (uint8_t i = 0; i < MARK_NUM; i++) {
+        UIView* mark = new UIView();
+        int16_t angle = i * CIRCLE_IN_DEGREE / MARK_NUM;
+        int16_t radius = DIAL_CENTER - MARK_SIZE;
+        mark->SetPosition(DIAL_CENTER + static_cast<int16_t>(radius * Sin(angle)) - MARK_SIZE / 2, // 2: half
+                          DIAL_CENTER - static_cast<int16_t>(radius * Sin(angle + QUARTER_IN_DEGREE)) -
+                              MARK_SIZE / 2, // 2: half
+                          MARK_SIZE, MARK_SIZE);
+        mark->SetStyle(STYLE_BACKGROUND_COLOR, Color::White().full);
+        mark->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+        clock->Add(mark);
+    }
+    /* the hour and second hands are lines, the minute hand is a rotated image, all turning around the center */
+    clock->SetHandLine(UIAnalogClock::HandType::HOUR_HAND, {DIAL_CENTER, DIAL_CENTER - 50}, // 50: hand length
+                       {0, 50}, Color::Black(), 6, 50, OPA_OPAQUE);                          // 6: line width
+    int16_t halfWidth = HAND_IMAGE_WIDTH / 2;                                                // 2: half
+    clock->SetHandImage(UIAnalogClock::HandType::MINUTE_HAND, handImage,
+                        {DIAL_CENTER - halfWidth, DIAL_CENTER - HAND_IMAGE_HEIGHT}, {halfWidth, HAND_IMAGE_HEIGHT});
+    clock->SetHandLine(UIAnalogClock::HandType::SECOND_HAND, {DIAL_CENTER, DIAL_CENTER - 80}, // 80: hand length
+                       {0, 80}, Color::Red(), 2, 90, OPA_OPAQUE); // 2: line width, 90: length with a tail
+    return clock;
+}
+
+void DeleteDialClock(UIAnalogClock* clock)
+{
+    UIView* view = clock->GetChildrenHead();
+    while (view != nullptr) {
+        UIView* next = view->GetNextSibling();
+        clock->Remove(view);
+        delete view;
+        view = next;
+    }
+    delete clock;
+}
+
+/* renders the clock from 10:08:50 and then each tick, returns the area of the dial views painted by the ticks */
+uint32_t RenderTicks(UIAnalogClock* clock, ClockGfxEngine& engine, uint8_t tickNum, uint8_t* frames)
+{
+    clock->SetInitTime24Hour(10, 8, 50); // 10, 8, 50: any time that crosses a minute
+    RenderManager::GetInstance().Callback();
+    engine.ResetDialArea();
+    for (uint8_t i = 0; i < tickNum; i++) {
+        clock->IncOneSecond();
+        RenderManager::GetInstance().Callback();
+        if (frames != nullptr) {
+            engine.CopyDial(frames + i * DIAL_SIZE * DIAL_SIZE * sizeof(uint32_t));
+        }
+    }
+    return engine.GetDialArea();
+}
+
+/**
+ * @tc.name: UIAnalogClockDialCache_001
+ * @tc.desc: Verify a clock that draws its dial from the retained layer and only redraws the strips swept by the
+ *           hands shows the same pixels on every tick as a clock that redraws everything.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAnalogClockTest, UIAnalogClockDialCache_001, TestSize.Level1)
+{
+    /* kept alive for the rest of the process, the root view keeps pointing to its buffer info */
+    static ClockGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+
+    Color32 pixels[HAND_IMAGE_WIDTH * HAND_IMAGE_HEIGHT];
+    ImageInfo info = GetHandImageInfo(pixels);
+    UIImageView handImage;
+    handImage.SetSrc(&info);
+    UIAnalogClock* clock = NewDialClock(handImage);
+    rootView->Add(clock);
+
+    uint32_t frameSize = DIAL_SIZE * DIAL_SIZE * sizeof(uint32_t);
+    uint8_t* expected = new uint8_t[frameSize * TICK_NUM];
+    uint8_t* frames = new uint8_t[frameSize * TICK_NUM];
+    RenderTicks(clock, engine, TICK_NUM, expected);
+    EXPECT_EQ(UIAnalogClock::GetDialCacheSize(), 0);
+
+    clock->SetDialCacheEnable(true);
+    RenderTicks(clock, engine, TICK_NUM, frames);
+    EXPECT_EQ(UIAnalogClock::GetDialCacheSize(), frameSize);
+    for (uint8_t i = 0; i < TICK_NUM; i++) {
+        EXPECT_EQ(memcmp(expected + i * frameSize, frames + i * frameSize, frameSize), 0);
+    }
+
+    clock->SetDialCacheEnable(false);
+    EXPECT_EQ(UIAnalogClock::GetDialCacheSize(), 0);
+    delete[] expected;
+    delete[] frames;
+    rootView->Remove(clock);
+    DeleteDialClock(clock);
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+
+/**
+ * @tc.name: UIAnalogClockDialCache_002
+ * @tc.desc: Verify a clock whose dial layer cannot be used, here because a tick mark is transformed, falls back to
+ *           redrawing the whole clock on every tick and shows the same pixels as a clock without the layer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAnalogClockTest, UIAnalogClockDialCache_002, TestSize.Level1)
+{
+    static ClockGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+
+    Color32 pixels[HAND_IMAGE_WIDTH * HAND_IMAGE_HEIGHT];
+    ImageInfo info = GetHandImageInfo(pixels);
+    UIImageView handImage;
+    handImage.SetSrc(&info);
+    UIAnalogClock* clock = NewDialClock(handImage);
+    clock->GetChildrenHead()->Rotate(45, Vector2<float>(MARK_SIZE / 2, MARK_SIZE / 2)); // 45: angle, 2: half
+    rootView->Add(clock);
+
+    uint32_t frameSize = DIAL_SIZE * DIAL_SIZE * sizeof(uint32_t);
+    uint8_t* expected = new uint8_t[frameSize * TICK_NUM];
+    uint8_t* frames = new uint8_t[frameSize * TICK_NUM];
+    RenderTicks(clock, engine, TICK_NUM, expected);
+
+    clock->SetDialCacheEnable(true);
+    RenderTicks(clock, engine, TICK_NUM, frames);
+    EXPECT_EQ(UIAnalogClock::GetDialCacheSize(), 0);
+    for (uint8_t i = 0; i < TICK_NUM; i++) {
+        EXPECT_EQ(memcmp(expected + i * frameSize, frames + i * frameSize, frameSize), 0);
+    }
+
+    delete[] expected;
+    delete[] frames;
+    rootView->Remove(clock);
+    DeleteDialClock(clock);
+    BaseGfxEngine::InitGfxEngine(oldEngine);
+}
+
+/**
+ * @tc.name: UIAnalogClockDialCacheDraw_001
+ * @tc.desc: Verify over one minute of ticks a clock without the dial layer repaints its dial under the swept hands
+ *           every tick, while a clock with the layer paints its dial views only once, into the layer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAnalogClockTest, UIAnalogClockDialCacheDraw_001, TestSize.Level1)
+{
+    static ClockGfxEngine engine;
+    BaseGfxEngine* oldEngine = BaseGfxEngine::GetInstance();
+    BaseGfxEngine::InitGfxEngine(&engine);
+    RootView* rootView = RootView::GetInstance();
+    rootView->UpdateBufferInfo(engine.GetFBBufferInfo());
+
+    Color32 pixels[HAND_IMAGE_WIDTH * HAND_IMAGE_HEIGHT];
+    ImageInfo info = GetHandImageInfo(pixels);
+    UIImageView handImage;
+    handImage.SetSrc(&info);
+    UIAnalogClock* clock = NewDialClock(handImage);
+    rootView->Add(clock);
+
+    /* every tick moves the second hand, so the dial under its old and new position is repainted */
+    uint32_t direct = RenderTicks(clock, engine, ONE_MINUTE_TICK_NUM, nullptr);
+    EXPECT_GE(direct, static_cast<uint32_t>(ONE_MINUTE_TICK_NUM));
+    clock->SetDialCacheEnable(true);
+    uint32_t cached = RenderTicks(clock, engine, ONE_MINUTE_TICK_NUM, nullptr);
+    EXPECT_EQ(cached, 0u);
+    EXPECT_EQ(UIAnalogClock::GetDialCacheSize(), DIAL_SIZE * DIAL_SIZE * sizeof(uint32_t));
+
+    rootView->Remove(clock);
+    DeleteDialClock(clock);
+    BaseGfxEngine::InitGfxEngine(oldEngine);
 }
+#endif // !LOCAL_RENDER && (FULLY_RENDER != 1) && !ENABLE_WINDOW
+} // namespace OHOS
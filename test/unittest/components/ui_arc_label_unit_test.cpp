@@ -16,11 +16,115 @@
 #include "components/ui_arc_label.h"
 
 #include <climits>
+#include <cmath>
+#include <cstring>
 #include <gtest/gtest.h>
+#include "common/graphic_startup.h"
+#include "draw/rotated_glyph_cache.h"
+#include "engines/gfx/gfx_engine_manager.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
+namespace {
+const int16_t SCREEN_SIZE = 454;
+const uint16_t ARC_RADIUS = 200;
+const uint8_t ARC_FONT_SIZE = 24;
+const char* ARC_TEXT = "0123456789ABCDEFGHIJ"; // 20 characters
+/* 80 characters, about a full circle of ARC_RADIUS */
+const char* CIRCLE_TEXT = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGH";
+/* 16 sectors of the full circle, five letters each */
+const uint8_t SECTOR_NUM = 16;
+
+UIArcLabel* NewArcLabel()
+{
+    UIArcLabel* label = new UIArcLabel();
+    label->SetArcTextCenter(SCREEN_SIZE / 2, SCREEN_SIZE / 2); // 2: center of the screen
+    label->SetArcTextRadius(ARC_RADIUS);
+    label->SetArcTextAngle(-90, 90); // -90, 90: upper half circle
+    label->SetArcTextOrientation(UIArcLabel::TextOrientation::INSIDE);
+    label->SetFont(DEFAULT_VECTOR_FONT_FILENAME, ARC_FONT_SIZE);
+    label->SetText(ARC_TEXT);
+    label->SetStyle(STYLE_TEXT_COLOR, Color::Yellow().full);
+    (void)label->GetWidth(); // measures the arc text and moves the label onto it
+    return label;
+}
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels)
+{
+    buffer.rect = Rect(0, 0, SCREEN_SIZE - 1, SCREEN_SIZE - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = SCREEN_SIZE * sizeof(Color32);
+    buffer.width = SCREEN_SIZE;
+    buffer.height = SCREEN_SIZE;
+    for (int32_t i = 0; i < SCREEN_SIZE * SCREEN_SIZE; i++) {
+        pixels[i].full = Color::ColorTo32(Color::Navy());
+    }
+}
+
+UIArcLabel* NewCircleLabel()
+{
+    UIArcLabel* label = NewArcLabel();
+    label->SetArcTextAngle(-180, 180); // -180, 180: full circle
+    label->SetText(CIRCLE_TEXT);
+    (void)label->GetWidth();
+    return label;
+}
+
+/* the ink of a sector around the arc center: the red of the yellow text over the navy background, which has none */
+struct SectorInk {
+    uint64_t ink;
+    float x;
+    float y;
+};
+
+/* sums the ink of each sector of the circle and finds where its center is */
+void GetSectorInk(const Color32* pixels, SectorInk sectors[SECTOR_NUM])
+{
+    const float center = SCREEN_SIZE / 2; // 2: center of the screen
+    double sumX[SECTOR_NUM] = {0};
+    double sumY[SECTOR_NUM] = {0};
+    for (uint8_t i = 0; i < SECTOR_NUM; i++) {
+        sectors[i] = {0, 0, 0};
+    }
+    for (int16_t y = 0; y < SCREEN_SIZE; y++) {
+        for (int16_t x = 0; x < SCREEN_SIZE; x++) {
+            uint8_t ink = pixels[y * SCREEN_SIZE + x].red;
+            if (ink == 0) {
+                continue;
+            }
+            float angle = std::atan2(y + 0.5f - center, x + 0.5f - center) + UI_PI; // 0.5: pixel center
+            uint8_t i = static_cast<uint8_t>(angle * SECTOR_NUM / (2 * UI_PI)) % SECTOR_NUM; // 2: whole circle
+            sectors[i].ink += ink;
+            sumX[i] += static_cast<double>(ink) * x;
+            sumY[i] += static_cast<double>(ink) * y;
+        }
+    }
+    for (uint8_t i = 0; i < SECTOR_NUM; i++) {
+        if (sectors[i].ink != 0) {
+            sectors[i].x = static_cast<float>(sumX[i] / sectors[i].ink);
+            sectors[i].y = static_cast<float>(sumY[i] / sectors[i].ink);
+        }
+    }
+}
+
+void DrawFrames(UIArcLabel* label, BufferInfo& buffer, const Rect& area, uint16_t frameNum)
+{
+    for (uint16_t i = 0; i < frameNum; i++) {
+        label->OnDraw(buffer, area);
+    }
+}
+
+/* every rotated letter drawn is looked up in the rotated glyph cache once */
+uint32_t GetGlyphLookups()
+{
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    return cache.GetHitCount() + cache.GetMissCount();
+}
+} // namespace
+
 class UIArcLabelTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -214,4 +318,181 @@ HWTEST_F(UIArcLabelTest, UIArcLabelGetDirect_001, TestSize.Level1)
     }
     EXPECT_EQ(arcLabel_->GetDirect(), UITextLanguageDirect(0));
 }
+
+/**
+ * @tc.name: UIArcLabelTextCache_001
+ * @tc.desc: Verify an arc text drawn from the cache looks like the letters drawn one by one, and the cache is
+ *           released when it is disabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelTextCache_001, TestSize.Level0)
+{
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    UIArcLabel* label = NewArcLabel();
+    EXPECT_EQ(label->IsTextCacheEnabled(), false);
+    Rect rect = label->GetRect();
+    Color32* expect = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    Color32* result = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    BufferInfo buffer;
+
+    InitBuffer(buffer, expect);
+    label->OnDraw(buffer, rect);
+    EXPECT_EQ(label->GetTextCacheSize(), 0u);
+
+    label->SetTextCacheEnable(true);
+    InitBuffer(buffer, result);
+    label->OnDraw(buffer, rect);
+    if (static_cast<uint32_t>(rect.GetWidth()) * rect.GetHeight() <= UIArcLabel::TEXT_CACHE_MAX_SIZE) {
+        EXPECT_EQ(label->GetTextCacheSize(), static_cast<uint32_t>(rect.GetWidth()) * rect.GetHeight());
+    }
+    for (int32_t i = 0; i < SCREEN_SIZE * SCREEN_SIZE; i++) {
+        /* 3: the coverage is rounded once more when it is cached */
+        EXPECT_NEAR(result[i].red, expect[i].red, 3) << "pixel " << i;
+        EXPECT_NEAR(result[i].green, expect[i].green, 3) << "pixel " << i;
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 3) << "pixel " << i;
+    }
+
+    label->SetTextCacheEnable(false);
+    EXPECT_EQ(label->GetTextCacheSize(), 0u);
+    delete[] expect;
+    delete[] result;
+    delete label;
+}
+
+/**
+ * @tc.name: UIArcLabelTextCache_002
+ * @tc.desc: Verify a label without the text cache rotates every letter again on each redraw, while a label with it
+ *           rotates the letters only to render the cache and redraws the whole label, or a part of it, from it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelTextCache_002, TestSize.Level1)
+{
+    const uint16_t frameNum = 10;
+    const int16_t partSize = 40;
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    RotatedGlyphCache::GetInstance().Clear();
+    UIArcLabel* label = NewArcLabel();
+    Rect rect = label->GetRect();
+    Rect part(rect.GetLeft(), rect.GetTop(), rect.GetLeft() + partSize - 1, rect.GetTop() + partSize - 1);
+    Color32* pixels = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels);
+
+    label->OnDraw(buffer, rect);
+    uint32_t letterNum = GetGlyphLookups();
+    EXPECT_GT(letterNum, 0u);
+    DrawFrames(label, buffer, rect, frameNum);
+    EXPECT_EQ(GetGlyphLookups(), letterNum * (frameNum + 1));
+
+    label->SetTextCacheEnable(true);
+    RotatedGlyphCache::GetInstance().Clear();
+    label->OnDraw(buffer, rect);
+    EXPECT_GT(label->GetTextCacheSize(), 0u);
+    uint32_t renderNum = GetGlyphLookups();
+    EXPECT_GE(renderNum, letterNum);
+    DrawFrames(label, buffer, rect, frameNum);
+    DrawFrames(label, buffer, part, frameNum);
+    EXPECT_EQ(GetGlyphLookups(), renderNum);
+
+    RotatedGlyphCache::GetInstance().Clear();
+    delete[] pixels;
+    delete label;
+}
+
+/**
+ * @tc.name: UIArcLabelRotatedGlyph_001
+ * @tc.desc: Verify a full circle of letters drawn from the rotated glyph cache puts down about the same ink at the
+ *           same place as the letters transformed one by one, and each (letter, angle) is rasterized once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelRotatedGlyph_001, TestSize.Level0)
+{
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    UIArcLabel* label = NewCircleLabel();
+    Rect rect = label->GetRect();
+    Color32* expect = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    Color32* result = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    BufferInfo buffer;
+
+    cache.SetEnable(false);
+    InitBuffer(buffer, expect);
+    label->OnDraw(buffer, rect);
+    EXPECT_EQ(cache.GetEntryNum(), 0);
+
+    cache.SetEnable(true);
+    InitBuffer(buffer, result);
+    label->OnDraw(buffer, rect);
+    uint32_t missCount = cache.GetMissCount();
+    EXPECT_GT(cache.GetEntryNum(), 0);
+    InitBuffer(buffer, result);
+    label->OnDraw(buffer, rect);
+    EXPECT_EQ(cache.GetMissCount(), missCount);
+
+    /* a wrong pivot or a mirrored rotation moves the letters of the sectors around the circle */
+    SectorInk expectSectors[SECTOR_NUM];
+    SectorInk resultSectors[SECTOR_NUM];
+    GetSectorInk(expect, expectSectors);
+    GetSectorInk(result, resultSectors);
+    for (uint8_t i = 0; i < SECTOR_NUM; i++) {
+        uint64_t expectInk = expectSectors[i].ink;
+        uint64_t resultInk = resultSectors[i].ink;
+        ASSERT_GT(expectInk, 0u) << "sector " << static_cast<int>(i);
+        /* 10: the outlines rasterized at the angle are sharper, but cover about the same area */
+        EXPECT_LT((resultInk > expectInk) ? (resultInk - expectInk) : (expectInk - resultInk), expectInk / 10)
+            << "sector " << static_cast<int>(i);
+        EXPECT_NEAR(resultSectors[i].x, expectSectors[i].x, 1) << "sector " << static_cast<int>(i);
+        EXPECT_NEAR(resultSectors[i].y, expectSectors[i].y, 1) << "sector " << static_cast<int>(i);
+    }
+    cache.Clear();
+    delete[] expect;
+    delete[] result;
+    delete label;
+}
+
+/**
+ * @tc.name: UIArcLabelRotatedGlyph_002
+ * @tc.desc: Verify redrawing a full circle of text rasterizes each (letter, angle) only in the first frame, finds
+ *           every letter of the later frames in the cache, and keeps the cache within its bounds.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelRotatedGlyph_002, TestSize.Level1)
+{
+    const uint16_t frameNum = 10;
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    cache.Clear();
+    UIArcLabel* label = NewCircleLabel();
+    Rect rect = label->GetRect();
+    Color32* pixels = new Color32[SCREEN_SIZE * SCREEN_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels);
+
+    label->OnDraw(buffer, rect);
+    uint32_t letterNum = GetGlyphLookups();
+    uint32_t missCount = cache.GetMissCount();
+    EXPECT_GT(missCount, 0u);
+    EXPECT_LE(missCount, letterNum);
+    DrawFrames(label, buffer, rect, frameNum);
+    EXPECT_EQ(cache.GetMissCount(), missCount);
+    EXPECT_EQ(GetGlyphLookups(), letterNum * (frameNum + 1));
+    EXPECT_LE(cache.GetEntryNum(), RotatedGlyphCache::MAX_ENTRY_NUM);
+    EXPECT_LE(cache.GetUsedSize(), RotatedGlyphCache::MAX_CACHE_SIZE);
+
+    cache.Clear();
+    delete[] pixels;
+    delete label;
 }
+} // namespace OHOS
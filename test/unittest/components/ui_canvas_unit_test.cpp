@@ -20,6 +20,9 @@
 
 #include <climits>
 #include <gtest/gtest.h>
+#include "draw/shadow_mask_cache.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "render/render_blur.h"
 #include "test_resource_config.h"
 using namespace testing::ext;
 namespace OHOS {
@@ -1888,6 +1891,74 @@ HWTEST_F(UICanvasTest, UICanvasShadowBlur_002, TestSize.Level0)
     paint_->SetShadowBlur(RADIUS);
     EXPECT_EQ(paint_->GetShadowBlur(), RADIUS);
 }
+
+#if GRAPHIC_ENABLE_SHADOW_EFFECT_FLAG
+/**
+ * @tc.name: UICanvasShadowBlurCache_001
+ * @tc.desc: Verify a blurred card shadow is rasterized and blurred once at each radius, the following frames reuse
+ *           the cached mask, and the mask covers only the card and the blur extent around it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UICanvasTest, UICanvasShadowBlurCache_001, TestSize.Level1)
+{
+    const int16_t screenSize = 454;
+    const int16_t cardX = 100;
+    const int16_t cardY = 150;
+    const int16_t cardWidth = 200;
+    const int16_t cardHeight = 120;
+    const uint16_t frameNum = 20;
+    const uint16_t radii[] = {2, 4, 8, 16, 32};
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    uint32_t bufferSize = screenSize * screenSize * sizeof(uint32_t);
+    uint8_t* buffer = new uint8_t[bufferSize];
+    BufferInfo gfxDstBuffer;
+    gfxDstBuffer.rect = Rect(0, 0, screenSize - 1, screenSize - 1);
+    gfxDstBuffer.mode = ARGB8888;
+    gfxDstBuffer.color = 0;
+    gfxDstBuffer.phyAddr = gfxDstBuffer.virAddr = buffer;
+    gfxDstBuffer.stride = screenSize * sizeof(uint32_t);
+    gfxDstBuffer.width = screenSize;
+    gfxDstBuffer.height = screenSize;
+
+    UICanvas* canvas = new UICanvas();
+    canvas->SetPosition(0, 0, screenSize, screenSize);
+    Paint paint;
+    paint.SetStyle(Paint::FILL_STYLE);
+    paint.SetFillColor(Color::White());
+    paint.SetShadowColor(Color::Black());
+    paint.SetShadowOffsetX(4); // 4: shadow offset
+    paint.SetShadowOffsetY(4); // 4: shadow offset
+    ShadowMaskCache& cache = ShadowMaskCache::GetInstance();
+    for (uint16_t radius : radii) {
+        cache.Clear();
+        canvas->Clear();
+        paint.SetShadowBlur(radius);
+        canvas->BeginPath();
+        canvas->MoveTo({cardX, cardY});
+        canvas->LineTo({cardX + cardWidth, cardY});
+        canvas->LineTo({cardX + cardWidth, cardY + cardHeight});
+        canvas->LineTo({cardX, cardY + cardHeight});
+        canvas->ClosePath();
+        canvas->FillPath(paint);
+
+        for (uint16_t i = 0; i <= frameNum; i++) {
+            canvas->OnDraw(gfxDstBuffer, gfxDstBuffer.rect);
+        }
+        EXPECT_EQ(cache.GetMissCount(), 1u);
+        EXPECT_EQ(cache.GetHitCount(), frameNum);
+        /* 2: both sides, one more pixel each for the anti-aliased edges */
+        uint32_t extent = RenderBlur::GetBoxBlurExtent(radius);
+        EXPECT_GE(cache.GetUsedSize(), static_cast<uint32_t>(cardWidth + 2 * extent) * (cardHeight + 2 * extent));
+        EXPECT_LE(cache.GetUsedSize(),
+                  static_cast<uint32_t>(cardWidth + 2 + 2 * extent) * (cardHeight + 2 + 2 * extent));
+    }
+    cache.Clear();
+    delete canvas;
+    delete[] buffer;
+}
+#endif
 #endif
 
 #if GRAPHIC_ENABLE_SHADOW_EFFECT_FLAG
@@ -17,10 +17,60 @@
 
 #include <climits>
 #include <gtest/gtest.h>
+#include "draw/state_sprite_cache.h"
+#include "engines/gfx/gfx_engine_manager.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
+namespace {
+constexpr int16_t BUFFER_SIZE = 100;
+constexpr uint8_t BACKGROUND_NUM = 2;
+
+/* a sprite blended wrongly into its transparent buffer can still look right over black, but not over a color */
+ColorType GetBackground(uint8_t index)
+{
+    return (index == 0) ? Color::Black() : Color::GetColorFromRGB(0x40, 0x80, 0xC0); // 0x40, 0x80, 0xC0: blue
+}
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels, ColorType background)
+{
+    buffer.rect = Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = BUFFER_SIZE * sizeof(Color32);
+    buffer.width = BUFFER_SIZE;
+    buffer.height = BUFFER_SIZE;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        pixels[i].full = Color::ColorTo32(background);
+    }
+}
+
+void DrawCheckBox(UICheckBox* checkBox, Color32* pixels, bool useSprite, ColorType background)
+{
+    StateSpriteCache::GetInstance().SetEnable(useSprite);
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels, background);
+    checkBox->OnDraw(buffer, buffer.rect);
+}
+
+/* the state drawn from the sprite differs from the state drawn directly by the rounding of the blends only */
+void ExpectSameDrawing(const Color32* result, const Color32* expect, ColorType background)
+{
+    int32_t inkNum = 0;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 3) << "pixel " << i;     // 3: rounding of the sprite and the blit
+        EXPECT_NEAR(result[i].green, expect[i].green, 3) << "pixel " << i; // 3: rounding of the sprite and the blit
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 3) << "pixel " << i;   // 3: rounding of the sprite and the blit
+        if (expect[i].full != Color::ColorTo32(background)) {
+            inkNum++;
+        }
+    }
+    EXPECT_GT(inkNum, 0);
+}
+} // namespace
+
 class UICheckBoxTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -94,4 +144,146 @@ HWTEST_F(UICheckBoxTest, UICheckBoxSetState_001, TestSize.Level0)
     checkBox_->SetState(UICheckBox::UICheckBoxState::UNSELECTED);
     EXPECT_EQ(checkBox_->GetState(), UICheckBox::UICheckBoxState::UNSELECTED);
 }
+
+/**
+ * @tc.name: UICheckBoxStateSprite_001
+ * @tc.desc: Verify a state is rasterized once and blitted from the sprite cache afterwards.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UICheckBoxTest, UICheckBoxStateSprite_001, TestSize.Level1)
+{
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    StateSpriteCache& cache = StateSpriteCache::GetInstance();
+    cache.Clear();
+    UICheckBox* checkBox = new UICheckBox();
+    checkBox->SetImages("", "");
+    checkBox->SetPosition(10, 10, 46, 46); // 10: position, 46: default size
+    checkBox->SetState(UICheckBox::SELECTED);
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels, background);
+
+    checkBox->OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(cache.GetMissCount(), 1U);
+    EXPECT_EQ(cache.GetEntryNum(), 1);
+
+    checkBox->OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(cache.GetHitCount(), 1U);
+    EXPECT_EQ(cache.GetEntryNum(), 1);
+
+    checkBox->SetState(UICheckBox::UNSELECTED);
+    checkBox->OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(cache.GetMissCount(), 2U); // 2: the unselected state is another sprite
+    EXPECT_EQ(cache.GetEntryNum(), 2);   // 2: both states
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryNum(), 0);
+    EXPECT_EQ(cache.GetUsedSize(), 0U);
+    delete checkBox;
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: UICheckBoxStateSprite_002
+ * @tc.desc: Verify the sprite cache stays within its bounds and drops the least recently used sprite first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UICheckBoxTest, UICheckBoxStateSprite_002, TestSize.Level1)
+{
+    StateSpriteCache& cache = StateSpriteCache::GetInstance();
+    cache.Clear();
+    const int16_t size = 46; // 46: default size
+    StateSpriteKey first = {UI_CHECK_BOX, size, size, size, size, 0, 0};
+    uint32_t spriteSize = StateSpriteCache::GetSpriteSize(first);
+    uint32_t putNum = StateSpriteCache::MAX_CACHE_SIZE / spriteSize + 1;
+    for (uint32_t i = 0; i < putNum; i++) {
+        StateSpriteKey key = first;
+        key.step = i;
+        EXPECT_TRUE(cache.Put(key, new uint8_t[spriteSize]));
+        EXPECT_LE(cache.GetUsedSize(), StateSpriteCache::MAX_CACHE_SIZE);
+        EXPECT_LE(cache.GetEntryNum(), StateSpriteCache::MAX_ENTRY_NUM);
+    }
+    EXPECT_EQ(cache.Get(first), nullptr);
+    StateSpriteKey last = first;
+    last.step = putNum - 1;
+    EXPECT_NE(cache.Get(last), nullptr);
+
+    StateSpriteKey large = {UI_CHECK_BOX, INT16_MAX, INT16_MAX, INT16_MAX, INT16_MAX, 0, 0};
+    uint8_t data = 0;
+    EXPECT_FALSE(cache.Put(large, &data));
+    cache.Clear();
+}
+
+/**
+ * @tc.name: UICheckBoxStateSprite_003
+ * @tc.desc: Verify the selected and the unselected states blitted from sprites look like the states drawn directly,
+ *           at a position away from the origin of the buffer, over black and over a color.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UICheckBoxTest, UICheckBoxStateSprite_003, TestSize.Level1)
+{
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    UICheckBox* checkBox = new UICheckBox();
+    checkBox->SetImages("", "");
+    checkBox->SetPosition(13, 7, 46, 46); // 13, 7: position, 46: default size
+    Color32* expect = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* result = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    const UICheckBox::UICheckBoxState states[] = {UICheckBox::SELECTED, UICheckBox::UNSELECTED};
+    for (UICheckBox::UICheckBoxState state : states) {
+        checkBox->SetState(state);
+        for (uint8_t i = 0; i < BACKGROUND_NUM; i++) {
+            DrawCheckBox(checkBox, expect, false, GetBackground(i));
+            DrawCheckBox(checkBox, result, true, GetBackground(i));
+            EXPECT_EQ(StateSpriteCache::GetInstance().GetEntryNum(), 1);
+            ExpectSameDrawing(result, expect, GetBackground(i));
+        }
+    }
+    StateSpriteCache::GetInstance().Clear();
+    delete checkBox;
+    delete[] expect;
+    delete[] result;
+}
+
+/**
+ * @tc.name: UICheckBoxStateSprite_004
+ * @tc.desc: Verify a check box with padding and a border does not reuse the sprite of one without them, and the
+ *           sprites of two sizes are kept apart.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UICheckBoxTest, UICheckBoxStateSprite_004, TestSize.Level1)
+{
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    UICheckBox* plain = new UICheckBox();
+    plain->SetImages("", "");
+    plain->SetPosition(13, 7, 46, 46); // 13, 7: position, 46: default size
+    UICheckBox* padded = new UICheckBox();
+    padded->SetImages("", "");
+    padded->SetStyle(STYLE_PADDING_LEFT, 5);   // 5: padding
+    padded->SetStyle(STYLE_PADDING_TOP, 3);    // 3: padding
+    padded->SetStyle(STYLE_PADDING_RIGHT, 5);  // 5: padding
+    padded->SetStyle(STYLE_PADDING_BOTTOM, 3); // 3: padding
+    padded->SetStyle(STYLE_BORDER_WIDTH, 2);   // 2: border width
+    padded->SetStyle(STYLE_BORDER_COLOR, Color::Red().full);
+    padded->SetPosition(13, 7, 46, 46); // 13, 7: position, 46: default size
+    Color32* expect = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* result = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    for (uint8_t i = 0; i < BACKGROUND_NUM; i++) {
+        DrawCheckBox(padded, expect, false, GetBackground(i));
+        DrawCheckBox(plain, result, true, GetBackground(i));
+        DrawCheckBox(padded, result, true, GetBackground(i));
+        EXPECT_EQ(StateSpriteCache::GetInstance().GetEntryNum(), 2); // 2: a sprite for each check box
+        ExpectSameDrawing(result, expect, GetBackground(i));
+    }
+    StateSpriteCache::GetInstance().Clear();
+    delete plain;
+    delete padded;
+    delete[] expect;
+    delete[] result;
+}
 } // namespace OHOS
@@ -18,7 +18,9 @@
 #include <gtest/gtest.h>
 #include "components/root_view.h"
 #include "components/ui_view_group.h"
+#include "draw/clip_utils.h"
 #include "draw/draw_utils.h"
+#include "engines/gfx/gfx_engine_manager.h"
 #include "test_resource_config.h"
 
 using namespace testing::ext;
@@ -479,4 +481,60 @@ HWTEST_F(UIImageViewTest, UIImageViewSetTransformAlgorithm_001, TestSize.Level0)
     imageView_->SetTransformAlgorithm(algorithm);
     EXPECT_EQ(imageView_->GetTransformAlgorithm(), algorithm);
 }
+
+/**
+ * @tc.name: UIImageViewSetClipCircle_001
+ * @tc.desc: Verify an image view clipped to a circle draws the pixels of the image drawn through a mask of the same
+ *           circle, and removing the clip draws the whole image again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIImageViewTest, UIImageViewSetClipCircle_001, TestSize.Level0)
+{
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    const int16_t size = 40;
+    const int16_t radius = 15;
+    const Point center = {20, 18};
+    Color32 image[size * size];
+    for (int16_t i = 0; i < size * size; i++) {
+        image[i].full = Color::ColorTo32(Color::Red());
+    }
+    ImageInfo info = {};
+    info.header.colorMode = ARGB8888;
+    info.header.width = size;
+    info.header.height = size;
+    info.dataSize = size * size * sizeof(Color32);
+    info.data = reinterpret_cast<const uint8_t*>(image);
+
+    Color32 expect[size * size] = {};
+    Color32 result[size * size] = {};
+    BufferInfo buffer = {};
+    buffer.rect = Rect(0, 0, size - 1, size - 1);
+    buffer.mode = ARGB8888;
+    buffer.stride = size * sizeof(Color32);
+    buffer.width = size;
+    buffer.height = size;
+    ClipPath path;
+    path.Circle({static_cast<float>(center.x), static_cast<float>(center.y)}, radius);
+    ClipMask mask;
+    ASSERT_TRUE(mask.Build(path, size, size));
+    buffer.phyAddr = buffer.virAddr = expect;
+    DrawUtils::GetInstance()->DrawImage(buffer, buffer.rect, buffer.rect, info.data, OPA_OPAQUE,
+                                        DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888, &mask);
+
+    UIImageView view;
+    view.SetPosition(0, 0, size, size);
+    view.SetSrc(&info);
+    view.SetClipCircle(center, radius);
+    EXPECT_EQ(view.GetClipRadius(), radius);
+    buffer.phyAddr = buffer.virAddr = result;
+    view.OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(memcmp(expect, result, sizeof(result)), 0);
+
+    view.SetClipCircle(center, 0);
+    EXPECT_EQ(view.GetClipRadius(), 0);
+    view.OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(memcmp(image, result, sizeof(result)), 0);
+}
 } // namespace OHOS
@@ -16,13 +16,45 @@
 #include "components/ui_label.h"
 
 #include <climits>
+#include <cstring>
 #include <gtest/gtest.h>
+#include "common/graphic_startup.h"
+#include "engines/gfx/gfx_engine_manager.h"
 
 using namespace testing::ext;
 namespace OHOS {
 namespace {
     const int16_t INIT_WIDTH = 100;
     const int16_t INIT_HEIGHT = 150;
+    const int16_t MARQUEE_WIDTH = 200;
+    const int16_t MARQUEE_HEIGHT = 40;
+    const uint8_t MARQUEE_FONT_SIZE = 24;
+    const char* MARQUEE_TEXT = "A marquee text which is much longer than its label 0123456789";
+
+    UILabel* NewMarqueeLabel()
+    {
+        UILabel* label = new UILabel();
+        label->SetPosition(0, 0, MARQUEE_WIDTH, MARQUEE_HEIGHT);
+        label->SetLineBreakMode(UILabel::LINE_BREAK_MARQUEE);
+        label->SetFont(DEFAULT_VECTOR_FONT_FILENAME, MARQUEE_FONT_SIZE);
+        label->SetText(MARQUEE_TEXT);
+        label->SetStyle(STYLE_BACKGROUND_COLOR, Color::Navy().full);
+        label->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+        label->ReMeasure();
+        return label;
+    }
+
+    void InitBuffer(BufferInfo& buffer, Color32* pixels)
+    {
+        buffer.rect = Rect(0, 0, MARQUEE_WIDTH - 1, MARQUEE_HEIGHT - 1);
+        buffer.mode = ARGB8888;
+        buffer.color = 0;
+        buffer.phyAddr = buffer.virAddr = pixels;
+        buffer.stride = MARQUEE_WIDTH * sizeof(Color32);
+        buffer.width = MARQUEE_WIDTH;
+        buffer.height = MARQUEE_HEIGHT;
+        (void)memset(pixels, 0, MARQUEE_WIDTH * MARQUEE_HEIGHT * sizeof(Color32));
+    }
 }
 
 class UILabelTest : public testing::Test {
@@ -224,4 +256,58 @@ HWTEST_F(UILabelTest, UILabelSetFont_001, TestSize.Level1)
 
     EXPECT_EQ(label_->GetFontId(), fontId);
 }
+
+/**
+ * @tc.name: UILabelMarqueeStrip_001
+ * @tc.desc: Verify a rolling text drawn from the pre-rendered strip looks like the text drawn directly, the strip
+ *           memory is reported and released when the strip is disabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UILabelTest, UILabelMarqueeStrip_001, TestSize.Level0)
+{
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    UILabel* label = NewMarqueeLabel();
+    EXPECT_EQ(label->IsMarqueeStripEnabled(), false);
+    int16_t textWidth = label->GetTextWidth();
+    if (textWidth <= MARQUEE_WIDTH) {
+        /* the font is not available, the text does not roll */
+        delete label;
+        return;
+    }
+    const int32_t pixelNum = MARQUEE_WIDTH * MARQUEE_HEIGHT;
+    Color32* expect = new Color32[pixelNum];
+    Color32* result = new Color32[pixelNum];
+    BufferInfo buffer;
+    InitBuffer(buffer, expect);
+    label->OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(UILabel::GetMarqueeStripSize(), 0u);
+
+    label->SetMarqueeStripEnable(true);
+    InitBuffer(buffer, result);
+    label->OnDraw(buffer, buffer.rect);
+    uint32_t stripSize = static_cast<uint32_t>(textWidth) * label->GetContentRect().GetHeight() * sizeof(Color32);
+    EXPECT_EQ(UILabel::GetMarqueeStripSize(), stripSize);
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 2) << "pixel " << i;     // 2: rounding of two blends
+        EXPECT_NEAR(result[i].green, expect[i].green, 2) << "pixel " << i; // 2: rounding of two blends
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 2) << "pixel " << i;   // 2: rounding of two blends
+    }
+
+    /* a new color renders the strip again in the same memory */
+    label->SetTextColor(Color::Red());
+    label->OnDraw(buffer, buffer.rect);
+    EXPECT_EQ(UILabel::GetMarqueeStripSize(), stripSize);
+
+    label->SetMarqueeStripEnable(false);
+    EXPECT_EQ(UILabel::GetMarqueeStripSize(), 0u);
+    label->SetMarqueeStripEnable(true);
+    label->OnDraw(buffer, buffer.rect);
+    delete label;
+    EXPECT_EQ(UILabel::GetMarqueeStripSize(), 0u);
+    delete[] expect;
+    delete[] result;
+}
 } // namespace OHOS
@@ -18,8 +18,58 @@
 #include <climits>
 #include <gtest/gtest.h>
 #include "components/root_view.h"
+#include "draw/state_sprite_cache.h"
+#include "engines/gfx/gfx_engine_manager.h"
 using namespace testing::ext;
 namespace OHOS {
+namespace {
+constexpr int16_t BUFFER_SIZE = 100;
+constexpr uint8_t BACKGROUND_NUM = 2;
+
+/* a sprite blended wrongly into its transparent buffer can still look right over black, but not over a color */
+ColorType GetBackground(uint8_t index)
+{
+    return (index == 0) ? Color::Black() : Color::GetColorFromRGB(0x40, 0x80, 0xC0); // 0x40, 0x80, 0xC0: blue
+}
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels, ColorType background)
+{
+    buffer.rect = Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = BUFFER_SIZE * sizeof(Color32);
+    buffer.width = BUFFER_SIZE;
+    buffer.height = BUFFER_SIZE;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        pixels[i].full = Color::ColorTo32(background);
+    }
+}
+
+void DrawButton(UIView* button, Color32* pixels, bool useSprite, ColorType background)
+{
+    StateSpriteCache::GetInstance().SetEnable(useSprite);
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels, background);
+    button->OnDraw(buffer, buffer.rect);
+}
+
+/* the state drawn from the sprite differs from the state drawn directly by the rounding of the blends only */
+void ExpectSameDrawing(const Color32* result, const Color32* expect, ColorType background)
+{
+    int32_t inkNum = 0;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 3) << "pixel " << i;     // 3: rounding of the sprite and the blit
+        EXPECT_NEAR(result[i].green, expect[i].green, 3) << "pixel " << i; // 3: rounding of the sprite and the blit
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 3) << "pixel " << i;   // 3: rounding of the sprite and the blit
+        if (expect[i].full != Color::ColorTo32(background)) {
+            inkNum++;
+        }
+    }
+    EXPECT_GT(inkNum, 0);
+}
+} // namespace
+
 class UIRadioButtonTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -140,4 +190,35 @@ HWTEST_F(UIRadioButtonTest, UIRadioButtonSetName_001, TestSize.Level0)
     delete radioBtn4;
     delete radioBtn5;
 }
+
+/**
+ * @tc.name: UIRadioButtonStateSprite_001
+ * @tc.desc: Verify the selected and the unselected states blitted from sprites look like the states drawn directly,
+ *           at a position away from the origin of the buffer, over black and over a color.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIRadioButtonTest, UIRadioButtonStateSprite_001, TestSize.Level1)
+{
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    UIRadioButton* radioBtn = new UIRadioButton();
+    radioBtn->SetPosition(13, 7, 46, 46); // 13, 7: position, 46: default size
+    Color32* expect = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* result = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    const UICheckBox::UICheckBoxState states[] = {UICheckBox::SELECTED, UICheckBox::UNSELECTED};
+    for (UICheckBox::UICheckBoxState state : states) {
+        radioBtn->SetState(state);
+        for (uint8_t i = 0; i < BACKGROUND_NUM; i++) {
+            DrawButton(radioBtn, expect, false, GetBackground(i));
+            DrawButton(radioBtn, result, true, GetBackground(i));
+            EXPECT_EQ(StateSpriteCache::GetInstance().GetEntryNum(), 1);
+            ExpectSameDrawing(result, expect, GetBackground(i));
+        }
+    }
+    StateSpriteCache::GetInstance().Clear();
+    delete radioBtn;
+    delete[] expect;
+    delete[] result;
+}
 } // namespace OHOS
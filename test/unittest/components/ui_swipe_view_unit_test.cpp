@@ -16,8 +16,11 @@
 #include "components/ui_swipe_view.h"
 
 #include <climits>
+#include <cstring>
 #include <gtest/gtest.h>
+#include "common/graphic_startup.h"
 #include "common/screen.h"
+#include "engines/gfx/gfx_engine_manager.h"
 
 using namespace testing::ext;
 namespace OHOS {
@@ -25,6 +28,83 @@ namespace {
     constexpr uint8_t HORIZONTAL = 0;
     constexpr uint8_t VERTICAL = 1;
     const uint16_t DEFAULT_WIDTH = 100;
+    const int16_t PAGE_SIZE = 120;
+    const uint8_t PAGE_NUM = 4;
+    const int16_t ITEM_SIZE = 24;
+    const int16_t ITEM_RADIUS = 8;
+    const int16_t DRAG_DISTANCE = -35;
+    const uint32_t PAGE_COLORS[PAGE_NUM] = {Color::Navy().full, Color::Olive().full, Color::Maroon().full,
+                                           Color::Gray().full};
+
+    /* a page with an opaque background and a grid of rounded items */
+    UIViewGroup* NewPage(uint8_t index)
+    {
+        UIViewGroup* page = new UIViewGroup();
+        page->SetPosition(0, 0, PAGE_SIZE, PAGE_SIZE);
+        page->SetStyle(STYLE_BACKGROUND_COLOR, PAGE_COLORS[index]);
+        page->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+        for (int16_t y = 0; y + ITEM_SIZE <= PAGE_SIZE; y += ITEM_SIZE) {
+            for (int16_t x = 0; x + ITEM_SIZE <= PAGE_SIZE; x += ITEM_SIZE) {
+                UIView* item = new UIView();
+                item->SetPosition(x + 2, y + 2, ITEM_SIZE - 4, ITEM_SIZE - 4); // 2, 4: gap between the items
+                item->SetStyle(STYLE_BACKGROUND_COLOR, Color::White().full);
+                item->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE * 3 / 4);     // 3, 4: translucent items
+                item->SetStyle(STYLE_BORDER_RADIUS, ITEM_RADIUS);
+                page->Add(item);
+            }
+        }
+        return page;
+    }
+
+    void DeletePage(UIView* page)
+    {
+        if (!page->IsViewGroup()) {
+            delete page;
+            return;
+        }
+        UIViewGroup* group = static_cast<UIViewGroup*>(page);
+        UIView* item = group->GetChildrenHead();
+        while (item != nullptr) {
+            UIView* next = item->GetNextSibling();
+            group->Remove(item);
+            delete item;
+            item = next;
+        }
+        delete page;
+    }
+
+    void InitBuffer(BufferInfo& buffer, Color32* pixels)
+    {
+        buffer.rect = Rect(0, 0, PAGE_SIZE - 1, PAGE_SIZE - 1);
+        buffer.mode = ARGB8888;
+        buffer.color = 0;
+        buffer.phyAddr = buffer.virAddr = pixels;
+        buffer.stride = PAGE_SIZE * sizeof(Color32);
+        buffer.width = PAGE_SIZE;
+        buffer.height = PAGE_SIZE;
+        (void)memset(pixels, 0, PAGE_SIZE * PAGE_SIZE * sizeof(Color32));
+    }
+
+    /* draws a view tree the way the root view does */
+    void DrawTree(BufferInfo& buffer, UIView* view, const Rect& mask)
+    {
+        Rect rect;
+        if (!view->IsVisible() || !rect.Intersect(view->GetMaskedRect(), mask)) {
+            return;
+        }
+        view->OnDraw(buffer, rect);
+        if (view->IsViewGroup() && !static_cast<UIViewGroup*>(view)->IsChildrenDrawnByGroup()) {
+            Rect childMask = view->GetContentRect();
+            if (childMask.Intersect(childMask, rect)) {
+                UIView* child = static_cast<UIViewGroup*>(view)->GetChildrenHead();
+                while (child != nullptr) {
+                    DrawTree(buffer, child, childMask);
+                    child = child->GetNextSibling();
+                }
+            }
+        }
+        view->OnPostDraw(buffer, rect);
+    }
 }
 class UISwipeViewTest : public testing::Test {
 public:
@@ -34,9 +114,32 @@ public:
     static void TearDownTestCase() {}
     void SetUp();
     void TearDown();
+    void AddPages();
+    void DragBy(int16_t distance);
     UISwipeView* swipeView_;
 };
 
+void UISwipeViewTest::AddPages()
+{
+    GraphicStartUp::Init();
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        BaseGfxEngine::InitGfxEngine();
+    }
+    swipeView_->SetPosition(0, 0, PAGE_SIZE, PAGE_SIZE);
+    for (uint8_t i = 0; i < PAGE_NUM; i++) {
+        swipeView_->Add(NewPage(i));
+    }
+    swipeView_->SetCurrentPage(1);
+}
+
+void UISwipeViewTest::DragBy(int16_t distance)
+{
+    Point start = {PAGE_SIZE / 2, PAGE_SIZE / 2}; // 2: middle of the view
+    Point end = {static_cast<int16_t>(start.x + distance), start.y};
+    DragEvent event(end, start, {distance, 0});
+    swipeView_->OnDragEvent(event);
+}
+
 void UISwipeViewTest::SetUp()
 {
     if (swipeView_ == nullptr) {
@@ -47,6 +150,13 @@ void UISwipeViewTest::SetUp()
 void UISwipeViewTest::TearDown()
 {
     if (swipeView_ != nullptr) {
+        UIView* page = swipeView_->GetChildrenHead();
+        while (page != nullptr) {
+            UIView* next = page->GetNextSibling();
+            swipeView_->Remove(page);
+            DeletePage(page);
+            page = next;
+        }
         delete swipeView_;
         swipeView_ = nullptr;
     }
@@ -313,4 +423,140 @@ HWTEST_F(UISwipeViewTest, Graphic_UISwipeView_Test_SetAlignMode_001, TestSize.Le
     swipeView_->SetAlignMode(UISwipeView::ALIGN_LEFT);
     EXPECT_EQ(swipeView_->GetAlignMode(), UISwipeView::ALIGN_LEFT);
 }
+
+/**
+ * @tc.name: UISwipeViewSnapshot_001
+ * @tc.desc: Verify a swipe drawn from snapshots looks like the pages drawn live, the snapshots are taken when the
+ *           drag starts and released when the pages settle.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UISwipeViewTest, UISwipeViewSnapshot_001, TestSize.Level0)
+{
+    AddPages();
+    EXPECT_EQ(swipeView_->IsSnapshotEnabled(), false);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), false);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), 0u);
+    swipeView_->SetCurrentPage(1);
+
+    const int32_t pixelNum = PAGE_SIZE * PAGE_SIZE;
+    Color32* expect = new Color32[pixelNum];
+    Color32* result = new Color32[pixelNum];
+    BufferInfo buffer;
+    swipeView_->SetSnapshotEnable(true);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), true);
+    const uint32_t pageSize = PAGE_SIZE * PAGE_SIZE * sizeof(Color32);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), pageSize * 3); // 3: the current page and the pages next to it
+    InitBuffer(buffer, result);
+    DrawTree(buffer, swipeView_, buffer.rect);
+
+    swipeView_->SetSnapshotEnable(false);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), false);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), 0u);
+    InitBuffer(buffer, expect);
+    DrawTree(buffer, swipeView_, buffer.rect);
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 2) << "pixel " << i;     // 2: rounding of two blends
+        EXPECT_NEAR(result[i].green, expect[i].green, 2) << "pixel " << i; // 2: rounding of two blends
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 2) << "pixel " << i;   // 2: rounding of two blends
+    }
+
+    /* settling on a page releases the snapshots */
+    swipeView_->SetSnapshotEnable(true);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_NE(swipeView_->GetSnapshotSize(), 0u);
+    swipeView_->SetCurrentPage(2); // 2: next page
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), false);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), 0u);
+    delete[] expect;
+    delete[] result;
+}
+
+/**
+ * @tc.name: UISwipeViewSnapshot_002
+ * @tc.desc: Verify the snapshots stay within the configured size, pages that do not fit are drawn live, and no
+ *           snapshot is taken when nothing fits.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UISwipeViewTest, UISwipeViewSnapshot_002, TestSize.Level0)
+{
+    AddPages();
+    EXPECT_EQ(swipeView_->GetSnapshotMaxSize(), UISwipeView::DEFAULT_SNAPSHOT_MAX_SIZE);
+    const uint32_t pageSize = PAGE_SIZE * PAGE_SIZE * sizeof(Color32);
+    swipeView_->SetSnapshotEnable(true);
+    swipeView_->SetSnapshotMaxSize(pageSize * 2 - 1); // 2: room for one page only
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), true);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), pageSize);
+
+    const int32_t pixelNum = PAGE_SIZE * PAGE_SIZE;
+    Color32* expect = new Color32[pixelNum];
+    Color32* result = new Color32[pixelNum];
+    BufferInfo buffer;
+    InitBuffer(buffer, result);
+    DrawTree(buffer, swipeView_, buffer.rect);
+    swipeView_->SetSnapshotEnable(false);
+    InitBuffer(buffer, expect);
+    DrawTree(buffer, swipeView_, buffer.rect);
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 2) << "pixel " << i;     // 2: rounding of two blends
+        EXPECT_NEAR(result[i].green, expect[i].green, 2) << "pixel " << i; // 2: rounding of two blends
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 2) << "pixel " << i;   // 2: rounding of two blends
+    }
+    delete[] expect;
+    delete[] result;
+
+    swipeView_->SetCurrentPage(1);
+    swipeView_->SetSnapshotEnable(true);
+    swipeView_->SetSnapshotMaxSize(pageSize - 1);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), false);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), 0u);
+}
+
+/**
+ * @tc.name: UISwipeViewSnapshot_003
+ * @tc.desc: Verify translucent pages are snapshot over the background of the swipe view, so the swipe looks like the
+ *           pages drawn live on a colored background, and are drawn live when that background is not opaque.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UISwipeViewTest, UISwipeViewSnapshot_003, TestSize.Level0)
+{
+    AddPages();
+    for (UIView* page = swipeView_->GetChildrenHead(); page != nullptr; page = page->GetNextSibling()) {
+        page->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE / 2); // 2: half
+    }
+    swipeView_->SetStyle(STYLE_BACKGROUND_COLOR, Color::Silver().full);
+    swipeView_->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    swipeView_->SetSnapshotEnable(true);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), true);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), PAGE_SIZE * PAGE_SIZE * sizeof(Color32) * 3); // 3: three pages
+
+    const int32_t pixelNum = PAGE_SIZE * PAGE_SIZE;
+    Color32* expect = new Color32[pixelNum];
+    Color32* result = new Color32[pixelNum];
+    BufferInfo buffer;
+    InitBuffer(buffer, result);
+    DrawTree(buffer, swipeView_, buffer.rect);
+    swipeView_->SetSnapshotEnable(false);
+    InitBuffer(buffer, expect);
+    DrawTree(buffer, swipeView_, buffer.rect);
+    for (int32_t i = 0; i < pixelNum; i++) {
+        EXPECT_NEAR(result[i].red, expect[i].red, 2) << "pixel " << i;     // 2: rounding of two blends
+        EXPECT_NEAR(result[i].green, expect[i].green, 2) << "pixel " << i; // 2: rounding of two blends
+        EXPECT_NEAR(result[i].blue, expect[i].blue, 2) << "pixel " << i;   // 2: rounding of two blends
+    }
+    delete[] expect;
+    delete[] result;
+
+    /* nothing opaque lies behind the pages inside the swipe view, so they are not snapshot */
+    swipeView_->SetCurrentPage(1);
+    swipeView_->SetStyle(STYLE_BACKGROUND_OPA, OPA_TRANSPARENT);
+    swipeView_->SetSnapshotEnable(true);
+    DragBy(DRAG_DISTANCE);
+    EXPECT_EQ(swipeView_->IsChildrenDrawnByGroup(), false);
+    EXPECT_EQ(swipeView_->GetSnapshotSize(), 0u);
+}
 } // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include "components/ui_view_group.h"
 #include <climits>
+#include "components/root_view.h"
 #include <gtest/gtest.h>
 
 using namespace testing::ext;
@@ -158,4 +159,75 @@ HWTEST_F(UIViewGroupTest, UIViewGroupGetViewType_001, TestSize.Level1)
     }
     EXPECT_EQ(viewGroup_->GetViewType(), UI_VIEW_GROUP);
 }
+
+/**
+ * @tc.name: UIViewGroupRequestMeasure_001
+ * @tc.desc: Verify RequestMeasure marks the view and its ancestors only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIViewGroupTest, UIViewGroupRequestMeasure_001, TestSize.Level0)
+{
+    if (viewGroup_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    UIViewGroup* group = new UIViewGroup();
+    UIView* view1 = new UIView();
+    UIView* view2 = new UIView();
+    viewGroup_->Add(group);
+    group->Add(view1);
+    viewGroup_->Add(view2);
+    RootView::GetInstance()->MeasureView(viewGroup_);
+    EXPECT_EQ(viewGroup_->IsNeedMeasure(), false);
+    EXPECT_EQ(group->IsNeedMeasure(), false);
+    EXPECT_EQ(view1->IsNeedMeasure(), false);
+    EXPECT_EQ(view2->IsNeedMeasure(), false);
+
+    view1->RequestMeasure();
+    EXPECT_EQ(view1->IsNeedMeasure(), true);
+    EXPECT_EQ(group->IsNeedMeasure(), true);
+    EXPECT_EQ(viewGroup_->IsNeedMeasure(), true);
+    EXPECT_EQ(view2->IsNeedMeasure(), false);
+
+    viewGroup_->RemoveAll();
+    group->RemoveAll();
+    delete view1;
+    delete view2;
+    delete group;
+}
+
+/**
+ * @tc.name: UIViewGroupMeasureView_001
+ * @tc.desc: Verify the measure pass only visits the marked subtrees and counts the measured views.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIViewGroupTest, UIViewGroupMeasureView_001, TestSize.Level0)
+{
+    if (viewGroup_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    RootView* rootView = RootView::GetInstance();
+    UIView* view1 = new UIView();
+    UIView* view2 = new UIView();
+    viewGroup_->Add(view1);
+    viewGroup_->Add(view2);
+    rootView->MeasureView(viewGroup_);
+    EXPECT_EQ(rootView->GetMeasuredViewCount(), 3); // 3: the group and both children are new
+
+    rootView->MeasureView(viewGroup_);
+    EXPECT_EQ(rootView->GetMeasuredViewCount(), 0);
+
+    view2->Resize(10, 10); // 10: new width and height
+    rootView->MeasureView(viewGroup_);
+    EXPECT_EQ(rootView->GetMeasuredViewCount(), 2); // 2: the group and view2
+
+    viewGroup_->Remove(view1);
+    rootView->MeasureView(viewGroup_);
+    EXPECT_EQ(rootView->GetMeasuredViewCount(), 1); // 1: only the group
+
+    viewGroup_->RemoveAll();
+    delete view1;
+    delete view2;
+}
 } // namespace OHOS
@@ -18,6 +18,8 @@
 #include <climits>
 #include <gtest/gtest.h>
 
+#include "common/style_pool.h"
+
 using namespace testing::ext;
 namespace OHOS {
 namespace {
@@ -47,6 +49,9 @@ namespace {
     const Vector2<int16_t> POLYGON2 = {70, 70};
     const Vector2<int16_t> POLYGON3 = {0, 140};
     const Vector2<int16_t> POLYGON4 = {-70, 70};
+    const uint16_t SCREEN_VIEW_NUM = 500;
+    const uint8_t SCREEN_COLOR_NUM = 5;
+    const uint8_t SCREEN_PADDING_NUM = 4;
 }
 
 class UIViewTest : public testing::Test {
@@ -1123,4 +1128,86 @@ HWTEST_F(UIViewTest, Graphic_UIView_Test_Border_001, TestSize.Level0)
     EXPECT_EQ(BORDER_WIDTH + BORDER_WIDTH + DEFAULE_WIDTH - 1, rect.GetRight());
     EXPECT_EQ(BORDER_WIDTH + BORDER_WIDTH + DEFAULE_HEIGHT - 1, rect.GetBottom());
 }
+
+/**
+ * @tc.name: Graphic_UIView_Test_StylePool_001
+ * @tc.desc: Verify views with the same style values share one pooled style, and a change of one view does not
+ *           change the others.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIViewTest, Graphic_UIView_Test_StylePool_001, TestSize.Level0)
+{
+    StylePool& pool = StylePool::GetInstance();
+    uint16_t entryNum = pool.GetEntryCount();
+    UIView* view1 = new UIView();
+    UIView* view2 = new UIView();
+    view1->SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+    view2->SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+    EXPECT_EQ(&view1->GetStyleConst(), &view2->GetStyleConst());
+    EXPECT_EQ(pool.GetEntryCount(), entryNum + 1);
+
+    view2->SetStyle(STYLE_PADDING_LEFT, PADDING_LEFT);
+    EXPECT_NE(&view1->GetStyleConst(), &view2->GetStyleConst());
+    EXPECT_EQ(view1->GetStyle(STYLE_PADDING_LEFT), 0);
+    EXPECT_EQ(view2->GetStyle(STYLE_PADDING_LEFT), PADDING_LEFT);
+    EXPECT_EQ(view2->GetStyle(STYLE_BACKGROUND_COLOR), Color::Red().full);
+    EXPECT_EQ(pool.GetEntryCount(), entryNum + 2); // 2: red, and red with padding
+
+    view2->SetStyle(STYLE_PADDING_LEFT, 0);
+    EXPECT_EQ(&view1->GetStyleConst(), &view2->GetStyleConst());
+    EXPECT_EQ(pool.GetEntryCount(), entryNum + 1);
+
+    Style& defaultStyle = StyleDefault::GetDefaultStyle();
+    view2->SetStyle(defaultStyle);
+    EXPECT_EQ(view2->GetStyle(STYLE_BACKGROUND_COLOR), defaultStyle.GetStyle(STYLE_BACKGROUND_COLOR));
+    EXPECT_EQ(view1->GetStyle(STYLE_BACKGROUND_COLOR), Color::Red().full);
+    delete view1;
+    delete view2;
+    EXPECT_EQ(pool.GetEntryCount(), entryNum);
+}
+
+/**
+ * @tc.name: Graphic_UIView_Test_StylePool_002
+ * @tc.desc: Verify the pool size, the sharing ratio and the memory saved on a screen of 500 views that each change
+ *           one color and one padding.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIViewTest, Graphic_UIView_Test_StylePool_002, TestSize.Level1)
+{
+    StylePool& pool = StylePool::GetInstance();
+    uint16_t entryNum = pool.GetEntryCount();
+    uint32_t refNum = pool.GetReferenceCount();
+    const ColorType colors[SCREEN_COLOR_NUM] = {Color::Red(), Color::Green(), Color::Blue(), Color::Yellow(),
+                                                Color::Cyan()};
+    UIViewGroup* screen = new UIViewGroup();
+    UIView* views[SCREEN_VIEW_NUM];
+    for (uint16_t i = 0; i < SCREEN_VIEW_NUM; i++) {
+        views[i] = new UIView();
+        views[i]->SetStyle(STYLE_BACKGROUND_COLOR, colors[i % SCREEN_COLOR_NUM].full);
+        views[i]->SetStyle(STYLE_PADDING_TOP, i % SCREEN_PADDING_NUM);
+        screen->Add(views[i]);
+    }
+
+    uint16_t screenEntryNum = pool.GetEntryCount() - entryNum;
+    uint32_t screenRefNum = pool.GetReferenceCount() - refNum;
+    EXPECT_EQ(screenRefNum, SCREEN_VIEW_NUM);
+    /* colors and paddings are coprime, so every combination shows up */
+    EXPECT_EQ(screenEntryNum, SCREEN_COLOR_NUM * SCREEN_PADDING_NUM);
+    for (uint16_t i = 0; i < SCREEN_VIEW_NUM; i++) {
+        EXPECT_EQ(views[i]->GetStyle(STYLE_BACKGROUND_COLOR), colors[i % SCREEN_COLOR_NUM].full);
+        EXPECT_EQ(views[i]->GetStyle(STYLE_PADDING_TOP), i % SCREEN_PADDING_NUM);
+    }
+    /* 25 views share each style, and all but one copy per style is saved */
+    EXPECT_EQ(screenRefNum / screenEntryNum, SCREEN_VIEW_NUM / (SCREEN_COLOR_NUM * SCREEN_PADDING_NUM));
+    uint32_t savedBytes = (screenRefNum - screenEntryNum) * sizeof(Style);
+    EXPECT_EQ(savedBytes, (SCREEN_VIEW_NUM - SCREEN_COLOR_NUM * SCREEN_PADDING_NUM) * sizeof(Style));
+
+    for (uint16_t i = 0; i < SCREEN_VIEW_NUM; i++) {
+        screen->Remove(views[i]);
+        delete views[i];
+    }
+    delete screen;
+    EXPECT_EQ(pool.GetEntryCount(), entryNum);
+    EXPECT_EQ(pool.GetReferenceCount(), refNum);
+}
 } // namespace OHOS
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_dump_dom_tree.h"
+
+#if ENABLE_DEBUG
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "common/graphic_startup.h"
+#include "components/root_view.h"
+#include "components/ui_label.h"
+#include "components/ui_view_group.h"
+#include "dfx/dump_dom_writer.h"
+#include "securec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* JSON_PATH = "/data/dump_dom_tree_test.json";
+const char* BINARY_PATH = "/data/dump_dom_tree_test.bin";
+const char* GROUP_ID = "dumpGroup";
+const char* LABEL_ID = "dumpLabel";
+constexpr uint8_t LABEL_NUM = 20;
+
+bool ReadFile(const char* path, std::string& content)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char buffer[256]; // 256: read buffer size
+    size_t size;
+    content.clear();
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        content.append(buffer, size);
+    }
+    fclose(file);
+    return true;
+}
+
+/* Rebuilds the tree of a binary dump as cJSON, see DumpBinaryWriter for the records. */
+class BinaryDumpReader {
+public:
+    static constexpr size_t HEAD_SIZE = 5; // 5: magic and version
+
+    explicit BinaryDumpReader(const std::string& data) : data_(data), pos_(HEAD_SIZE) {}
+
+    /* Returns the root object, to be released by cJSON_Delete, or nullptr if the dump is malformed. */
+    cJSON* Read()
+    {
+        /* 4: magic size, the version follows it */
+        if ((data_.size() < HEAD_SIZE) || (data_.compare(0, 4, "UIDT") != 0) ||
+            (static_cast<uint8_t>(data_[4]) != DumpBinaryWriter::VERSION)) {
+            return nullptr;
+        }
+        uint8_t tag = 0;
+        std::string key;
+        if (!ReadBytes(&tag, sizeof(tag)) || (tag != 'O') || !ReadKey(key) || !key.empty()) {
+            return nullptr;
+        }
+        cJSON* root = ReadItems(cJSON_CreateObject(), 'o');
+        if ((root != nullptr) && (pos_ != data_.size())) {
+            cJSON_Delete(root);
+            return nullptr;
+        }
+        return root;
+    }
+
+private:
+    bool ReadBytes(void* value, size_t size)
+    {
+        if (data_.size() - pos_ < size) {
+            return false;
+        }
+        if (size > 0) {
+            (void)memcpy_s(value, size, data_.data() + pos_, size);
+        }
+        pos_ += size;
+        return true;
+    }
+
+    bool ReadString(std::string& value, size_t size)
+    {
+        if (data_.size() - pos_ < size) {
+            return false;
+        }
+        value.assign(data_, pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    bool ReadKey(std::string& key)
+    {
+        uint8_t index = 0;
+        if (!ReadBytes(&index, sizeof(index))) {
+            return false;
+        }
+        if (index == 0) {
+            key.clear();
+            return true;
+        }
+        if (index == DumpBinaryWriter::KEY_INLINE) {
+            uint8_t length = 0;
+            return ReadBytes(&length, sizeof(length)) && ReadString(key, length);
+        }
+        if (index > DumpBinaryWriter::KEY_NUM) {
+            return false;
+        }
+        key = DumpBinaryWriter::KEYS[index - 1];
+        return true;
+    }
+
+    cJSON* ReadItem(uint8_t tag)
+    {
+        switch (tag) {
+            case 'O':
+                return ReadItems(cJSON_CreateObject(), 'o');
+            case 'A':
+                return ReadItems(cJSON_CreateArray(), 'a');
+            case 'S': {
+                uint16_t length = 0;
+                std::string value;
+                if (!ReadBytes(&length, sizeof(length)) || !ReadString(value, length)) {
+                    return nullptr;
+                }
+                return cJSON_CreateString(value.c_str());
+            }
+            case 'N': {
+                int32_t number = 0;
+                return ReadBytes(&number, sizeof(number)) ? cJSON_CreateNumber(number) : nullptr;
+            }
+            case 'D': {
+                double number = 0;
+                return ReadBytes(&number, sizeof(number)) ? cJSON_CreateNumber(number) : nullptr;
+            }
+            case 'T':
+                return cJSON_CreateTrue();
+            case 'F':
+                return cJSON_CreateFalse();
+            default:
+                return nullptr;
+        }
+    }
+
+    /* Reads the items of container up to its end tag, releases it and returns nullptr on a malformed item. */
+    cJSON* ReadItems(cJSON* container, uint8_t endTag)
+    {
+        if (container == nullptr) {
+            return nullptr;
+        }
+        uint8_t tag = 0;
+        while (ReadBytes(&tag, sizeof(tag))) {
+            if (tag == endTag) {
+                return container;
+            }
+            std::string key;
+            cJSON* item = ReadKey(key) ? ReadItem(tag) : nullptr;
+            if (item == nullptr) {
+                break;
+            }
+            if (cJSON_IsArray(container)) {
+                cJSON_AddItemToArray(container, item);
+            } else {
+                cJSON_AddItemToObject(container, key.c_str(), item);
+            }
+        }
+        cJSON_Delete(container);
+        return nullptr;
+    }
+
+    const std::string& data_;
+    size_t pos_;
+};
+} // namespace
+
+class DumpDomTreeTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GraphicStartUp::Init();
+    }
+
+    static void TearDownTestCase() {}
+
+    void SetUp()
+    {
+        group_ = new UIViewGroup();
+        group_->SetPosition(0, 0, 200, 400); // 200, 400: group size
+        group_->SetViewId(GROUP_ID);
+        for (uint8_t i = 0; i < LABEL_NUM; i++) {
+            labels_[i].SetPosition(0, i * 20, 200, 20); // 20: label height, 200: label width
+            labels_[i].SetText("line 1\n\"line 2\"\tend");
+            group_->Add(&labels_[i]);
+        }
+        labels_[0].SetViewId(LABEL_ID);
+        RootView::GetInstance()->Add(group_);
+    }
+
+    void TearDown()
+    {
+        RootView::GetInstance()->Remove(group_);
+        group_->RemoveAll();
+        delete group_;
+        group_ = nullptr;
+        remove(JSON_PATH);
+        remove(BINARY_PATH);
+    }
+
+protected:
+    UIViewGroup* group_ = nullptr;
+    UILabel labels_[LABEL_NUM];
+};
+
+/**
+ * @tc.name: UIDumpDomTreeDumpDomTree_001
+ * @tc.desc: Verify the streamed JSON is printed exactly as cJSON prints the same tree.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DumpDomTreeTest, UIDumpDomTreeDumpDomTree_001, TestSize.Level1)
+{
+    ASSERT_TRUE(UIDumpDomTree::GetInstance()->DumpDomTree(GROUP_ID, JSON_PATH));
+    std::string content;
+    ASSERT_TRUE(ReadFile(JSON_PATH, content));
+
+    cJSON* root = cJSON_Parse(content.c_str());
+    ASSERT_NE(root, nullptr);
+    char* printed = cJSON_Print(root);
+    ASSERT_NE(printed, nullptr);
+    EXPECT_STREQ(printed, content.c_str());
+    cJSON_free(printed);
+
+    cJSON* id = cJSON_GetObjectItem(root, "id");
+    ASSERT_NE(id, nullptr);
+    EXPECT_STREQ(id->valuestring, GROUP_ID);
+    cJSON* child = cJSON_GetObjectItem(root, "child");
+    ASSERT_NE(child, nullptr);
+    ASSERT_EQ(cJSON_GetArraySize(child), LABEL_NUM);
+    cJSON* text = cJSON_GetObjectItem(cJSON_GetArrayItem(child, 0), "text");
+    ASSERT_NE(text, nullptr);
+    EXPECT_STREQ(text->valuestring, "line 1\n\"line 2\"\tend");
+    cJSON* height = cJSON_GetObjectItem(cJSON_GetArrayItem(child, 1), "height");
+    ASSERT_NE(height, nullptr);
+    EXPECT_EQ(height->valueint, 20); // 20: label height
+    cJSON_Delete(root);
+}
+
+/**
+ * @tc.name: UIDumpDomTreeDumpDomTree_002
+ * @tc.desc: Verify the binary dump holds the same tree as the JSON one, and is smaller.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DumpDomTreeTest, UIDumpDomTreeDumpDomTree_002, TestSize.Level1)
+{
+    ASSERT_TRUE(UIDumpDomTree::GetInstance()->DumpDomTree(GROUP_ID, JSON_PATH, DUMP_FORMAT_JSON));
+    ASSERT_TRUE(UIDumpDomTree::GetInstance()->DumpDomTree(GROUP_ID, BINARY_PATH, DUMP_FORMAT_BINARY));
+    std::string json;
+    std::string binary;
+    ASSERT_TRUE(ReadFile(JSON_PATH, json));
+    ASSERT_TRUE(ReadFile(BINARY_PATH, binary));
+    EXPECT_LT(binary.size(), json.size());
+    cJSON* expect = cJSON_Parse(json.c_str());
+    ASSERT_NE(expect, nullptr);
+    cJSON* name = cJSON_GetObjectItem(expect, "name");
+    ASSERT_NE(name, nullptr);
+
+    /* the root object without a key, then its name as the first known key */
+    uint16_t nameLength = static_cast<uint16_t>(strlen(name->valuestring));
+    const size_t nameBegin = BinaryDumpReader::HEAD_SIZE + 6; // 6: 'O', no key, 'S', key, length of 2 bytes
+    ASSERT_GE(binary.size(), nameBegin + nameLength);
+    EXPECT_EQ(binary.compare(0, 4, "UIDT"), 0); // 4: magic size
+    EXPECT_EQ(binary[4], DumpBinaryWriter::VERSION); // 4: version after the magic
+    EXPECT_EQ(binary[BinaryDumpReader::HEAD_SIZE], 'O');
+    EXPECT_EQ(binary[BinaryDumpReader::HEAD_SIZE + 1], 0);
+    EXPECT_EQ(binary[BinaryDumpReader::HEAD_SIZE + 2], 'S'); // 2: after the tag and the key of the object
+    EXPECT_STREQ(DumpBinaryWriter::KEYS[0], "name");
+    EXPECT_EQ(binary[BinaryDumpReader::HEAD_SIZE + 3], 1); // 3: key of the string, 1: the first known key
+    uint16_t length = 0;
+    const size_t lengthBegin = BinaryDumpReader::HEAD_SIZE + 4; // 4: the two tags and their keys
+    (void)memcpy_s(&length, sizeof(length), binary.data() + lengthBegin, sizeof(length));
+    EXPECT_EQ(length, nameLength);
+    EXPECT_EQ(binary.compare(nameBegin, nameLength, name->valuestring), 0);
+
+    /* every other record, down to the escaped text of the labels */
+    BinaryDumpReader reader(binary);
+    cJSON* result = reader.Read();
+    ASSERT_NE(result, nullptr);
+    char* printed = cJSON_Print(result);
+    ASSERT_NE(printed, nullptr);
+    EXPECT_STREQ(printed, json.c_str());
+    cJSON_free(printed);
+    cJSON_Delete(result);
+    cJSON_Delete(expect);
+}
+
+/**
+ * @tc.name: UIDumpDomTreeDumpDomTree_003
+ * @tc.desc: Verify an unknown id fails without creating the file, and a single node is still dumped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DumpDomTreeTest, UIDumpDomTreeDumpDomTree_003, TestSize.Level1)
+{
+    remove(JSON_PATH);
+    EXPECT_FALSE(UIDumpDomTree::GetInstance()->DumpDomTree("noSuchView", JSON_PATH));
+    std::string content;
+    EXPECT_FALSE(ReadFile(JSON_PATH, content));
+
+    char* node = UIDumpDomTree::GetInstance()->DumpDomNode(LABEL_ID);
+    ASSERT_NE(node, nullptr);
+    cJSON* root = cJSON_Parse(node);
+    ASSERT_NE(root, nullptr);
+    cJSON* id = cJSON_GetObjectItem(root, "id");
+    ASSERT_NE(id, nullptr);
+    EXPECT_STREQ(id->valuestring, LABEL_ID);
+    EXPECT_EQ(cJSON_GetObjectItem(root, "child"), nullptr);
+    cJSON_Delete(root);
+    cJSON_free(node);
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_frame_timeline.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "gfx_utils/file.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* const TRACE_PATH = "/storage/frame_timeline_trace.json";
+constexpr uint32_t OVERHEAD_LOOP = 100000;
+// A recorded scope costs about 100 ns on an x86 desktop and a stopped one a few ns. The bounds leave room for slower
+// boards and loaded machines so the case stays stable.
+constexpr uint64_t MAX_SCOPE_COST_NS = 5000;
+constexpr uint64_t MAX_STOPPED_SCOPE_COST_NS = 500;
+} // namespace
+
+class FrameTimelineTest : public testing::Test {
+public:
+    FrameTimelineTest() {}
+    virtual ~FrameTimelineTest() {}
+
+    void SetUp() override
+    {
+        UIFrameTimeline::GetInstance()->Clear();
+        UIFrameTimeline::GetInstance()->SetRecordState(true);
+    }
+
+    void TearDown() override
+    {
+        UIFrameTimeline::GetInstance()->SetRecordState(false);
+        UIFrameTimeline::GetInstance()->Clear();
+    }
+};
+
+/**
+ * @tc.name: FrameTimelineRecord001
+ * @tc.desc: Verify recorded phases are stored in order with their duration.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTimelineTest, FrameTimelineRecord001, TestSize.Level0)
+{
+    UIFrameTimeline* timeline = UIFrameTimeline::GetInstance();
+    timeline->BeginFrame();
+    timeline->Record(FRAME_PHASE_MEASURE, 100, 150);  // 100, 150: start and end time
+    timeline->Record(FRAME_PHASE_DRAW_TOP, 150, 400); // 150, 400: start and end time
+    EXPECT_EQ(timeline->GetEventCount(), 2);          // 2: event count
+
+    FrameTimelineEvent event;
+    EXPECT_EQ(timeline->GetEvent(0, event), true);
+    EXPECT_EQ(event.phase, FRAME_PHASE_MEASURE);
+    EXPECT_EQ(event.startUs, 100u);   // 100: start time
+    EXPECT_EQ(event.durationUs, 50u); // 50: duration
+    EXPECT_EQ(timeline->GetEvent(1, event), true);
+    EXPECT_EQ(event.phase, FRAME_PHASE_DRAW_TOP);
+    EXPECT_EQ(event.durationUs, 250u); // 250: duration
+    EXPECT_EQ(timeline->GetEvent(2, event), false); // 2: out of range
+}
+
+/**
+ * @tc.name: FrameTimelineRecord002
+ * @tc.desc: Verify the ring buffer keeps the newest events when it overflows, and nothing is recorded when stopped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTimelineTest, FrameTimelineRecord002, TestSize.Level0)
+{
+    UIFrameTimeline* timeline = UIFrameTimeline::GetInstance();
+    uint32_t total = FRAME_TIMELINE_MAX_EVENT_NUM + 10; // 10: overflow count
+    for (uint32_t i = 0; i < total; i++) {
+        timeline->Record(FRAME_PHASE_FLUSH, i, i + 1);
+    }
+    EXPECT_EQ(timeline->GetEventCount(), FRAME_TIMELINE_MAX_EVENT_NUM);
+    FrameTimelineEvent event;
+    timeline->GetEvent(0, event);
+    EXPECT_EQ(event.startUs, 10u); // 10: oldest remaining event
+    timeline->GetEvent(FRAME_TIMELINE_MAX_EVENT_NUM - 1, event);
+    EXPECT_EQ(event.startUs, total - 1);
+
+    timeline->Clear();
+    timeline->SetRecordState(false);
+    {
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_INPUT);
+    }
+    timeline->Record(FRAME_PHASE_INPUT, 0, 1);
+    EXPECT_EQ(timeline->GetEventCount(), 0);
+}
+
+/**
+ * @tc.name: FrameTimelineExport001
+ * @tc.desc: Verify the exported file is a Chrome trace with one complete event per phase.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameTimelineTest, FrameTimelineExport001, TestSize.Level0)
+{
+    UIFrameTimeline* timeline = UIFrameTimeline::GetInstance();
+    timeline->BeginFrame();
+    {
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_RENDER);
+    }
+    timeline->Record(FRAME_PHASE_MERGE_RECTS, 10, 20); // 10, 20: start and end time
+    EXPECT_EQ(timeline->ExportChromeTrace(TRACE_PATH), true);
+    EXPECT_EQ(timeline->ExportChromeTrace(nullptr), false);
+
+    FILE* file = fopen(TRACE_PATH, "r");
+    ASSERT_NE(file, nullptr);
+    char content[512] = {0}; // 512: enough for two events
+    size_t size = fread(content, 1, sizeof(content) - 1, file);
+    fclose(file);
+    unlink(TRACE_PATH);
+    EXPECT_GT(size, 0u);
+    EXPECT_NE(strstr(content, "\"traceEvents\":["), nullptr);
+    EXPECT_NE(strstr(content, "\"name\":\"Render\""), nullptr);
+    EXPECT_NE(strstr(content, "\"name\":\"MergeRects\",\"cat\":\"ui\",\"ph\":\"X\",\"ts\":10,\"dur\":10"), nullptr);
+}
+
+/**
+ * @tc.name: FrameTimelineOverhead001
+ * @tc.desc: Verify a recorded scope and a stopped one stay within their cost bounds.
+ * @tc.type: PERF
+ */
+HWTEST_F(FrameTimelineTest, FrameTimelineOverhead001, TestSize.Level1)
+{
+    uint64_t start = UIFrameTimeline::GetTimeUs();
+    for (uint32_t i = 0; i < OVERHEAD_LOOP; i++) {
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_DRAW_TOP);
+    }
+    uint64_t recordCostNs = (UIFrameTimeline::GetTimeUs() - start) * 1000 / OVERHEAD_LOOP; // 1000: us to ns
+
+    UIFrameTimeline::GetInstance()->SetRecordState(false);
+    start = UIFrameTimeline::GetTimeUs();
+    for (uint32_t i = 0; i < OVERHEAD_LOOP; i++) {
+        DEBUG_FRAME_TIMELINE_SCOPE(FRAME_PHASE_DRAW_TOP);
+    }
+    uint64_t idleCostNs = (UIFrameTimeline::GetTimeUs() - start) * 1000 / OVERHEAD_LOOP; // 1000: us to ns
+
+    EXPECT_LT(recordCostNs, MAX_SCOPE_COST_NS);
+    EXPECT_LT(idleCostNs, MAX_STOPPED_SCOPE_COST_NS);
+    EXPECT_LE(idleCostNs, recordCostNs);
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_FRAME_TIMELINE
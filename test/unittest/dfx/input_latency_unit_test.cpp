@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_input_latency.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
+#include <climits>
+#include <gtest/gtest.h>
+
+#include "dfx/point_event_injector.h"
+
+using namespace testing::ext;
+namespace OHOS {
+class InputLatencyTest : public testing::Test {
+public:
+    InputLatencyTest() {}
+    virtual ~InputLatencyTest() {}
+
+    void SetUp() override
+    {
+        UIInputLatency::GetInstance()->Clear();
+        UIInputLatency::GetInstance()->SetRecordState(true);
+    }
+
+    void TearDown() override
+    {
+        UIInputLatency::GetInstance()->SetRecordState(false);
+        UIInputLatency::GetInstance()->Clear();
+    }
+};
+
+/**
+ * @tc.name: InputLatencyRecord001
+ * @tc.desc: Verify every sample read before a flush is added to the bucket of its latency.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InputLatencyTest, InputLatencyRecord001, TestSize.Level0)
+{
+    UIInputLatency* latency = UIInputLatency::GetInstance();
+    latency->RecordInput(1000);  // 1000: read time
+    latency->RecordInput(19000); // 19000: read time
+    latency->RecordFlush(20000); // 20000: flush time, latencies are 19 ms and 1 ms
+    EXPECT_EQ(latency->GetSampleCount(), 2u); // 2: sample count
+    EXPECT_EQ(latency->GetBucketCount(1), 1u);  // 1: [1, 2) ms
+    EXPECT_EQ(latency->GetBucketCount(5), 1u);  // 5: [16, 32) ms
+    EXPECT_EQ(latency->GetMaxUs(), 19000u);     // 19000: largest latency
+    EXPECT_EQ(latency->GetAverageUs(), 10000u); // 10000: average latency
+
+    /* samples are counted once, a flush without new samples adds nothing */
+    latency->RecordFlush(40000); // 40000: flush time
+    EXPECT_EQ(latency->GetSampleCount(), 2u); // 2: sample count
+}
+
+/**
+ * @tc.name: InputLatencyRecord002
+ * @tc.desc: Verify the bucket bounds, the overflow of pending samples and that nothing is recorded when stopped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InputLatencyTest, InputLatencyRecord002, TestSize.Level0)
+{
+    EXPECT_EQ(UIInputLatency::GetBucketUpperUs(0), 1000u);  // 1000: 1 ms
+    EXPECT_EQ(UIInputLatency::GetBucketUpperUs(8), 256000u); // 8: second last bucket, 256000: 256 ms
+    EXPECT_EQ(UIInputLatency::GetBucketUpperUs(INPUT_LATENCY_BUCKET_NUM - 1), UINT32_MAX);
+
+    UIInputLatency* latency = UIInputLatency::GetInstance();
+    for (uint8_t i = 0; i < INPUT_LATENCY_MAX_PENDING_NUM + 2; i++) { // 2: overflow count
+        latency->RecordInput(0);
+    }
+    latency->RecordFlush(1000000); // 1000000: one second, beyond the last bound
+    EXPECT_EQ(latency->GetSampleCount(), INPUT_LATENCY_MAX_PENDING_NUM);
+    EXPECT_EQ(latency->GetDroppedCount(), 2u); // 2: overflow count
+    EXPECT_EQ(latency->GetBucketCount(INPUT_LATENCY_BUCKET_NUM - 1), INPUT_LATENCY_MAX_PENDING_NUM);
+
+    latency->SetRecordState(false);
+    latency->RecordInput(0);
+    latency->RecordFlush(1000); // 1000: flush time
+    EXPECT_EQ(latency->GetSampleCount(), INPUT_LATENCY_MAX_PENDING_NUM);
+}
+
+/**
+ * @tc.name: InputLatencyRecord003
+ * @tc.desc: Verify each sample read by an input device waits for the next flush.
+ * @tc.type: FUNC
+ */
+HWTEST_F(InputLatencyTest, InputLatencyRecord003, TestSize.Level0)
+{
+    PointEventInjector device;
+    DeviceData data = {};
+    data.point = {0, 0};
+    data.state = InputDevice::STATE_RELEASE;
+    device.SetPointEvent(data);
+    device.ProcessEvent();
+    device.SetPointEvent(data);
+    device.ProcessEvent();
+
+    UIInputLatency* latency = UIInputLatency::GetInstance();
+    EXPECT_EQ(latency->GetSampleCount(), 0u);
+    latency->RecordFlush(UIInputLatency::GetTimeUs());
+    EXPECT_EQ(latency->GetSampleCount(), 2u); // 2: sample count
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_INPUT_LATENCY
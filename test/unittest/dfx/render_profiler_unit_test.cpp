@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_render_profiler.h"
+
+#if ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "common/graphic_startup.h"
+#include "common/screen.h"
+#include "components/ui_label.h"
+#include "components/ui_view_group.h"
+#include "engines/gfx/gfx_engine_manager.h"
+
+using namespace testing::ext;
+namespace OHOS {
+class RenderProfilerTest : public testing::Test {
+public:
+    RenderProfilerTest() {}
+    virtual ~RenderProfilerTest() {}
+
+    static void SetUpTestCase()
+    {
+        GraphicStartUp::Init();
+    }
+
+    void SetUp() override
+    {
+        UIRenderProfiler::GetInstance()->Clear();
+        UIRenderProfiler::GetInstance()->SetProfileState(true);
+    }
+
+    void TearDown() override
+    {
+        UIRenderProfiler::GetInstance()->SetProfileState(false);
+        UIRenderProfiler::GetInstance()->SetOverdrawState(false);
+        UIRenderProfiler::GetInstance()->SetFrameWindow(RENDER_PROFILER_DEFAULT_FRAME_NUM);
+        UIRenderProfiler::GetInstance()->Clear();
+    }
+};
+
+/**
+ * @tc.name: RenderProfilerRecord001
+ * @tc.desc: Verify the draw calls of a view are aggregated and the report is sorted by cost.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderProfilerTest, RenderProfilerRecord001, TestSize.Level0)
+{
+    UIRenderProfiler* profiler = UIRenderProfiler::GetInstance();
+    UIViewGroup group;
+    UILabel label;
+    label.SetViewId("label");
+    Rect area(0, 0, 9, 9); // 9: 10 * 10 pixels
+    profiler->Record(&group, false, 100, 110, area);  // 100, 110: 10 us
+    profiler->Record(&label, false, 200, 230, area);  // 200, 230: 30 us
+    profiler->Record(&label, false, 300, 320, area);  // 300, 320: 20 us
+    profiler->Record(&label, true, 400, 405, area);   // 400, 405: 5 us
+    profiler->Publish();
+
+    ViewRenderCost costs[RENDER_PROFILER_MAX_VIEW_NUM];
+    ASSERT_EQ(profiler->GetReport(costs, RENDER_PROFILER_MAX_VIEW_NUM), 2); // 2: two views
+    EXPECT_EQ(costs[0].view, &label);
+    EXPECT_EQ(costs[0].type, UI_LABEL);
+    EXPECT_STREQ(costs[0].id, "label");
+    EXPECT_EQ(costs[0].drawCount, 2U);   // 2: OnDraw calls
+    EXPECT_EQ(costs[0].drawUs, 50U);     // 50: 30 + 20 us
+    EXPECT_EQ(costs[0].postDrawUs, 5U);  // 5: OnPostDraw us
+    EXPECT_EQ(costs[0].pixels, 200U);    // 200: two areas of 100 pixels
+    EXPECT_EQ(costs[1].view, &group);
+    EXPECT_EQ(costs[1].GetTotalUs(), 10U); // 10: OnDraw us
+    EXPECT_STREQ(costs[1].id, "");
+}
+
+/**
+ * @tc.name: RenderProfilerRecord002
+ * @tc.desc: Verify the report is published once the frames of a window are drawn.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderProfilerTest, RenderProfilerRecord002, TestSize.Level0)
+{
+    UIRenderProfiler* profiler = UIRenderProfiler::GetInstance();
+    profiler->SetFrameWindow(2); // 2: frames per window
+    UIView view;
+    Rect area(0, 0, 0, 0);
+    ViewRenderCost cost;
+
+    profiler->BeginFrame();
+    profiler->Record(&view, false, 0, 1, area);
+    profiler->BeginFrame();
+    profiler->Record(&view, false, 0, 1, area);
+    EXPECT_EQ(profiler->GetReport(&cost, 1), 0);
+
+    profiler->BeginFrame();
+    ASSERT_EQ(profiler->GetReport(&cost, 1), 1);
+    EXPECT_EQ(profiler->GetReportFrameNum(), 2); // 2: frames per window
+    EXPECT_EQ(cost.drawCount, 2U);                // 2: one call per frame
+}
+
+/**
+ * @tc.name: RenderProfilerOverdraw001
+ * @tc.desc: Verify the overdraw counts and the heatmap painted over the pixels drawn more than once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderProfilerTest, RenderProfilerOverdraw001, TestSize.Level0)
+{
+    UIRenderProfiler* profiler = UIRenderProfiler::GetInstance();
+    int16_t width = Screen::GetInstance().GetWidth();
+    int16_t height = Screen::GetInstance().GetHeight();
+    ASSERT_TRUE(profiler->SetOverdrawState(true));
+    if (BaseGfxEngine::GetInstance() == nullptr) {
+        static BaseGfxEngine gfxEngine;
+        BaseGfxEngine::InitGfxEngine(&gfxEngine);
+    }
+
+    Color32* pixels = new Color32[width * height];
+    ASSERT_NE(pixels, nullptr);
+    for (int32_t i = 0; i < width * height; i++) {
+        pixels[i].full = Color::ColorTo32(Color::White());
+    }
+    BufferInfo dst;
+    dst.rect = Rect(0, 0, width - 1, height - 1);
+    dst.mode = ARGB8888;
+    dst.color = 0;
+    dst.phyAddr = dst.virAddr = pixels;
+    dst.stride = width * sizeof(Color32);
+    dst.width = width;
+    dst.height = height;
+    BufferInfo other = dst;
+    other.virAddr = nullptr;
+
+    UIViewGroup background;
+    background.SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+    UIViewGroup container;
+    container.SetStyle(STYLE_BACKGROUND_OPA, OPA_TRANSPARENT);
+    container.SetStyle(STYLE_BORDER_WIDTH, 0);
+    UILabel label;
+    Rect rect(0, 0, 19, 19);  // 19: drawn area
+    profiler->BeginOverdraw(dst, rect);
+    profiler->AddOverdraw(&background, dst, rect);
+    profiler->AddOverdraw(&container, dst, rect);                    // draws nothing
+    profiler->AddOverdraw(&label, dst, Rect(10, 0, 19, 19));         // 10, 19: right half
+    profiler->AddOverdraw(&label, other, rect);                      // another buffer
+    EXPECT_EQ(profiler->GetOverdrawCount(0, 0), 1);
+    EXPECT_EQ(profiler->GetOverdrawCount(10, 0), 2); // 10: right half, 2: background and label
+    EXPECT_EQ(profiler->GetOverdrawCount(30, 0), 0); // 30: outside
+
+    profiler->EndOverdraw(dst, rect);
+    EXPECT_EQ(pixels[0].full, Color::ColorTo32(Color::White()));
+    EXPECT_NE(pixels[10].full, Color::ColorTo32(Color::White())); // 10: tinted
+
+    profiler->BeginOverdraw(dst, rect);
+    EXPECT_EQ(profiler->GetOverdrawCount(10, 0), 0); // 10: reset
+    delete[] pixels;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG && ENABLE_DEBUG_RENDER_PROFILER
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/point_event_injector.h"
+
+#if ENABLE_DEBUG
+#include <gtest/gtest.h>
+
+#include "common/graphic_startup.h"
+#include "common/screen.h"
+#include "components/root_view.h"
+#if ENABLE_WINDOW
+#include "window/window.h"
+#endif
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t VIEW_SIZE = 200;
+constexpr int16_t DRAG_STEP = 20;
+constexpr uint16_t TREE_GROUP_NUM = 10;
+constexpr uint16_t TREE_GROUP_CHILD_NUM = 99;
+constexpr uint16_t DRAG_EVENT_NUM = 1000;
+} // namespace
+
+class TestDragView : public UIView {
+public:
+    TestDragView()
+    {
+        SetPosition(0, 0, VIEW_SIZE, VIEW_SIZE);
+        SetTouchable(true);
+        SetDraggable(true);
+    }
+
+    bool OnClickEvent(const ClickEvent& event) override
+    {
+        clickCount_++;
+        return true;
+    }
+
+    bool OnDragStartEvent(const DragEvent& event) override
+    {
+        dragStartCount_++;
+        return true;
+    }
+
+    bool OnDragEvent(const DragEvent& event) override
+    {
+        dragCount_++;
+        lastDeltaX_ = event.GetDeltaX();
+        return true;
+    }
+
+    bool OnDragEndEvent(const DragEvent& event) override
+    {
+        dragEndCount_++;
+        return true;
+    }
+
+    uint16_t clickCount_ = 0;
+    uint16_t dragStartCount_ = 0;
+    uint16_t dragCount_ = 0;
+    uint16_t dragEndCount_ = 0;
+    int16_t lastDeltaX_ = 0;
+};
+
+class PointerInputDeviceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        GraphicStartUp::Init();
+        rootView_ = RootView::GetInstance();
+        rootView_->SetPosition(0, 0, Screen::GetInstance().GetWidth(), Screen::GetInstance().GetHeight());
+#if ENABLE_WINDOW
+        WindowConfig config = {};
+        config.rect.SetRect(0, 0, Screen::GetInstance().GetWidth() - 1, Screen::GetInstance().GetHeight() - 1);
+        window_ = Window::CreateWindow(config);
+        if (window_ != nullptr) {
+            window_->BindRootView(rootView_);
+        }
+#endif
+    }
+
+    static void TearDownTestCase(void)
+    {
+#if ENABLE_WINDOW
+        Window::DestoryWindow(window_);
+        window_ = nullptr;
+#endif
+    }
+
+    void SetUp() override
+    {
+        container_ = new UIViewGroup();
+        container_->SetPosition(0, 0, VIEW_SIZE * 2, VIEW_SIZE * 2); // 2: room for two views
+        rootView_->Add(container_);
+        device_ = new PointEventInjector();
+#if ENABLE_WINDOW
+        if (window_ != nullptr) {
+            device_->SetWindowId(window_->GetWindowId());
+        }
+#endif
+    }
+
+    void TearDown() override
+    {
+        delete device_;
+        device_ = nullptr;
+        rootView_->Remove(container_);
+        DeleteChildren(container_);
+        container_ = nullptr;
+    }
+
+    static void DeleteChildren(UIViewGroup* group)
+    {
+        UIView* child = group->GetChildrenHead();
+        while (child != nullptr) {
+            UIView* next = child->GetNextSibling();
+            group->Remove(child);
+            if (child->IsViewGroup()) {
+                DeleteChildren(static_cast<UIViewGroup*>(child));
+            } else {
+                delete child;
+            }
+            child = next;
+        }
+        delete group;
+    }
+
+    void Send(int16_t x, int16_t y, uint16_t state)
+    {
+        DeviceData data = {};
+        data.point = {x, y};
+        data.state = state;
+        device_->SetPointEvent(data);
+        device_->ProcessEvent();
+    }
+
+    /* presses in the middle of the view and drags it by one step, so it gets the drag start and one drag */
+    void StartDrag()
+    {
+        Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_PRESS);             // 2: middle
+        Send(VIEW_SIZE / 2 + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    }
+
+    static RootView* rootView_;
+#if ENABLE_WINDOW
+    static Window* window_;
+#endif
+    UIViewGroup* container_ = nullptr;
+    PointEventInjector* device_ = nullptr;
+};
+
+RootView* PointerInputDeviceTest::rootView_ = nullptr;
+#if ENABLE_WINDOW
+Window* PointerInputDeviceTest::window_ = nullptr;
+#endif
+
+/**
+ * @tc.name: PointerInputDeviceDrag_001
+ * @tc.desc: Verify a view removed in the middle of a drag gets no more drag events, also when it is deleted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PointerInputDeviceTest, PointerInputDeviceDrag_001, TestSize.Level0)
+{
+    TestDragView* view = new TestDragView();
+    container_->Add(view);
+    StartDrag();
+    EXPECT_EQ(view->dragStartCount_, 1);
+    EXPECT_EQ(view->dragCount_, 1);
+
+    container_->Remove(view);
+    Send(VIEW_SIZE, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    Send(VIEW_SIZE, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    EXPECT_EQ(view->dragCount_, 1);
+    EXPECT_EQ(view->dragEndCount_, 0);
+
+    /* a deleted view must not be touched. other is created first so that it cannot reuse the memory of view. */
+    TestDragView* other = new TestDragView();
+    other->SetPosition(VIEW_SIZE, 0);
+    container_->Add(view);
+    StartDrag();
+    EXPECT_EQ(view->dragStartCount_, 2); // 2: second drag
+    container_->Remove(view);
+    delete view;
+    container_->Add(other);
+    Send(VIEW_SIZE + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    Send(VIEW_SIZE + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    EXPECT_EQ(other->dragCount_, 0);
+    EXPECT_EQ(other->dragEndCount_, 0);
+}
+
+/**
+ * @tc.name: PointerInputDeviceDrag_002
+ * @tc.desc: Verify a view that is moved to another parent in the middle of a drag keeps getting drag events, and
+ *           a view whose ancestor is removed does not.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PointerInputDeviceTest, PointerInputDeviceDrag_002, TestSize.Level0)
+{
+    UIViewGroup* group = new UIViewGroup();
+    group->SetPosition(0, 0, VIEW_SIZE, VIEW_SIZE);
+    container_->Add(group);
+    TestDragView* view = new TestDragView();
+    group->Add(view);
+    StartDrag();
+    EXPECT_EQ(view->dragCount_, 1);
+
+    group->Remove(view);
+    container_->Add(view);
+    Send(VIEW_SIZE, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    EXPECT_EQ(view->dragCount_, 2);                           // 2: still dragged
+
+    container_->Remove(view);
+    group->Add(view);
+    container_->Remove(group);
+    Send(VIEW_SIZE + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    Send(VIEW_SIZE + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    EXPECT_EQ(view->dragCount_, 2); // 2: no drag after the ancestor is removed
+    EXPECT_EQ(view->dragEndCount_, 0);
+
+    container_->Add(group);
+}
+
+/**
+ * @tc.name: PointerInputDeviceCoalesce_001
+ * @tc.desc: Verify coalesced moves of a drag are dispatched as one drag event with the summed movement when flushed,
+ *           and a release flushes the pending move before the drag ends.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PointerInputDeviceTest, PointerInputDeviceCoalesce_001, TestSize.Level0)
+{
+    TestDragView* view = new TestDragView();
+    container_->Add(view);
+    device_->SetEventCoalesce(true);
+    StartDrag();
+    EXPECT_EQ(view->dragStartCount_, 1);
+    EXPECT_EQ(view->dragCount_, 1);
+
+    int16_t x = VIEW_SIZE / 2 + DRAG_STEP; // 2: middle
+    for (uint8_t i = 0; i < 3; i++) {       // 3: coalesced moves
+        x += DRAG_STEP;
+        Send(x, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    }
+    EXPECT_EQ(view->dragCount_, 1);
+    device_->FlushEvent();
+    EXPECT_EQ(view->dragCount_, 2);                // 2: one drag for all moves
+    EXPECT_EQ(view->lastDeltaX_, DRAG_STEP * 3); // 3: coalesced moves
+    device_->FlushEvent();
+    EXPECT_EQ(view->dragCount_, 2); // 2: nothing pending
+
+    Send(x + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_PRESS);   // 2: middle
+    Send(x + DRAG_STEP, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    EXPECT_EQ(view->dragCount_, 3);                                 // 3: pending move flushed by the release
+    EXPECT_EQ(view->lastDeltaX_, DRAG_STEP);
+    EXPECT_EQ(view->dragEndCount_, 1);
+}
+
+/**
+ * @tc.name: PointerInputDeviceCoalesce_002
+ * @tc.desc: Verify a tap still clicks when coalescing, and disabling coalescing flushes the pending move.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PointerInputDeviceTest, PointerInputDeviceCoalesce_002, TestSize.Level0)
+{
+    TestDragView* view = new TestDragView();
+    container_->Add(view);
+    device_->SetEventCoalesce(true);
+    EXPECT_EQ(device_->IsEventCoalesced(), true);
+    /* a release right after the press only sends the press, the next release clicks */
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_PRESS);   // 2: middle
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_RELEASE); // 2: middle
+    EXPECT_EQ(view->clickCount_, 1);
+
+    StartDrag();
+    Send(VIEW_SIZE / 2 + DRAG_STEP * 2, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle, second step
+    EXPECT_EQ(view->dragCount_, 1);
+    device_->SetEventCoalesce(false);
+    EXPECT_EQ(view->dragCount_, 2); // 2: pending move flushed
+    Send(VIEW_SIZE / 2 + DRAG_STEP * 3, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle, 3: third step
+    EXPECT_EQ(view->dragCount_, 3);                                               // 3: dispatched directly
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_RELEASE);               // 2: middle
+}
+
+/**
+ * @tc.name: PointerInputDeviceDragCost_001
+ * @tc.desc: Verify dragging with 1000 views in the tree searches the tree neither while it is unchanged nor after a
+ *           view is added, and searches it at most once per captured view after a view is destroyed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PointerInputDeviceTest, PointerInputDeviceDragCost_001, TestSize.Level1)
+{
+    /* the dragged view is added last, so a search visits every other view first */
+    UIViewGroup* group = nullptr;
+    for (uint16_t i = 0; i < TREE_GROUP_NUM; i++) {
+        group = new UIViewGroup();
+        group->SetPosition(VIEW_SIZE, VIEW_SIZE, 1, 1);
+        container_->Add(group);
+        for (uint16_t j = 0; j < TREE_GROUP_CHILD_NUM; j++) {
+            UIView* child = new UIView();
+            child->SetPosition(0, 0, 1, 1);
+            group->Add(child);
+        }
+    }
+    TestDragView* view = new TestDragView();
+    container_->Add(view);
+    StartDrag();
+
+    uint32_t searchCount = device_->GetTreeSearchCount();
+    for (uint16_t i = 0; i < DRAG_EVENT_NUM; i++) {
+        Send(VIEW_SIZE / 2 + (i & 1), VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle, 1: move one pixel
+    }
+    EXPECT_EQ(view->dragCount_, DRAG_EVENT_NUM + 1);
+    EXPECT_EQ(device_->GetTreeSearchCount(), searchCount);
+
+    /* an added view only makes the captured view check its parent chain */
+    UIView* added = new UIView();
+    group->Add(added);
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle
+    EXPECT_EQ(view->dragCount_, DRAG_EVENT_NUM + 2);              // 2: the first step and this move
+    EXPECT_EQ(device_->GetTreeSearchCount(), searchCount);
+
+    group->Remove(added);
+    delete added;
+    Send(VIEW_SIZE / 2 + 1, VIEW_SIZE / 2, InputDevice::STATE_PRESS); // 2: middle, 1: move one pixel
+    EXPECT_EQ(view->dragCount_, DRAG_EVENT_NUM + 3);                  // 3: the first step and the last two moves
+    EXPECT_LE(device_->GetTreeSearchCount(), searchCount + 2);        // 2: the touchable and the draggable view
+    Send(VIEW_SIZE / 2, VIEW_SIZE / 2, InputDevice::STATE_RELEASE);   // 2: middle
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
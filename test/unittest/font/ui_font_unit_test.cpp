@@ -15,12 +15,16 @@
 
 #include "font/ui_font.h"
 #if ENABLE_VECTOR_FONT
+#include "font/ui_font_coverage.h"
 #include "font/ui_font_vector.h"
 #else
 #include "font/ui_font_bitmap.h"
 #endif
 #include <climits>
+#include <cstring>
+#include <string>
 #include <gtest/gtest.h>
+#include "securec.h"
 
 using namespace testing::ext;
 namespace OHOS {
@@ -309,4 +313,245 @@ HWTEST_F(UIFontTest, Graphic_Font_Test_UnregisterFontInfo_002, TestSize.Level0)
     uint8_t ret = UIFont::GetInstance()->UnregisterFontInfo(fontsTable, 0);
     EXPECT_EQ(ret, 0);
 }
+
+#if ENABLE_VECTOR_FONT
+namespace {
+constexpr uint32_t FONT_CACHE_MEM_SIZE = 512 * 1024; // 512 * 1024: glyph cache of the test fonts
+constexpr uint8_t SIZE_NUM = 3;
+constexpr uint8_t FONT_SIZES[SIZE_NUM] = {16, 24, 32};
+const char* PARAGRAPH = "The quick brown fox jumps over the lazy dog while the five boxing wizards jump quickly. "
+                        "Pack my box with five dozen liquor jugs, then sphinx of black quartz, judge my vow.";
+
+/* returns nullptr when the default font is not installed */
+UIFontVector* NewVectorFont(uint8_t* cacheMem, uint8_t& fontId)
+{
+    UIFontVector* font = new UIFontVector();
+    font->SetPsramMemory(reinterpret_cast<uintptr_t>(cacheMem), FONT_CACHE_MEM_SIZE);
+    fontId = font->RegisterFontInfo(DEFAULT_VECTOR_FONT_FILENAME);
+    if (fontId == FONT_ERROR_RET) {
+        delete font;
+        return nullptr;
+    }
+    return font;
+}
+
+/* measures the paragraph with the size changing at every letter, returns its width */
+uint32_t MeasureParagraph(UIFontVector* font, uint8_t fontId, uint16_t loopNum)
+{
+    uint32_t width = 0;
+    for (uint16_t loop = 0; loop < loopNum; loop++) {
+        for (uint16_t i = 0; PARAGRAPH[i] != '\0'; i++) {
+            font->SetCurrentFontId(fontId, FONT_SIZES[i % SIZE_NUM]);
+            width += font->GetWidth(static_cast<uint8_t>(PARAGRAPH[i]), fontId);
+        }
+    }
+    return width;
+}
+} // namespace
+
+/**
+ * @tc.name: Graphic_Font_Test_SizeCache_001
+ * @tc.desc: Verify switching between kept size objects gives the same metrics as scaling the face for each size,
+ *           and that the number of kept size objects is bounded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_SizeCache_001, TestSize.Level1)
+{
+    uint8_t* cacheMem = new uint8_t[FONT_CACHE_MEM_SIZE];
+    uint8_t fontId = 0;
+    UIFontVector* font = NewVectorFont(cacheMem, fontId);
+    if (font == nullptr) {
+        delete[] cacheMem;
+        return;
+    }
+    EXPECT_EQ(font->GetSizeCacheNum(), UIFontVector::SIZE_CACHE_MAX_NUM);
+    font->SetSizeCacheNum(0);
+    uint16_t heights[SIZE_NUM];
+    for (uint8_t i = 0; i < SIZE_NUM; i++) {
+        EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[i]), 0);
+        heights[i] = font->GetHeight();
+    }
+    EXPECT_EQ(font->GetSizeCacheCount(), 0);
+
+    font->SetSizeCacheNum(UIFontVector::SIZE_CACHE_MAX_NUM);
+    for (uint8_t loop = 0; loop < 2; loop++) { // 2: switch back to sizes that are already kept
+        for (uint8_t i = 0; i < SIZE_NUM; i++) {
+            EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[i]), 0);
+            EXPECT_EQ(font->GetHeight(), heights[i]);
+        }
+    }
+    EXPECT_EQ(font->GetSizeCacheCount(), SIZE_NUM);
+
+    /* with fewer entries than sizes in use every switch replaces the least recently used one */
+    font->SetSizeCacheNum(SIZE_NUM - 1);
+    EXPECT_EQ(font->GetHeight(), heights[SIZE_NUM - 1]);
+    for (uint8_t i = 0; i < SIZE_NUM; i++) {
+        EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[i]), 0);
+        EXPECT_EQ(font->GetHeight(), heights[i]);
+    }
+    EXPECT_EQ(font->GetSizeCacheCount(), SIZE_NUM - 1);
+
+    font->SetSizeCacheNum(UINT8_MAX);
+    EXPECT_EQ(font->GetSizeCacheNum(), UIFontVector::SIZE_CACHE_MAX_NUM);
+    delete font;
+    delete[] cacheMem;
+}
+
+/**
+ * @tc.name: Graphic_Font_Test_SizeCacheCost_001
+ * @tc.desc: Verify a paragraph whose font size alternates between three sizes at every letter scales the face at
+ *           each switch without kept size objects, and at most once per size with them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_SizeCacheCost_001, TestSize.Level1)
+{
+    const uint16_t loopNum = 2;
+    uint8_t* cacheMem = new uint8_t[FONT_CACHE_MEM_SIZE];
+    uint8_t fontId = 0;
+    UIFontVector* font = NewVectorFont(cacheMem, fontId);
+    if (font == nullptr) {
+        delete[] cacheMem;
+        return;
+    }
+    uint32_t letterNum = static_cast<uint32_t>(strlen(PARAGRAPH));
+    font->SetSizeCacheNum(0);
+    uint32_t scaleCount = font->GetSizeScaleCount();
+    uint32_t scaledWidth = MeasureParagraph(font, fontId, loopNum);
+    EXPECT_GE(font->GetSizeScaleCount() - scaleCount, letterNum * loopNum);
+
+    font->SetSizeCacheNum(UIFontVector::SIZE_CACHE_MAX_NUM);
+    scaleCount = font->GetSizeScaleCount();
+    uint32_t cachedWidth = MeasureParagraph(font, fontId, loopNum);
+    EXPECT_LE(font->GetSizeScaleCount() - scaleCount, SIZE_NUM);
+    EXPECT_EQ(scaledWidth, cachedWidth);
+    delete font;
+    delete[] cacheMem;
+}
+
+/**
+ * @tc.name: Graphic_Font_Test_Coverage_001
+ * @tc.desc: Verify the coverage map of a face has exactly the code points the face has glyphs for.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_Coverage_001, TestSize.Level1)
+{
+    const uint32_t checkEnd = 0x20000; // 0x20000: the multilingual and the supplementary multilingual planes
+    FT_Library library = nullptr;
+    ASSERT_EQ(FT_Init_FreeType(&library), 0);
+    std::string path = VECTOR_FONT_DIR;
+    path.append(DEFAULT_VECTOR_FONT_FILENAME);
+    FT_Face face = nullptr;
+    if (FT_New_Face(library, path.c_str(), 0, &face) != 0) {
+        /* the default font is not installed */
+        FT_Done_FreeType(library);
+        return;
+    }
+    UIFontCoverage coverage;
+    EXPECT_EQ(coverage.Has('A'), false);
+    EXPECT_EQ(coverage.Build(face), true);
+    EXPECT_EQ(coverage.IsBuilt(), true);
+    uint32_t mismatchNum = 0;
+    for (uint32_t unicode = 0; unicode < checkEnd; unicode++) {
+        if (coverage.Has(unicode) != (FT_Get_Char_Index(face, unicode) != 0)) {
+            mismatchNum++;
+        }
+    }
+    EXPECT_EQ(mismatchNum, 0);
+    EXPECT_EQ(coverage.Has(UIFontCoverage::UNICODE_MAX + 1), false);
+    EXPECT_GT(coverage.GetSize(), 0u);
+    coverage.Clear();
+    EXPECT_EQ(coverage.IsBuilt(), false);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+}
+
+/**
+ * @tc.name: Graphic_Font_Test_Coverage_002
+ * @tc.desc: Verify the coverage map of a face is only built when a glyph is searched in it, and that the glyphs
+ *           found through it are the same for repeated lookups.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_Coverage_002, TestSize.Level1)
+{
+    uint8_t* cacheMem = new uint8_t[FONT_CACHE_MEM_SIZE];
+    uint8_t fontId = 0;
+    UIFontVector* font = NewVectorFont(cacheMem, fontId);
+    if (font == nullptr) {
+        delete[] cacheMem;
+        return;
+    }
+    uint32_t emptySize = font->GetCoverageSize();
+    EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[0]), 0);
+    EXPECT_EQ(font->GetCoverageSize(), emptySize);
+    GlyphNode node = {};
+    EXPECT_NE(font->GetBitmap('A', node, fontId), nullptr);
+    EXPECT_GT(font->GetCoverageSize(), emptySize);
+    /* the second glyph of the same code point comes from the fallback cache */
+    uint16_t advance = node.advance;
+    EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[1]), 0);
+    EXPECT_NE(font->GetBitmap('A', node, fontId), nullptr);
+    EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[0]), 0);
+    EXPECT_NE(font->GetBitmap('A', node, fontId), nullptr);
+    EXPECT_EQ(node.advance, advance);
+
+    font->UnregisterFontInfo(DEFAULT_VECTOR_FONT_FILENAME);
+    EXPECT_EQ(font->GetCoverageSize(), emptySize);
+    delete font;
+    delete[] cacheMem;
+}
+
+/**
+ * @tc.name: Graphic_Font_Test_RotatedBitmap_001
+ * @tc.desc: Verify a glyph rendered at 90 degrees around the top of the line is the upright glyph turned clockwise,
+ *           moved to the rotated pixels around the pivot.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_RotatedBitmap_001, TestSize.Level1)
+{
+    uint8_t* cacheMem = new uint8_t[FONT_CACHE_MEM_SIZE];
+    uint8_t fontId = 0;
+    UIFontVector* font = NewVectorFont(cacheMem, fontId);
+    if (font == nullptr) {
+        delete[] cacheMem;
+        return;
+    }
+    EXPECT_EQ(font->SetCurrentFontId(fontId, FONT_SIZES[1]), 0);
+    FontHeader head;
+    ASSERT_EQ(font->GetCurrentFontHeader(head), 0);
+    /* 'F' is neither mirror nor turn symmetric */
+    GlyphNode upright = {};
+    upright.textStyle = TEXT_STYLE_NORMAL;
+    uint8_t* map = font->GetBitmap('F', upright, fontId);
+    ASSERT_NE(map, nullptr);
+    uint32_t size = static_cast<uint32_t>(upright.cols) * upright.rows;
+    ASSERT_GT(size, 0u);
+    uint8_t* expect = new uint8_t[size];
+    (void)memcpy_s(expect, size, map, size);
+
+    GlyphNode turned = {};
+    uint8_t* result = font->GetRotatedBitmap('F', QUARTER_IN_DEGREE, head.ascender, turned);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(turned.cols, upright.rows);
+    EXPECT_EQ(turned.rows, upright.cols);
+    /*
+     * From the pivot, the upright glyph starts at (left, ascender - top) on the screen, and clockwise (x, y) goes to
+     * (-y, x), so the turned glyph starts at (top - ascender - rows, left).
+     */
+    EXPECT_EQ(turned.left, upright.top - head.ascender - upright.rows);
+    EXPECT_EQ(turned.top, head.ascender - upright.left);
+    if ((turned.cols == upright.rows) && (turned.rows == upright.cols)) {
+        for (uint16_t row = 0; row < upright.rows; row++) {
+            for (uint16_t col = 0; col < upright.cols; col++) {
+                uint8_t coverage = result[col * turned.cols + upright.rows - 1 - row];
+                /* 2: the outline is rasterized along the other axis */
+                EXPECT_NEAR(coverage, expect[row * upright.cols + col], 2);
+            }
+        }
+    }
+    delete[] result;
+    delete[] expect;
+    delete font;
+    delete[] cacheMem;
+}
+#endif // ENABLE_VECTOR_FONT
 } // namespace OHOS
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/clip_utils.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "draw/draw_utils.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/diagram/depiction/depict_curve.h"
+#include "gfx_utils/graphic_math.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t IMAGE_SIZE = 454;
+constexpr float CIRCLE_RADIUS = 200.0f;
+
+Color32* NewImage(int16_t width, int16_t height)
+{
+    Color32* pixels = new Color32[width * height];
+    for (int32_t i = 0; i < width * height; i++) {
+        pixels[i].red = static_cast<uint8_t>(i);
+        pixels[i].green = static_cast<uint8_t>(i >> 8); // 8: second byte
+        pixels[i].blue = 0x80;                          // 0x80: any color
+        pixels[i].alpha = OPA_OPAQUE;
+    }
+    return pixels;
+}
+
+ImageInfo GetImageInfo(const Color32* pixels, int16_t width, int16_t height)
+{
+    ImageInfo info = {};
+    info.header.colorMode = ARGB8888;
+    info.header.width = width;
+    info.header.height = height;
+    info.dataSize = width * height * sizeof(Color32);
+    info.data = reinterpret_cast<const uint8_t*>(pixels);
+    return info;
+}
+
+void CircleAt(ClipPath& path, int16_t size)
+{
+    path.Circle({size / 2.0f, size / 2.0f}, CIRCLE_RADIUS); // 2.0: center of the image
+}
+
+/* the per-pixel clipping ClipUtils::PerformScan did before ClipMask, kept to compare with */
+void LegacyDrawPixel(int16_t x, int16_t y, uint8_t opa, const ImageInfo* imageInfo)
+{
+    if (x < 0 || x > imageInfo->header.width - 1 || y < 0 || y > imageInfo->header.height - 1) {
+        return;
+    }
+    Color32* buffer = reinterpret_cast<Color32*>(const_cast<uint8_t*>(imageInfo->data));
+    int32_t offset = imageInfo->header.width * y + x;
+    buffer[offset].alpha = buffer[offset].alpha * opa / OPA_OPAQUE;
+}
+
+void LegacyDrawHorLine(int16_t x, int16_t y, int16_t len, uint8_t opa, const ImageInfo* imageInfo)
+{
+    for (int32_t i = x; i <= x + len; i++) {
+        LegacyDrawPixel(i, y, opa, imageInfo);
+    }
+}
+
+void LegacyPerformScan(const ClipPath& path, const ImageInfo* imageInfo)
+{
+    RasterizerScanlineAntialias rasterizer;
+    GeometryScanline scanline;
+    TransAffine transform;
+    DepictCurve canvasPath(path.CloseVertices());
+    DepictTransform<DepictCurve> pathTransform(canvasPath, transform);
+    rasterizer.Reset();
+    rasterizer.AddPath(pathTransform);
+    if (!rasterizer.RewindScanlines()) {
+        for (int32_t i = 0; i < imageInfo->header.height; i++) {
+            LegacyDrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
+        }
+        return;
+    }
+    scanline.Reset(rasterizer.GetMinX(), rasterizer.GetMaxX());
+    bool first = true;
+    int16_t y = 0;
+    while (rasterizer.SweepScanline(scanline)) {
+        y = scanline.GetYLevel();
+        if (first) {
+            for (int32_t i = 0; i < y; i++) {
+                LegacyDrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
+            }
+            first = false;
+        }
+        uint32_t numSpans = scanline.NumSpans();
+        GeometryScanline::ConstIterator span = scanline.Begin();
+        int16_t index = 0;
+        while (true) {
+            int32_t x = span->x;
+            int32_t len = span->spanLength;
+            const uint8_t* covers = span->covers;
+            if (len < 0) {
+                len = -len;
+            }
+            LegacyDrawHorLine(index, y, x - index - 1, OPA_TRANSPARENT, imageInfo);
+            for (int16_t i = x; i < x + len; i++, covers++) {
+                LegacyDrawPixel(i, y, *covers, imageInfo);
+            }
+            index = x + len;
+            if (--numSpans == 0) {
+                break;
+            }
+            ++span;
+        }
+        LegacyDrawHorLine(index, y, imageInfo->header.width - index, OPA_TRANSPARENT, imageInfo);
+    }
+    for (int32_t i = y + 1; i < imageInfo->header.height; i++) {
+        LegacyDrawHorLine(0, i, imageInfo->header.width, OPA_TRANSPARENT, imageInfo);
+    }
+}
+} // namespace
+
+class ClipUtilsTest : public testing::Test {
+public:
+    ClipUtilsTest() {}
+    virtual ~ClipUtilsTest() {}
+
+    static void SetUpTestCase()
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            BaseGfxEngine::InitGfxEngine();
+        }
+    }
+
+    void SetUp() override
+    {
+        dstPixels_ = new Color32[IMAGE_SIZE * IMAGE_SIZE];
+        dstBuffer_.rect = Rect(0, 0, IMAGE_SIZE - 1, IMAGE_SIZE - 1);
+        dstBuffer_.mode = ARGB8888;
+        dstBuffer_.color = 0;
+        dstBuffer_.phyAddr = dstBuffer_.virAddr = dstPixels_;
+        dstBuffer_.stride = IMAGE_SIZE * sizeof(Color32);
+        dstBuffer_.width = IMAGE_SIZE;
+        dstBuffer_.height = IMAGE_SIZE;
+        ClearDst();
+    }
+
+    void TearDown() override
+    {
+        delete[] dstPixels_;
+        dstPixels_ = nullptr;
+    }
+
+    void ClearDst()
+    {
+        (void)memset(dstPixels_, 0, IMAGE_SIZE * IMAGE_SIZE * sizeof(Color32));
+    }
+
+    BufferInfo dstBuffer_;
+    Color32* dstPixels_ = nullptr;
+};
+
+/**
+ * @tc.name: ClipMaskBuild_001
+ * @tc.desc: Verify the spans of a circle: the center row is one opaque run, the rows outside are empty and the
+ *           border has partial coverage.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClipUtilsTest, ClipMaskBuild_001, TestSize.Level0)
+{
+    ClipPath path;
+    CircleAt(path, IMAGE_SIZE);
+    ClipMask mask;
+    EXPECT_EQ(mask.Build(path, IMAGE_SIZE, IMAGE_SIZE), true);
+    EXPECT_EQ(mask.GetWidth(), IMAGE_SIZE);
+    EXPECT_EQ(mask.GetHeight(), IMAGE_SIZE);
+    EXPECT_GT(mask.GetSize(), 0u);
+
+    uint32_t spanNum;
+    EXPECT_EQ(mask.GetRowSpans(0, spanNum), nullptr);
+    EXPECT_EQ(spanNum, 0u);
+    EXPECT_EQ(mask.GetRowSpans(-1, spanNum), nullptr);
+    EXPECT_EQ(mask.GetRowSpans(IMAGE_SIZE, spanNum), nullptr);
+
+    const ClipMask::Span* span = mask.GetRowSpans(IMAGE_SIZE / 2, spanNum); // 2: center row
+    ASSERT_NE(span, nullptr);
+    int16_t left = span[0].x;
+    int16_t right = span[spanNum - 1].x + span[spanNum - 1].length;
+    EXPECT_LE(left, IMAGE_SIZE / 2 - CIRCLE_RADIUS + 1);  // 2: center, 1: antialiased pixel
+    EXPECT_GE(right, IMAGE_SIZE / 2 + CIRCLE_RADIUS - 1); // 2: center, 1: antialiased pixel
+    bool hasOpaque = false;
+    int16_t lastEnd = 0;
+    for (uint32_t i = 0; i < spanNum; i++) {
+        EXPECT_GE(span[i].x, lastEnd);
+        lastEnd = span[i].x + span[i].length;
+        if ((span[i].covers == nullptr) && (span[i].cover == OPA_OPAQUE)) {
+            hasOpaque = true;
+        }
+    }
+    EXPECT_EQ(hasOpaque, true);
+
+    mask.Clear();
+    EXPECT_EQ(mask.GetSize(), 0u);
+    EXPECT_EQ(mask.GetRowSpans(IMAGE_SIZE / 2, spanNum), nullptr); // 2: center row
+    EXPECT_EQ(mask.Build(path, 0, IMAGE_SIZE), false);
+}
+
+/**
+ * @tc.name: ClipMaskApply_001
+ * @tc.desc: Verify clipping an image in place gives the same pixels as the former per-pixel clipping.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClipUtilsTest, ClipMaskApply_001, TestSize.Level0)
+{
+    Color32* expect = NewImage(IMAGE_SIZE, IMAGE_SIZE);
+    Color32* result = NewImage(IMAGE_SIZE, IMAGE_SIZE);
+    ImageInfo expectInfo = GetImageInfo(expect, IMAGE_SIZE, IMAGE_SIZE);
+    ImageInfo resultInfo = GetImageInfo(result, IMAGE_SIZE, IMAGE_SIZE);
+    ClipPath path;
+    CircleAt(path, IMAGE_SIZE);
+    LegacyPerformScan(path, &expectInfo);
+    ClipUtils clip;
+    clip.PerformScan(path, &resultInfo);
+
+    EXPECT_EQ(memcmp(expect, result, IMAGE_SIZE * IMAGE_SIZE * sizeof(Color32)), 0);
+    EXPECT_EQ(result[0].alpha, OPA_TRANSPARENT);
+    EXPECT_EQ(result[IMAGE_SIZE / 2 * IMAGE_SIZE + IMAGE_SIZE / 2].alpha, OPA_OPAQUE); // 2: center pixel
+    delete[] expect;
+    delete[] result;
+}
+
+/**
+ * @tc.name: ClipMaskDraw_001
+ * @tc.desc: Verify drawing an image through a clip mask looks like drawing the clipped image, and the image
+ *           itself is left untouched.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClipUtilsTest, ClipMaskDraw_001, TestSize.Level0)
+{
+    const Point offset = {10, 20};
+    Rect area(offset.x, offset.y, offset.x + IMAGE_SIZE - 1, offset.y + IMAGE_SIZE - 1);
+    Color32* image = NewImage(IMAGE_SIZE, IMAGE_SIZE);
+    Color32* clipped = NewImage(IMAGE_SIZE, IMAGE_SIZE);
+    Color32* source = NewImage(IMAGE_SIZE, IMAGE_SIZE);
+    ImageInfo clippedInfo = GetImageInfo(clipped, IMAGE_SIZE, IMAGE_SIZE);
+    ClipPath path;
+    CircleAt(path, IMAGE_SIZE);
+    ClipMask mask;
+    ASSERT_EQ(mask.Build(path, IMAGE_SIZE, IMAGE_SIZE), true);
+    mask.Apply(&clippedInfo);
+
+    const uint8_t pxBitSize = 32; // 32: bits of ARGB8888
+    DrawUtils::GetInstance()->DrawImage(dstBuffer_, area, dstBuffer_.rect, clippedInfo.data, OPA_OPAQUE, pxBitSize,
+                                        ARGB8888);
+    Color32* expect = new Color32[IMAGE_SIZE * IMAGE_SIZE];
+    (void)memcpy(expect, dstPixels_, IMAGE_SIZE * IMAGE_SIZE * sizeof(Color32));
+    ClearDst();
+    DrawUtils::GetInstance()->DrawImage(dstBuffer_, area, dstBuffer_.rect, reinterpret_cast<uint8_t*>(image),
+                                        OPA_OPAQUE, pxBitSize, ARGB8888, &mask);
+
+    for (int32_t i = 0; i < IMAGE_SIZE * IMAGE_SIZE; i++) {
+        EXPECT_NEAR(dstPixels_[i].alpha, expect[i].alpha, 1) << "pixel " << i;
+        EXPECT_NEAR(dstPixels_[i].red, expect[i].red, 1) << "pixel " << i;
+    }
+    EXPECT_EQ(memcmp(image, source, IMAGE_SIZE * IMAGE_SIZE * sizeof(Color32)), 0);
+    delete[] expect;
+    delete[] source;
+    delete[] clipped;
+    delete[] image;
+}
+
+/**
+ * @tc.name: ClipMaskCost_001
+ * @tc.desc: Verify a circle mask keeps per-pixel coverage only along the border: the mask is smaller than an alpha
+ *           map of the image, and the pixels blended one by one are a small part of the pixels blended as runs.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ClipUtilsTest, ClipMaskCost_001, TestSize.Level1)
+{
+    ClipPath path;
+    CircleAt(path, IMAGE_SIZE);
+    ClipMask mask;
+    ASSERT_EQ(mask.Build(path, IMAGE_SIZE, IMAGE_SIZE), true);
+    EXPECT_LT(mask.GetSize(), static_cast<uint32_t>(IMAGE_SIZE * IMAGE_SIZE / 2)); // 2: half of an alpha map
+
+    uint32_t solidPixels = 0;
+    uint32_t coverPixels = 0;
+    uint32_t coverRuns = 0;
+    for (int16_t y = 0; y < IMAGE_SIZE; y++) {
+        uint32_t spanNum;
+        const ClipMask::Span* span = mask.GetRowSpans(y, spanNum);
+        for (uint32_t i = 0; i < spanNum; i++) {
+            if (span[i].covers == nullptr) {
+                solidPixels += span[i].length;
+            } else {
+                coverPixels += span[i].length;
+                coverRuns++;
+            }
+        }
+    }
+    /* the border pixels lie along the circumference, each run of them is blended in one pass */
+    const float perimeter = 2 * UI_PI * CIRCLE_RADIUS; // 2: diameter
+    EXPECT_GT(coverRuns, 0u);
+    EXPECT_GE(coverPixels, coverRuns);
+    EXPECT_LT(coverPixels, perimeter * 4); // 4: margin for the pixels the border crosses diagonally
+    EXPECT_GT(solidPixels, coverPixels * 16); // 16: the inside of the circle is far larger than its border
+}
+} // namespace OHOS
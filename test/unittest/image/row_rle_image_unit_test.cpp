@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/row_rle_image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "draw/draw_image.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/mem_api.h"
+#include "imgdecode/image_load.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t IMAGE_WIDTH = 300;
+constexpr int16_t IMAGE_HEIGHT = 100;
+constexpr int16_t BUFFER_SIZE = 320;
+const char* RLE_PATH = "/storage/row_rle_image_test.bin";
+
+/* a flat background with a gradient band and a noisy band, in ARGB8888 or RGB888 */
+uint8_t* NewImage(uint8_t colorMode)
+{
+    uint8_t byteSize = RowRleImage::GetByteSize(colorMode);
+    uint8_t* pixels = new uint8_t[IMAGE_WIDTH * IMAGE_HEIGHT * byteSize];
+    for (int16_t y = 0; y < IMAGE_HEIGHT; y++) {
+        for (int16_t x = 0; x < IMAGE_WIDTH; x++) {
+            uint8_t* pixel = pixels + (y * IMAGE_WIDTH + x) * byteSize;
+            pixel[0] = 0x40; // 0x40: background blue
+            pixel[1] = 0x80; // 0x80: background green
+            pixel[2] = 0xC0; // 0xC0: background red
+            if ((y >= 20) && (y < 40)) { // 20, 40: gradient band
+                pixel[0] = static_cast<uint8_t>(x);
+            } else if ((y >= 60) && (y < 70) && (x >= 100) && (x < 200)) { // 60, 70, 100, 200: noisy band
+                pixel[1] = static_cast<uint8_t>((x * 7 + y * 13) % 5); // 7, 13, 5: repeats now and then
+            }
+            if (byteSize == 4) { // 4: ARGB8888
+                pixel[3] = OPA_OPAQUE; // 3: alpha
+            }
+        }
+    }
+    return pixels;
+}
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels)
+{
+    buffer.rect = Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = BUFFER_SIZE * sizeof(Color32);
+    buffer.width = BUFFER_SIZE;
+    buffer.height = BUFFER_SIZE;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        pixels[i].full = Color::ColorTo32(Color::White());
+    }
+}
+
+bool IsSameDraw(const uint8_t* pixels, const ImageInfo& rleInfo, const Rect& coords, const Rect& mask)
+{
+    Color32* expectPixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* rlePixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo expect;
+    BufferInfo dst;
+    InitBuffer(expect, expectPixels);
+    InitBuffer(dst, rlePixels);
+    uint8_t colorMode = rleInfo.header.colorMode;
+    DrawUtils::GetInstance()->DrawImage(expect, coords, mask, pixels, OPA_OPAQUE,
+                                        DrawUtils::GetPxSizeByColorMode(colorMode),
+                                        static_cast<ColorMode>(colorMode));
+    DrawImage::DrawRowRle(dst, coords, mask, rleInfo, OPA_OPAQUE);
+    bool same = (memcmp(expectPixels, rlePixels, BUFFER_SIZE * BUFFER_SIZE * sizeof(Color32)) == 0);
+    delete[] expectPixels;
+    delete[] rlePixels;
+    return same;
+}
+} // namespace
+
+class RowRleImageTest : public testing::Test {
+public:
+    RowRleImageTest() {}
+    virtual ~RowRleImageTest() {}
+
+    static void SetUpTestCase()
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            BaseGfxEngine::InitGfxEngine();
+        }
+    }
+};
+
+/**
+ * @tc.name: RowRleImageEncode_001
+ * @tc.desc: Verify the rows decode to the pixels they were encoded from, and a broken row table is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RowRleImageTest, RowRleImageEncode_001, TestSize.Level1)
+{
+    uint8_t* pixels = NewImage(ARGB8888);
+    uint32_t rawSize = IMAGE_WIDTH * IMAGE_HEIGHT * sizeof(Color32);
+    uint32_t size = RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, ARGB8888, nullptr, 0);
+    ASSERT_GT(size, 0U);
+    EXPECT_LT(size, rawSize / 4); // 4: a mostly flat image shrinks a lot
+    uint8_t* data = new uint8_t[size];
+    EXPECT_EQ(RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, ARGB8888, data, size - 1), 0U);
+    ASSERT_EQ(RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, ARGB8888, data, size), size);
+
+    ImageInfo info = {};
+    info.header.colorMode = ARGB8888;
+    info.header.width = IMAGE_WIDTH;
+    info.header.height = IMAGE_HEIGHT;
+    info.header.compressMode = COMPRESS_MODE_ROW_RLE_ALG;
+    info.dataSize = size;
+    info.data = data;
+    ASSERT_TRUE(RowRleImage::Check(info));
+    Color32 row[IMAGE_WIDTH];
+    for (int16_t y = 0; y < IMAGE_HEIGHT; y++) {
+        ASSERT_TRUE(RowRleImage::DecodeRow(info, y, 50, 200, reinterpret_cast<uint8_t*>(row))); // 50, 200: part
+        EXPECT_EQ(memcmp(row, pixels + (y * IMAGE_WIDTH + 50) * sizeof(Color32), 200 * sizeof(Color32)), 0);
+    }
+
+    reinterpret_cast<uint32_t*>(data)[1] = size + 1; // 1: second row beyond the data
+    EXPECT_FALSE(RowRleImage::Check(info));
+    delete[] data;
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: RowRleImageDraw_001
+ * @tc.desc: Verify drawing from the compressed rows gives the pixels of the decompressed image, whole and clipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RowRleImageTest, RowRleImageDraw_001, TestSize.Level1)
+{
+    const uint8_t colorModes[] = {ARGB8888, RGB888};
+    for (uint8_t colorMode : colorModes) {
+        uint8_t* pixels = NewImage(colorMode);
+        uint32_t size = RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, colorMode, nullptr, 0);
+        uint8_t* data = new uint8_t[size];
+        ASSERT_EQ(RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, colorMode, data, size), size);
+        ImageInfo info = {};
+        info.header.colorMode = colorMode;
+        info.header.width = IMAGE_WIDTH;
+        info.header.height = IMAGE_HEIGHT;
+        info.header.compressMode = COMPRESS_MODE_ROW_RLE_ALG;
+        info.dataSize = size;
+        info.data = data;
+
+        Rect coords(10, 20, 10 + IMAGE_WIDTH - 1, 20 + IMAGE_HEIGHT - 1); // 10, 20: image position
+        EXPECT_TRUE(IsSameDraw(pixels, info, coords, Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1)));
+        EXPECT_TRUE(IsSameDraw(pixels, info, coords, Rect(113, 35, 251, 87))); // 113, 35, 251, 87: dirty rect
+        EXPECT_TRUE(IsSameDraw(pixels, info, coords, Rect(0, 0, 14, 22)));     // 14, 22: corner only
+        delete[] data;
+        delete[] pixels;
+    }
+}
+
+/**
+ * @tc.name: RowRleImageLoad_001
+ * @tc.desc: Verify a row-indexed file is kept compressed in the image cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RowRleImageTest, RowRleImageLoad_001, TestSize.Level1)
+{
+    uint8_t* pixels = NewImage(RGB888);
+    uint32_t size = RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, RGB888, nullptr, 0);
+    uint8_t* data = new uint8_t[size];
+    ASSERT_EQ(RowRleImage::Encode(pixels, IMAGE_WIDTH, IMAGE_HEIGHT, RGB888, data, size), size);
+    FILE* file = fopen(RLE_PATH, "wb");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(fwrite(data, 1, size, file), size);
+    fclose(file);
+
+    int32_t fd = open(RLE_PATH, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    ImageInfo info = {};
+    info.header.colorMode = RGB888;
+    info.header.width = IMAGE_WIDTH;
+    info.header.height = IMAGE_HEIGHT;
+    info.header.compressMode = COMPRESS_MODE_ROW_RLE_ALG;
+    ASSERT_TRUE(ImageLoad::GetImageInfo(fd, size, info));
+    close(fd);
+    EXPECT_EQ(info.dataSize, size);
+    EXPECT_EQ(memcmp(info.data, data, size), 0);
+    Rect coords(0, 0, IMAGE_WIDTH - 1, IMAGE_HEIGHT - 1);
+    EXPECT_TRUE(IsSameDraw(pixels, info, coords, coords));
+    ImageCacheFree(info);
+    remove(RLE_PATH);
+    delete[] data;
+    delete[] pixels;
+}
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #include "layout/flex_layout.h"
 
 #include <climits>
+#include <cstdlib>
 #include <gtest/gtest.h>
 
 using namespace testing::ext;
@@ -31,6 +32,260 @@ UIView* CreatView()
     EXPECT_EQ(view->GetY(), 0);
     return view;
 }
+
+constexpr uint16_t RANDOM_ROUND = 200;
+constexpr uint16_t RANDOM_STEP = 10;
+constexpr uint16_t RANDOM_MAX_CHILD = 24;
+constexpr int16_t RANDOM_MAX_SIZE = 150;
+constexpr int16_t RANDOM_MAX_MARGIN = 20;
+
+constexpr int16_t GOLDEN_WIDTH = 300;
+constexpr int16_t GOLDEN_HEIGHT = 200;
+constexpr uint8_t GOLDEN_CHILD_NUM = 5;
+constexpr uint8_t GOLDEN_DIRECTION_NUM = LAYOUT_VER_R + 1;
+constexpr uint8_t GOLDEN_MAJOR_NUM = ALIGN_BETWEEN + 1;
+constexpr uint8_t GOLDEN_SECONDARY_NUM = ALIGN_CENTER + 1;
+constexpr uint8_t GOLDEN_WRAP_NUM = FlexLayout::WRAP + 1;
+constexpr int16_t GOLDEN_SIZE[GOLDEN_CHILD_NUM][2] = {{100, 60}, {80, 90}, {120, 40}, {60, 70}, {90, 50}};
+/* left, right, top and bottom margins */
+constexpr int16_t GOLDEN_MARGIN[GOLDEN_CHILD_NUM][4] = {
+    {5, 10, 4, 6}, {0, 0, 0, 0}, {8, 0, 10, 0}, {0, 12, 0, 8}, {3, 3, 3, 3}
+};
+/*
+ * The children positions the FlexLayout placed before it cached child metrics, for every direction, major axis
+ * alignment, secondary axis alignment and wrap, in this order.
+ */
+constexpr int16_t GOLDEN_POS[GOLDEN_DIRECTION_NUM * GOLDEN_MAJOR_NUM * GOLDEN_SECONDARY_NUM * GOLDEN_WRAP_NUM]
+                            [GOLDEN_CHILD_NUM][2] = {
+    /* LAYOUT_HOR, ALIGN_START; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 0}, {115, 0}, {195, 0}, {323, 0}, {395, 0}},
+    {{0, 0}, {115, 0}, {0, 90}, {128, 90}, {200, 90}},
+    {{0, 130}, {115, 110}, {195, 150}, {323, 122}, {395, 144}},
+    {{0, 52}, {115, 32}, {0, 150}, {128, 122}, {200, 144}},
+    {{0, 65}, {115, 55}, {195, 75}, {323, 61}, {395, 72}},
+    {{0, 26}, {115, 16}, {0, 120}, {128, 106}, {200, 117}},
+    /* LAYOUT_HOR, ALIGN_END; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{-191, 0}, {-76, 0}, {4, 0}, {132, 0}, {204, 0}},
+    {{105, 0}, {220, 0}, {4, 90}, {132, 90}, {204, 90}},
+    {{-191, 130}, {-76, 110}, {4, 150}, {132, 122}, {204, 144}},
+    {{105, 52}, {220, 32}, {4, 150}, {132, 122}, {204, 144}},
+    {{-191, 65}, {-76, 55}, {4, 75}, {132, 61}, {204, 72}},
+    {{105, 26}, {220, 16}, {4, 120}, {132, 106}, {204, 117}},
+    /* LAYOUT_HOR, ALIGN_CENTER; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{-95, 0}, {20, 0}, {100, 0}, {228, 0}, {300, 0}},
+    {{52, 0}, {167, 0}, {2, 90}, {130, 90}, {202, 90}},
+    {{-95, 130}, {20, 110}, {100, 150}, {228, 122}, {300, 144}},
+    {{52, 52}, {167, 32}, {2, 150}, {130, 122}, {202, 144}},
+    {{-95, 65}, {20, 55}, {100, 75}, {228, 61}, {300, 72}},
+    {{52, 26}, {167, 16}, {2, 120}, {130, 106}, {202, 117}},
+    /* LAYOUT_HOR, ALIGN_EVENLY; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{-95, 0}, {20, 0}, {100, 0}, {228, 0}, {300, 0}},
+    {{35, 0}, {185, 0}, {1, 90}, {130, 90}, {203, 90}},
+    {{-95, 130}, {20, 110}, {100, 150}, {228, 122}, {300, 144}},
+    {{35, 52}, {185, 32}, {1, 150}, {130, 122}, {203, 144}},
+    {{-95, 65}, {20, 55}, {100, 75}, {228, 61}, {300, 72}},
+    {{35, 26}, {185, 16}, {1, 120}, {130, 106}, {203, 117}},
+    /* LAYOUT_HOR, ALIGN_AROUND; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{-95, 0}, {20, 0}, {100, 0}, {228, 0}, {300, 0}},
+    {{26, 0}, {193, 0}, {0, 90}, {129, 90}, {202, 90}},
+    {{-95, 130}, {20, 110}, {100, 150}, {228, 122}, {300, 144}},
+    {{26, 52}, {193, 32}, {0, 150}, {129, 122}, {202, 144}},
+    {{-95, 65}, {20, 55}, {100, 75}, {228, 61}, {300, 72}},
+    {{26, 26}, {193, 16}, {0, 120}, {129, 106}, {202, 117}},
+    /* LAYOUT_HOR, ALIGN_BETWEEN; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{-95, 0}, {20, 0}, {100, 0}, {228, 0}, {300, 0}},
+    {{0, 0}, {220, 0}, {0, 90}, {130, 90}, {204, 90}},
+    {{-95, 130}, {20, 110}, {100, 150}, {228, 122}, {300, 144}},
+    {{0, 52}, {220, 32}, {0, 150}, {130, 122}, {204, 144}},
+    {{-95, 65}, {20, 55}, {100, 75}, {228, 61}, {300, 72}},
+    {{0, 26}, {220, 16}, {0, 120}, {130, 106}, {204, 117}},
+    /* LAYOUT_HOR_R, ALIGN_START; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{185, 0}, {105, 0}, {-23, 0}, {-95, 0}, {-191, 0}},
+    {{185, 0}, {105, 0}, {172, 90}, {100, 90}, {4, 90}},
+    {{185, 130}, {105, 110}, {-23, 150}, {-95, 122}, {-191, 144}},
+    {{185, 52}, {105, 32}, {172, 150}, {100, 122}, {4, 144}},
+    {{185, 65}, {105, 55}, {-23, 75}, {-95, 61}, {-191, 72}},
+    {{185, 26}, {105, 16}, {172, 120}, {100, 106}, {4, 117}},
+    /* LAYOUT_HOR_R, ALIGN_END; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{376, 0}, {296, 0}, {168, 0}, {96, 0}, {0, 0}},
+    {{80, 0}, {0, 0}, {168, 90}, {96, 90}, {0, 90}},
+    {{376, 130}, {296, 110}, {168, 150}, {96, 122}, {0, 144}},
+    {{80, 52}, {0, 32}, {168, 150}, {96, 122}, {0, 144}},
+    {{376, 65}, {296, 55}, {168, 75}, {96, 61}, {0, 72}},
+    {{80, 26}, {0, 16}, {168, 120}, {96, 106}, {0, 117}},
+    /* LAYOUT_HOR_R, ALIGN_CENTER; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{280, 0}, {200, 0}, {72, 0}, {0, 0}, {-96, 0}},
+    {{133, 0}, {53, 0}, {170, 90}, {98, 90}, {2, 90}},
+    {{280, 130}, {200, 110}, {72, 150}, {0, 122}, {-96, 144}},
+    {{133, 52}, {53, 32}, {170, 150}, {98, 122}, {2, 144}},
+    {{280, 65}, {200, 55}, {72, 75}, {0, 61}, {-96, 72}},
+    {{133, 26}, {53, 16}, {170, 120}, {98, 106}, {2, 117}},
+    /* LAYOUT_HOR_R, ALIGN_EVENLY; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{280, 0}, {200, 0}, {72, 0}, {0, 0}, {-96, 0}},
+    {{150, 0}, {35, 0}, {171, 90}, {98, 90}, {1, 90}},
+    {{280, 130}, {200, 110}, {72, 150}, {0, 122}, {-96, 144}},
+    {{150, 52}, {35, 32}, {171, 150}, {98, 122}, {1, 144}},
+    {{280, 65}, {200, 55}, {72, 75}, {0, 61}, {-96, 72}},
+    {{150, 26}, {35, 16}, {171, 120}, {98, 106}, {1, 117}},
+    /* LAYOUT_HOR_R, ALIGN_AROUND; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{280, 0}, {200, 0}, {72, 0}, {0, 0}, {-96, 0}},
+    {{159, 0}, {27, 0}, {172, 90}, {99, 90}, {2, 90}},
+    {{280, 130}, {200, 110}, {72, 150}, {0, 122}, {-96, 144}},
+    {{159, 52}, {27, 32}, {172, 150}, {99, 122}, {2, 144}},
+    {{280, 65}, {200, 55}, {72, 75}, {0, 61}, {-96, 72}},
+    {{159, 26}, {27, 16}, {172, 120}, {99, 106}, {2, 117}},
+    /* LAYOUT_HOR_R, ALIGN_BETWEEN; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{280, 0}, {200, 0}, {72, 0}, {0, 0}, {-96, 0}},
+    {{185, 0}, {0, 0}, {172, 90}, {98, 90}, {0, 90}},
+    {{280, 130}, {200, 110}, {72, 150}, {0, 122}, {-96, 144}},
+    {{185, 52}, {0, 32}, {172, 150}, {98, 122}, {0, 144}},
+    {{280, 65}, {200, 55}, {72, 75}, {0, 61}, {-96, 72}},
+    {{185, 26}, {0, 16}, {172, 120}, {98, 106}, {0, 117}},
+    /* LAYOUT_VER, ALIGN_START; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 0}, {0, 70}, {0, 160}, {0, 210}, {0, 288}},
+    {{0, 0}, {0, 70}, {115, 0}, {115, 50}, {115, 128}},
+    {{185, 0}, {220, 70}, {172, 160}, {228, 210}, {204, 288}},
+    {{57, 0}, {92, 70}, {172, 0}, {228, 50}, {204, 128}},
+    {{92, 0}, {110, 70}, {86, 160}, {114, 210}, {102, 288}},
+    {{28, 0}, {46, 70}, {143, 0}, {171, 50}, {159, 128}},
+    /* LAYOUT_VER, ALIGN_END; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, -144}, {0, -74}, {0, 16}, {0, 66}, {0, 144}},
+    {{0, 40}, {0, 110}, {115, 16}, {115, 66}, {115, 144}},
+    {{185, -144}, {220, -74}, {172, 16}, {228, 66}, {204, 144}},
+    {{57, 40}, {92, 110}, {172, 16}, {228, 66}, {204, 144}},
+    {{92, -144}, {110, -74}, {86, 16}, {114, 66}, {102, 144}},
+    {{28, 40}, {46, 110}, {143, 16}, {171, 66}, {159, 144}},
+    /* LAYOUT_VER, ALIGN_CENTER; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, -72}, {0, -2}, {0, 88}, {0, 138}, {0, 216}},
+    {{0, 20}, {0, 90}, {115, 8}, {115, 58}, {115, 136}},
+    {{185, -72}, {220, -2}, {172, 88}, {228, 138}, {204, 216}},
+    {{57, 20}, {92, 90}, {172, 8}, {228, 58}, {204, 136}},
+    {{92, -72}, {110, -2}, {86, 88}, {114, 138}, {102, 216}},
+    {{28, 20}, {46, 90}, {143, 8}, {171, 58}, {159, 136}},
+    /* LAYOUT_VER, ALIGN_EVENLY; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, -72}, {0, -2}, {0, 88}, {0, 138}, {0, 216}},
+    {{0, 13}, {0, 96}, {115, 4}, {115, 58}, {115, 140}},
+    {{185, -72}, {220, -2}, {172, 88}, {228, 138}, {204, 216}},
+    {{57, 13}, {92, 96}, {172, 4}, {228, 58}, {204, 140}},
+    {{92, -72}, {110, -2}, {86, 88}, {114, 138}, {102, 216}},
+    {{28, 13}, {46, 96}, {143, 4}, {171, 58}, {159, 140}},
+    /* LAYOUT_VER, ALIGN_AROUND; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, -72}, {0, -2}, {0, 88}, {0, 138}, {0, 216}},
+    {{0, 10}, {0, 100}, {115, 2}, {115, 57}, {115, 140}},
+    {{185, -72}, {220, -2}, {172, 88}, {228, 138}, {204, 216}},
+    {{57, 10}, {92, 100}, {172, 2}, {228, 57}, {204, 140}},
+    {{92, -72}, {110, -2}, {86, 88}, {114, 138}, {102, 216}},
+    {{28, 10}, {46, 100}, {143, 2}, {171, 57}, {159, 140}},
+    /* LAYOUT_VER, ALIGN_BETWEEN; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, -72}, {0, -2}, {0, 88}, {0, 138}, {0, 216}},
+    {{0, 0}, {0, 110}, {115, 0}, {115, 58}, {115, 144}},
+    {{185, -72}, {220, -2}, {172, 88}, {228, 138}, {204, 216}},
+    {{57, 0}, {92, 110}, {172, 0}, {228, 58}, {204, 144}},
+    {{92, -72}, {110, -2}, {86, 88}, {114, 138}, {102, 216}},
+    {{28, 0}, {46, 110}, {143, 0}, {171, 58}, {159, 144}},
+    /* LAYOUT_VER_R, ALIGN_START; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 130}, {0, 40}, {0, -10}, {0, -88}, {0, -144}},
+    {{0, 130}, {0, 40}, {115, 150}, {115, 72}, {115, 16}},
+    {{185, 130}, {220, 40}, {172, -10}, {228, -88}, {204, -144}},
+    {{57, 130}, {92, 40}, {172, 150}, {228, 72}, {204, 16}},
+    {{92, 130}, {110, 40}, {86, -10}, {114, -88}, {102, -144}},
+    {{28, 130}, {46, 40}, {143, 150}, {171, 72}, {159, 16}},
+    /* LAYOUT_VER_R, ALIGN_END; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 274}, {0, 184}, {0, 134}, {0, 56}, {0, 0}},
+    {{0, 90}, {0, 0}, {115, 134}, {115, 56}, {115, 0}},
+    {{185, 274}, {220, 184}, {172, 134}, {228, 56}, {204, 0}},
+    {{57, 90}, {92, 0}, {172, 134}, {228, 56}, {204, 0}},
+    {{92, 274}, {110, 184}, {86, 134}, {114, 56}, {102, 0}},
+    {{28, 90}, {46, 0}, {143, 134}, {171, 56}, {159, 0}},
+    /* LAYOUT_VER_R, ALIGN_CENTER; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 202}, {0, 112}, {0, 62}, {0, -16}, {0, -72}},
+    {{0, 110}, {0, 20}, {115, 142}, {115, 64}, {115, 8}},
+    {{185, 202}, {220, 112}, {172, 62}, {228, -16}, {204, -72}},
+    {{57, 110}, {92, 20}, {172, 142}, {228, 64}, {204, 8}},
+    {{92, 202}, {110, 112}, {86, 62}, {114, -16}, {102, -72}},
+    {{28, 110}, {46, 20}, {143, 142}, {171, 64}, {159, 8}},
+    /* LAYOUT_VER_R, ALIGN_EVENLY; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 202}, {0, 112}, {0, 62}, {0, -16}, {0, -72}},
+    {{0, 117}, {0, 14}, {115, 146}, {115, 64}, {115, 4}},
+    {{185, 202}, {220, 112}, {172, 62}, {228, -16}, {204, -72}},
+    {{57, 117}, {92, 14}, {172, 146}, {228, 64}, {204, 4}},
+    {{92, 202}, {110, 112}, {86, 62}, {114, -16}, {102, -72}},
+    {{28, 117}, {46, 14}, {143, 146}, {171, 64}, {159, 4}},
+    /* LAYOUT_VER_R, ALIGN_AROUND; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 202}, {0, 112}, {0, 62}, {0, -16}, {0, -72}},
+    {{0, 120}, {0, 10}, {115, 148}, {115, 65}, {115, 4}},
+    {{185, 202}, {220, 112}, {172, 62}, {228, -16}, {204, -72}},
+    {{57, 120}, {92, 10}, {172, 148}, {228, 65}, {204, 4}},
+    {{92, 202}, {110, 112}, {86, 62}, {114, -16}, {102, -72}},
+    {{28, 120}, {46, 10}, {143, 148}, {171, 65}, {159, 4}},
+    /* LAYOUT_VER_R, ALIGN_BETWEEN; secondary ALIGN_START, ALIGN_END, ALIGN_CENTER; NOWRAP, WRAP */
+    {{0, 202}, {0, 112}, {0, 62}, {0, -16}, {0, -72}},
+    {{0, 130}, {0, 0}, {115, 150}, {115, 64}, {115, 0}},
+    {{185, 202}, {220, 112}, {172, 62}, {228, -16}, {204, -72}},
+    {{57, 130}, {92, 0}, {172, 150}, {228, 64}, {204, 0}},
+    {{92, 202}, {110, 112}, {86, 62}, {114, -16}, {102, -72}},
+    {{28, 130}, {46, 0}, {143, 150}, {171, 64}, {159, 0}},
+};
+
+class CountingView : public UIView {
+public:
+    void SetPosition(int16_t x, int16_t y) override
+    {
+        placeCount_++;
+        UIView::SetPosition(x, y);
+    }
+
+    uint16_t placeCount_ = 0;
+};
+
+void RandomizeView(UIView* view)
+{
+    view->Resize(rand() % RANDOM_MAX_SIZE, rand() % RANDOM_MAX_SIZE);
+    view->SetVisible((rand() % 8) != 0); // 8: one in eight children is hidden
+    view->SetStyle(STYLE_MARGIN_LEFT, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_RIGHT, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_TOP, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_BOTTOM, rand() % RANDOM_MAX_MARGIN);
+}
+
+/* lays the same children out in a new layout, which has nothing cached, and compares the positions */
+bool IsSameAsFreshLayout(FlexLayout& layout, DirectionType direction, AlignType major, AlignType secondary,
+    uint8_t wrap)
+{
+    FlexLayout fresh;
+    fresh.SetPosition(0, 0, layout.GetWidth(), layout.GetHeight());
+    fresh.SetLayoutDirection(direction);
+    fresh.SetMajorAxisAlign(major);
+    fresh.SetSecondaryAxisAlign(secondary);
+    fresh.SetFlexWrap(wrap);
+    UIView* clones[RANDOM_MAX_CHILD];
+    uint16_t num = 0;
+    for (UIView* child = layout.GetChildrenHead(); child != nullptr; child = child->GetNextSibling()) {
+        UIView* clone = new UIView();
+        clone->Resize(child->GetWidth(), child->GetHeight());
+        clone->SetVisible(child->IsVisible());
+        clone->SetStyle(STYLE_MARGIN_LEFT, child->GetStyle(STYLE_MARGIN_LEFT));
+        clone->SetStyle(STYLE_MARGIN_RIGHT, child->GetStyle(STYLE_MARGIN_RIGHT));
+        clone->SetStyle(STYLE_MARGIN_TOP, child->GetStyle(STYLE_MARGIN_TOP));
+        clone->SetStyle(STYLE_MARGIN_BOTTOM, child->GetStyle(STYLE_MARGIN_BOTTOM));
+        fresh.Add(clone);
+        clones[num++] = clone;
+    }
+    fresh.LayoutChildren();
+    bool same = true;
+    uint16_t i = 0;
+    for (UIView* child = layout.GetChildrenHead(); child != nullptr; child = child->GetNextSibling()) {
+        if (child->IsVisible() && ((child->GetX() != clones[i]->GetX()) || (child->GetY() != clones[i]->GetY()))) {
+            same = false;
+        }
+        i++;
+    }
+    fresh.RemoveAll();
+    for (i = 0; i < num; i++) {
+        delete clones[i];
+    }
+    return same;
+}
 }
 class FlexLayoutTest : public testing::Test {
 public:
@@ -418,4 +673,165 @@ HWTEST_F(FlexLayoutTest, FlexLayout_010, TestSize.Level1)
     delete view3;
     delete view4;
 }
+
+/**
+ * @tc.name: FlexLayoutIncremental_001
+ * @tc.desc: Verify nothing is placed again when neither the children nor the layout changed, and only the changed
+ *           child is placed when the following children do not move.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexLayoutTest, FlexLayoutIncremental_001, TestSize.Level1)
+{
+    FlexLayout layout;
+    layout.SetPosition(0, 0, 600, 300); // 600: layout width; 300: layout height
+    layout.SetLayoutDirection(LAYOUT_HOR);
+    layout.SetMajorAxisAlign(ALIGN_START);
+    layout.SetSecondaryAxisAlign(ALIGN_START);
+    CountingView views[3]; // 3: child count
+    for (uint16_t i = 0; i < 3; i++) { // 3: child count
+        views[i].Resize(100, 100); // 100: view width and height
+        layout.Add(&views[i]);
+    }
+    layout.LayoutChildren();
+    EXPECT_EQ(views[2].GetX(), 200); // 2: last child; 200: view x after layout
+    EXPECT_EQ(views[2].placeCount_, 1);
+
+    layout.LayoutChildren();
+    EXPECT_EQ(views[0].placeCount_, 1);
+    EXPECT_EQ(views[2].placeCount_, 1); // 2: last child
+
+    views[2].Resize(50, 100); // 2: last child; 50: new width; 100: height
+    layout.LayoutChildren();
+    EXPECT_EQ(views[0].placeCount_, 1);
+    EXPECT_EQ(views[1].placeCount_, 1);
+    EXPECT_EQ(views[2].placeCount_, 2); // 2: last child, placed twice
+
+    views[0].Resize(80, 100); // 80: new width; 100: height
+    layout.LayoutChildren();
+    EXPECT_EQ(views[1].GetX(), 80); // 80: view x after layout
+    EXPECT_EQ(views[1].placeCount_, 2); // 2: placed twice
+    layout.RemoveAll();
+}
+
+/**
+ * @tc.name: FlexLayoutIncremental_002
+ * @tc.desc: Verify a layout changed step by step places its children exactly like a layout laid out from scratch,
+ *           across randomized children, margins and layout attributes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexLayoutTest, FlexLayoutIncremental_002, TestSize.Level1)
+{
+    srand(0);
+    for (uint16_t round = 0; round < RANDOM_ROUND; round++) {
+        FlexLayout layout;
+        layout.SetPosition(0, 0, 100 + rand() % 500, 100 + rand() % 300); // 100, 500, 300: random layout size
+        UIView* views[RANDOM_MAX_CHILD];
+        uint16_t num = 1 + rand() % (RANDOM_MAX_CHILD / 2); // 2: start with up to half of the children
+        for (uint16_t i = 0; i < num; i++) {
+            views[i] = new UIView();
+            RandomizeView(views[i]);
+            layout.Add(views[i]);
+        }
+        DirectionType direction = LAYOUT_HOR;
+        AlignType major = ALIGN_START;
+        AlignType secondary = ALIGN_START;
+        uint8_t wrap = FlexLayout::NOWRAP;
+        layout.SetSecondaryAxisAlign(secondary);
+        for (uint16_t step = 0; step < RANDOM_STEP; step++) {
+            switch (rand() % 6) { // 6: number of kinds of change, the last one changes nothing
+                case 0:
+                    direction = rand() % (LAYOUT_VER_R + 1);
+                    major = rand() % (ALIGN_BETWEEN + 1);
+                    secondary = rand() % (ALIGN_CENTER + 1);
+                    wrap = rand() % 2; // 2: NOWRAP or WRAP
+                    layout.SetLayoutDirection(direction);
+                    layout.SetMajorAxisAlign(major);
+                    layout.SetSecondaryAxisAlign(secondary);
+                    layout.SetFlexWrap(wrap);
+                    break;
+                case 1:
+                    if (num < RANDOM_MAX_CHILD) {
+                        views[num] = new UIView();
+                        RandomizeView(views[num]);
+                        layout.Add(views[num++]);
+                    }
+                    break;
+                case 2:
+                    if (num > 1) {
+                        uint16_t index = rand() % num;
+                        layout.Remove(views[index]);
+                        delete views[index];
+                        views[index] = views[--num];
+                    }
+                    break;
+                case 3:
+                    RandomizeView(views[rand() % num]);
+                    break;
+                case 4: // 4: the child is moved by the application
+                    views[rand() % num]->SetPosition(rand() % RANDOM_MAX_SIZE, rand() % RANDOM_MAX_SIZE);
+                    break;
+                default:
+                    break;
+            }
+            layout.LayoutChildren();
+            EXPECT_EQ(IsSameAsFreshLayout(layout, direction, major, secondary, wrap), true);
+        }
+        layout.RemoveAll();
+        for (uint16_t i = 0; i < num; i++) {
+            delete views[i];
+        }
+    }
+}
+
+/**
+ * @tc.name: FlexLayoutIncremental_003
+ * @tc.desc: Verify the children are placed where the layout placed them before child metrics were cached, for
+ *           every direction, alignment and wrap, both when only the layout attributes change and when a child
+ *           changes and changes back.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FlexLayoutTest, FlexLayoutIncremental_003, TestSize.Level1)
+{
+    FlexLayout layout;
+    layout.SetPosition(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    UIView views[GOLDEN_CHILD_NUM];
+    for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+        views[i].Resize(GOLDEN_SIZE[i][0], GOLDEN_SIZE[i][1]);
+        views[i].SetStyle(STYLE_MARGIN_LEFT, GOLDEN_MARGIN[i][0]);
+        views[i].SetStyle(STYLE_MARGIN_RIGHT, GOLDEN_MARGIN[i][1]);
+        views[i].SetStyle(STYLE_MARGIN_TOP, GOLDEN_MARGIN[i][2]);    // 2: top margin
+        views[i].SetStyle(STYLE_MARGIN_BOTTOM, GOLDEN_MARGIN[i][3]); // 3: bottom margin
+        layout.Add(&views[i]);
+    }
+    uint16_t index = 0;
+    for (uint8_t direction = 0; direction < GOLDEN_DIRECTION_NUM; direction++) {
+        for (uint8_t major = 0; major < GOLDEN_MAJOR_NUM; major++) {
+            for (uint8_t secondary = 0; secondary < GOLDEN_SECONDARY_NUM; secondary++) {
+                for (uint8_t wrap = 0; wrap < GOLDEN_WRAP_NUM; wrap++) {
+                    layout.SetLayoutDirection(direction);
+                    layout.SetMajorAxisAlign(major);
+                    layout.SetSecondaryAxisAlign(secondary);
+                    layout.SetFlexWrap(wrap);
+                    layout.LayoutChildren();
+                    for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+                        EXPECT_EQ(views[i].GetX(), GOLDEN_POS[index][i][0]) << "case " << index << " child " << i;
+                        EXPECT_EQ(views[i].GetY(), GOLDEN_POS[index][i][1]) << "case " << index << " child " << i;
+                    }
+
+                    /* the middle child shrinks and grows back, it and the children after it are placed again */
+                    views[2].Resize(1, 1); // 2: middle child
+                    layout.LayoutChildren();
+                    views[2].Resize(GOLDEN_SIZE[2][0], GOLDEN_SIZE[2][1]); // 2: middle child
+                    layout.LayoutChildren();
+                    for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+                        EXPECT_EQ(views[i].GetX(), GOLDEN_POS[index][i][0]) << "case " << index << " child " << i;
+                        EXPECT_EQ(views[i].GetY(), GOLDEN_POS[index][i][1]) << "case " << index << " child " << i;
+                    }
+                    index++;
+                }
+            }
+        }
+    }
+    layout.RemoveAll();
+}
 } // namespace OHOS
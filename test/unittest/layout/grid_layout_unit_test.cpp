@@ -16,6 +16,7 @@
 #include "layout/grid_layout.h"
 
 #include <climits>
+#include <cstdlib>
 #include <gtest/gtest.h>
 
 using namespace testing::ext;
@@ -31,6 +32,82 @@ UIView* CreatView()
     EXPECT_EQ(view->GetY(), 0);
     return view;
 }
+
+constexpr uint16_t RANDOM_ROUND = 200;
+constexpr uint16_t RANDOM_STEP = 10;
+constexpr uint16_t RANDOM_MAX_LINE = 5;
+constexpr int16_t RANDOM_MAX_SIZE = 150;
+constexpr int16_t RANDOM_MAX_MARGIN = 20;
+
+constexpr int16_t GOLDEN_WIDTH = 300;
+constexpr int16_t GOLDEN_HEIGHT = 200;
+constexpr uint8_t GOLDEN_CHILD_NUM = 5;
+constexpr uint8_t GOLDEN_SHAPE_NUM = 2;
+constexpr uint8_t GOLDEN_DIRECTION_NUM = 2;
+/* rows and columns */
+constexpr uint16_t GOLDEN_SHAPE[GOLDEN_SHAPE_NUM][2] = {{2, 3}, {3, 2}};
+constexpr DirectionType GOLDEN_DIRECTION[GOLDEN_DIRECTION_NUM] = {LAYOUT_HOR, LAYOUT_VER};
+constexpr int16_t GOLDEN_SIZE[GOLDEN_CHILD_NUM][2] = {{100, 60}, {80, 90}, {120, 40}, {60, 70}, {90, 50}};
+/* left, right, top and bottom margins */
+constexpr int16_t GOLDEN_MARGIN[GOLDEN_CHILD_NUM][4] = {
+    {5, 10, 4, 6}, {0, 0, 0, 0}, {8, 0, 10, 0}, {0, 12, 0, 8}, {3, 3, 3, 3}
+};
+/* the children positions of each grid shape and direction, as the grid has always placed them */
+constexpr int16_t GOLDEN_POS[GOLDEN_SHAPE_NUM * GOLDEN_DIRECTION_NUM][GOLDEN_CHILD_NUM][2] = {
+    /* 2 rows, 3 columns, LAYOUT_HOR */
+    {{-2, 19}, {110, 5}, {194, 35}, {14, 111}, {105, 125}},
+    /* 2 rows, 3 columns, LAYOUT_VER */
+    {{-2, 19}, {10, 105}, {94, 35}, {114, 111}, {205, 25}},
+    /* 3 rows, 2 columns, LAYOUT_HOR */
+    {{22, 2}, {185, -12}, {19, 84}, {189, 60}, {30, 140}},
+    /* 3 rows, 2 columns, LAYOUT_VER */
+    {{22, 2}, {35, 54}, {19, 150}, {189, -6}, {180, 74}},
+};
+
+void RandomizeView(UIView* view)
+{
+    view->Resize(rand() % RANDOM_MAX_SIZE, rand() % RANDOM_MAX_SIZE);
+    view->SetStyle(STYLE_MARGIN_LEFT, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_RIGHT, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_TOP, rand() % RANDOM_MAX_MARGIN);
+    view->SetStyle(STYLE_MARGIN_BOTTOM, rand() % RANDOM_MAX_MARGIN);
+}
+
+/* lays the same children out in a new layout and compares the positions */
+bool IsSameAsFreshLayout(GridLayout& layout, uint16_t rows, uint16_t cols, DirectionType direction)
+{
+    GridLayout fresh;
+    fresh.SetPosition(0, 0, layout.GetWidth(), layout.GetHeight());
+    fresh.SetRows(rows);
+    fresh.SetCols(cols);
+    fresh.SetLayoutDirection(direction);
+    UIView* clones[RANDOM_MAX_LINE * RANDOM_MAX_LINE];
+    uint16_t num = 0;
+    for (UIView* child = layout.GetChildrenHead(); child != nullptr; child = child->GetNextSibling()) {
+        UIView* clone = new UIView();
+        clone->Resize(child->GetWidth(), child->GetHeight());
+        clone->SetStyle(STYLE_MARGIN_LEFT, child->GetStyle(STYLE_MARGIN_LEFT));
+        clone->SetStyle(STYLE_MARGIN_RIGHT, child->GetStyle(STYLE_MARGIN_RIGHT));
+        clone->SetStyle(STYLE_MARGIN_TOP, child->GetStyle(STYLE_MARGIN_TOP));
+        clone->SetStyle(STYLE_MARGIN_BOTTOM, child->GetStyle(STYLE_MARGIN_BOTTOM));
+        fresh.Add(clone);
+        clones[num++] = clone;
+    }
+    fresh.LayoutChildren();
+    bool same = true;
+    uint16_t i = 0;
+    for (UIView* child = layout.GetChildrenHead(); child != nullptr; child = child->GetNextSibling()) {
+        if ((child->GetX() != clones[i]->GetX()) || (child->GetY() != clones[i]->GetY())) {
+            same = false;
+        }
+        i++;
+    }
+    fresh.RemoveAll();
+    for (i = 0; i < num; i++) {
+        delete clones[i];
+    }
+    return same;
+}
 }
 class GridLayoutTest : public testing::Test {
 public:
@@ -222,4 +299,112 @@ HWTEST_F(GridLayoutTest, GridLayout_004, TestSize.Level1)
     delete view3;
     delete view4;
 }
+
+/**
+ * @tc.name: GridLayoutIncremental_001
+ * @tc.desc: Verify a grid changed step by step places its children exactly like a grid laid out from scratch,
+ *           across randomized children and margins.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GridLayoutTest, GridLayoutIncremental_001, TestSize.Level1)
+{
+    srand(0);
+    for (uint16_t round = 0; round < RANDOM_ROUND; round++) {
+        GridLayout layout;
+        layout.SetPosition(0, 0, 100 + rand() % 500, 100 + rand() % 300); // 100, 500, 300: random layout size
+        uint16_t rows = 1 + rand() % RANDOM_MAX_LINE;
+        uint16_t cols = 1 + rand() % RANDOM_MAX_LINE;
+        layout.SetRows(rows);
+        layout.SetCols(cols);
+        UIView* views[RANDOM_MAX_LINE * RANDOM_MAX_LINE];
+        uint16_t num = 1 + rand() % (rows * cols);
+        for (uint16_t i = 0; i < num; i++) {
+            views[i] = new UIView();
+            RandomizeView(views[i]);
+            layout.Add(views[i]);
+        }
+        DirectionType direction = LAYOUT_HOR;
+        for (uint16_t step = 0; step < RANDOM_STEP; step++) {
+            switch (rand() % 5) { // 5: number of kinds of change, the last one changes nothing
+                case 0:
+                    direction = (rand() % 2 == 0) ? LAYOUT_HOR : LAYOUT_VER; // 2: two directions
+                    layout.SetLayoutDirection(direction);
+                    break;
+                case 1:
+                    if (num < rows * cols) {
+                        views[num] = new UIView();
+                        RandomizeView(views[num]);
+                        layout.Add(views[num++]);
+                    }
+                    break;
+                case 2:
+                    if (num > 1) {
+                        uint16_t index = rand() % num;
+                        layout.Remove(views[index]);
+                        delete views[index];
+                        views[index] = views[--num];
+                    }
+                    break;
+                case 3:
+                    RandomizeView(views[rand() % num]);
+                    break;
+                default:
+                    break;
+            }
+            layout.LayoutChildren();
+            EXPECT_EQ(IsSameAsFreshLayout(layout, rows, cols, direction), true);
+        }
+        layout.RemoveAll();
+        for (uint16_t i = 0; i < num; i++) {
+            delete views[i];
+        }
+    }
+}
+
+/**
+ * @tc.name: GridLayoutIncremental_002
+ * @tc.desc: Verify the children are placed at their golden positions, both when the grid is laid out from scratch
+ *           and when a child changes and changes back.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GridLayoutTest, GridLayoutIncremental_002, TestSize.Level1)
+{
+    uint16_t index = 0;
+    for (uint8_t shape = 0; shape < GOLDEN_SHAPE_NUM; shape++) {
+        for (uint8_t direction = 0; direction < GOLDEN_DIRECTION_NUM; direction++) {
+            GridLayout layout;
+            layout.SetPosition(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+            layout.SetRows(GOLDEN_SHAPE[shape][0]);
+            layout.SetCols(GOLDEN_SHAPE[shape][1]);
+            layout.SetLayoutDirection(GOLDEN_DIRECTION[direction]);
+            UIView views[GOLDEN_CHILD_NUM];
+            for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+                views[i].Resize(GOLDEN_SIZE[i][0], GOLDEN_SIZE[i][1]);
+                views[i].SetStyle(STYLE_MARGIN_LEFT, GOLDEN_MARGIN[i][0]);
+                views[i].SetStyle(STYLE_MARGIN_RIGHT, GOLDEN_MARGIN[i][1]);
+                views[i].SetStyle(STYLE_MARGIN_TOP, GOLDEN_MARGIN[i][2]);    // 2: top margin
+                views[i].SetStyle(STYLE_MARGIN_BOTTOM, GOLDEN_MARGIN[i][3]); // 3: bottom margin
+                layout.Add(&views[i]);
+            }
+            layout.LayoutChildren();
+            for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+                EXPECT_EQ(views[i].GetX(), GOLDEN_POS[index][i][0]) << "case " << index << " child " << i;
+                EXPECT_EQ(views[i].GetY(), GOLDEN_POS[index][i][1]) << "case " << index << " child " << i;
+            }
+
+            views[2].Resize(1, 1); // 2: middle child
+            views[2].SetStyle(STYLE_MARGIN_LEFT, 0); // 2: middle child
+            layout.LayoutChildren();
+            views[2].Resize(GOLDEN_SIZE[2][0], GOLDEN_SIZE[2][1]); // 2: middle child
+            views[2].SetStyle(STYLE_MARGIN_LEFT, GOLDEN_MARGIN[2][0]); // 2: middle child
+            layout.LayoutChildren();
+            for (uint8_t i = 0; i < GOLDEN_CHILD_NUM; i++) {
+                EXPECT_EQ(views[i].GetX(), GOLDEN_POS[index][i][0]) << "case " << index << " child " << i;
+                EXPECT_EQ(views[i].GetY(), GOLDEN_POS[index][i][1]) << "case " << index << " child " << i;
+            }
+            layout.RemoveAll();
+            index++;
+        }
+    }
+}
 } // namespace OHOS
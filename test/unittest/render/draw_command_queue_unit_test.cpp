@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engines/gfx/draw_command_queue.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t BUFFER_SIZE = 100;
+constexpr int16_t IMAGE_SIZE = 20;
+constexpr uint8_t HALF_OPA = OPA_OPAQUE / 2; // 2: half
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels, int16_t size)
+{
+    buffer.rect = Rect(0, 0, size - 1, size - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = size * sizeof(Color32);
+    buffer.width = size;
+    buffer.height = size;
+    for (int32_t i = 0; i < size * size; i++) {
+        pixels[i].full = Color::ColorTo32(Color::White());
+    }
+}
+
+/* the draw calls of a small screen: nested opaque backgrounds, split borders, a translucent overlay and an image */
+void DrawScene(BaseGfxEngine& engine, BufferInfo& dst, const BufferInfo& image)
+{
+    engine.SubmitFill(dst, Rect(0, 0, 99, 99), Color::Gray(), OPA_OPAQUE);          // 99: screen
+    engine.SubmitFill(dst, Rect(10, 10, 89, 89), Color::Blue(), OPA_OPAQUE);        // 10, 89: group
+    engine.SubmitFill(dst, Rect(20, 20, 79, 79), Color::Red(), OPA_OPAQUE);         // 20, 79: covered below
+    engine.SubmitFill(dst, Rect(15, 15, 84, 84), Color::Green(), OPA_OPAQUE);       // 15, 84: child
+    engine.SubmitFill(dst, Rect(15, 15, 49, 19), Color::Yellow(), HALF_OPA);        // 15, 49, 19: left border
+    engine.SubmitFill(dst, Rect(50, 15, 84, 19), Color::Yellow(), HALF_OPA);        // 50, 84, 19: right border
+    engine.SubmitFill(dst, Rect(30, 30, 69, 69), Color::Black(), OPA_OPAQUE);       // 30, 69: image background
+    BlendOption blendOption;
+    blendOption.opacity = OPA_OPAQUE;
+    Rect subRect(40, 40, 40 + IMAGE_SIZE - 1, 40 + IMAGE_SIZE - 1); // 40: image position
+    engine.SubmitBlit(dst, {subRect.GetLeft(), subRect.GetTop()}, image, subRect, blendOption);
+    engine.SubmitFill(dst, Rect(0, 90, 99, 99), Color::Red(), HALF_OPA);            // 90, 99: translucent bar
+}
+} // namespace
+
+class DrawCommandQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: DrawCommandQueueOptimize_001
+ * @tc.desc: Verify a fill covered by a later opaque fill is dropped, and a translucent one does not cover.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCommandQueueTest, DrawCommandQueueOptimize_001, TestSize.Level1)
+{
+    DrawCommandQueue queue;
+    queue.AddFill(Rect(10, 10, 20, 20), Color::Red(), OPA_OPAQUE);   // 10, 20: covered by the next fill
+    queue.AddFill(Rect(0, 0, 30, 30), Color::Blue(), OPA_OPAQUE);    // 30: cover
+    queue.AddFill(Rect(40, 40, 50, 50), Color::Red(), OPA_OPAQUE);   // 40, 50: under a translucent fill
+    queue.AddFill(Rect(0, 0, 60, 60), Color::Green(), HALF_OPA);     // 60: translucent
+    queue.Optimize();
+    ASSERT_EQ(queue.GetCommandNum(), 3); // 3: only the first fill is dropped
+    EXPECT_EQ(queue.GetCommands()[0].rect, Rect(0, 0, 30, 30));       // 30: cover
+    EXPECT_EQ(queue.GetCommands()[1].rect, Rect(40, 40, 50, 50));     // 40, 50: under a translucent fill
+    EXPECT_EQ(queue.GetDroppedNum(), 1U);
+}
+
+/**
+ * @tc.name: DrawCommandQueueOptimize_002
+ * @tc.desc: Verify adjacent fills of the same color are merged, unless a fill in between overlaps them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCommandQueueTest, DrawCommandQueueOptimize_002, TestSize.Level1)
+{
+    DrawCommandQueue queue;
+    queue.AddFill(Rect(0, 0, 9, 9), Color::Red(), HALF_OPA);         // 9: left
+    queue.AddFill(Rect(10, 0, 19, 9), Color::Red(), HALF_OPA);       // 10, 19, 9: right
+    queue.AddFill(Rect(0, 10, 19, 19), Color::Red(), HALF_OPA);      // 10, 19: below both
+    queue.Optimize();
+    ASSERT_EQ(queue.GetCommandNum(), 1);
+    EXPECT_EQ(queue.GetCommands()[0].rect, Rect(0, 0, 19, 19));       // 19: all three
+    EXPECT_EQ(queue.GetMergedNum(), 2U); // 2: two merges
+
+    queue.Clear();
+    queue.AddFill(Rect(0, 0, 9, 9), Color::Red(), HALF_OPA);         // 9: left
+    queue.AddFill(Rect(5, 5, 14, 14), Color::Blue(), HALF_OPA);      // 5, 14: overlaps the left one
+    queue.AddFill(Rect(10, 0, 19, 9), Color::Red(), HALF_OPA);       // 10, 19, 9: right
+    queue.Optimize();
+    EXPECT_EQ(queue.GetCommandNum(), 3); // 3: nothing merged
+}
+
+/**
+ * @tc.name: DrawCommandQueueRender_001
+ * @tc.desc: Verify the deferred mode draws the same pixels as drawing every call at once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCommandQueueTest, DrawCommandQueueRender_001, TestSize.Level1)
+{
+    Color32* imagePixels = new Color32[IMAGE_SIZE * IMAGE_SIZE];
+    for (int32_t i = 0; i < IMAGE_SIZE * IMAGE_SIZE; i++) {
+        imagePixels[i].full = 0x80000000 | (i * 0x030201); // 0x80000000: translucent, 0x030201: any colors
+    }
+    BufferInfo image;
+    image.rect = Rect(0, 0, IMAGE_SIZE - 1, IMAGE_SIZE - 1);
+    image.mode = ARGB8888;
+    image.color = 0;
+    image.phyAddr = image.virAddr = imagePixels;
+    image.stride = IMAGE_SIZE * sizeof(Color32);
+    image.width = IMAGE_SIZE;
+    image.height = IMAGE_SIZE;
+
+    Color32* expectPixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo expect;
+    BufferInfo dst;
+    InitBuffer(expect, expectPixels, BUFFER_SIZE);
+    InitBuffer(dst, pixels, BUFFER_SIZE);
+
+    BaseGfxEngine immediateEngine;
+    DrawScene(immediateEngine, expect, image);
+    BaseGfxEngine deferredEngine;
+    deferredEngine.SetDeferredEnable(true);
+    deferredEngine.BeginDeferred(dst);
+    DrawScene(deferredEngine, dst, image);
+    deferredEngine.EndDeferred();
+
+    EXPECT_EQ(memcmp(pixels, expectPixels, BUFFER_SIZE * BUFFER_SIZE * sizeof(Color32)), 0);
+    const DrawCommandQueue* queue = deferredEngine.GetDrawCommandQueue();
+    ASSERT_NE(queue, nullptr);
+    EXPECT_GT(queue->GetDroppedNum(), 0U);
+    EXPECT_GT(queue->GetMergedNum(), 0U);
+    delete[] imagePixels;
+    delete[] expectPixels;
+    delete[] pixels;
+}
+} // namespace OHOS
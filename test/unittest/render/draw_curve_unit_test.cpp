@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/draw_curve.h"
+
+#include <gtest/gtest.h>
+
+#include "animator/interpolation.h"
+#include "engines/gfx/gfx_engine_manager.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t BUFFER_SIZE = 200;
+constexpr uint16_t REFERENCE_RANGE = 1024;
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels, int16_t size)
+{
+    buffer.rect = Rect(0, 0, size - 1, size - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = size * sizeof(Color32);
+    buffer.width = size;
+    buffer.height = size;
+    for (int32_t i = 0; i < size * size; i++) {
+        pixels[i].full = Color::ColorTo32(Color::White());
+    }
+}
+
+/* returns the lines DrawCurve drew for the curve before flattening adaptively: one for each of 1024 steps */
+uint16_t CountReferenceLines(const Point* curve)
+{
+    uint16_t lineNum = 0;
+    Point prePoint = curve[0];
+    for (uint16_t t = 1; t <= REFERENCE_RANGE; t++) {
+        Point point;
+        point.x = Interpolation::GetBezierInterpolation(t, curve[0].x, curve[1].x, curve[2].x, curve[3].x); // 2, 3
+        point.y = Interpolation::GetBezierInterpolation(t, curve[0].y, curve[1].y, curve[2].y, curve[3].y); // 2, 3
+        if ((prePoint.x == point.x) && (prePoint.y == point.y)) {
+            continue;
+        }
+        lineNum++;
+        prePoint = point;
+    }
+    return lineNum;
+}
+} // namespace
+
+class DrawCurveTest : public testing::Test {
+public:
+    DrawCurveTest() {}
+    virtual ~DrawCurveTest() {}
+
+    static void SetUpTestCase()
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            BaseGfxEngine::InitGfxEngine();
+        }
+    }
+};
+
+/**
+ * @tc.name: DrawCurveGetSegmentNum_001
+ * @tc.desc: Verify a curve is flattened to more segments the more it bends and the larger it is.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCurveTest, DrawCurveGetSegmentNum_001, TestSize.Level1)
+{
+    EXPECT_EQ(DrawCurve::GetSegmentNum({0, 0}, {10, 10}, {20, 20}, {30, 30}), 1);
+    EXPECT_EQ(DrawCurve::GetSegmentNum({5, 5}, {5, 5}, {5, 5}, {5, 5}), 1);
+
+    uint16_t shortNum = DrawCurve::GetSegmentNum({0, 20}, {0, 0}, {20, 0}, {20, 20});
+    uint16_t longNum = DrawCurve::GetSegmentNum({0, 400}, {0, 0}, {400, 0}, {400, 400});
+    EXPECT_GT(shortNum, 1);
+    EXPECT_GT(longNum, shortNum);
+    EXPECT_LT(longNum, REFERENCE_RANGE);
+    EXPECT_EQ(DrawCurve::GetSegmentNum({0, 0}, {INT16_MAX, INT16_MAX}, {INT16_MIN, INT16_MIN}, {0, 0}),
+              DrawCurve::MAX_SEGMENT_NUM);
+}
+
+/**
+ * @tc.name: DrawCurvePolyline_001
+ * @tc.desc: Verify a translucent polyline blends its joint once, like the middle of a segment.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCurveTest, DrawCurvePolyline_001, TestSize.Level1)
+{
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels, BUFFER_SIZE);
+    const Point points[] = {{20, 50}, {100, 50}, {100, 150}};
+    DrawCurve::DrawPolyline(buffer, points, sizeof(points) / sizeof(points[0]), buffer.rect, 9, Color::Red(), // 9
+                            OPA_OPAQUE / 2);                                                                 // 2: half
+
+    Color32 segment = pixels[50 * BUFFER_SIZE + 60]; // 50, 60: middle of the first segment
+    Color32 joint = pixels[50 * BUFFER_SIZE + 100];  // 50, 100: the joint
+    Color32 corner = pixels[48 * BUFFER_SIZE + 102]; // 48, 102: outer side of the joint, covered by the round join
+    EXPECT_NE(segment.full, Color::ColorTo32(Color::White()).full);
+    EXPECT_EQ(joint.full, segment.full);
+    EXPECT_EQ(corner.full, segment.full);
+    EXPECT_EQ(pixels[100 * BUFFER_SIZE + 100].full, segment.full); // 100: middle of the second segment
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: DrawCurvePolyline_002
+ * @tc.desc: Verify a translucent polyline on an RGB565 buffer is rasterized as one shape too, so its joint is
+ *           blended once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCurveTest, DrawCurvePolyline_002, TestSize.Level1)
+{
+    const uint16_t white = 0xFFFF; // 0xFFFF: white in RGB565
+    uint16_t* pixels = new uint16_t[BUFFER_SIZE * BUFFER_SIZE];
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        pixels[i] = white;
+    }
+    BufferInfo buffer;
+    buffer.rect = Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+    buffer.mode = RGB565;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = BUFFER_SIZE * sizeof(uint16_t);
+    buffer.width = BUFFER_SIZE;
+    buffer.height = BUFFER_SIZE;
+    const Point points[] = {{20, 50}, {100, 50}, {100, 150}};
+    DrawCurve::DrawPolyline(buffer, points, sizeof(points) / sizeof(points[0]), buffer.rect, 9, Color::Red(), // 9
+                            OPA_OPAQUE / 2);                                                                 // 2: half
+
+    uint16_t segment = pixels[50 * BUFFER_SIZE + 60]; // 50, 60: middle of the first segment
+    EXPECT_NE(segment, white);
+    EXPECT_EQ(pixels[50 * BUFFER_SIZE + 100], segment);  // 50, 100: the joint
+    EXPECT_EQ(pixels[48 * BUFFER_SIZE + 102], segment);  // 48, 102: outer side of the joint
+    EXPECT_EQ(pixels[100 * BUFFER_SIZE + 100], segment); // 100: middle of the second segment
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: DrawCurveCubicBezier_001
+ * @tc.desc: Verify the curve passes through its middle point and nothing is drawn outside the mask.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCurveTest, DrawCurveCubicBezier_001, TestSize.Level1)
+{
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels, BUFFER_SIZE);
+    /* the middle of this curve is (100, 60) */
+    Rect mask(0, 0, 99, BUFFER_SIZE - 1); // 99: left half
+    DrawCurve::DrawCubicBezier(buffer, {20, 180}, {20, 20}, {180, 20}, {180, 180}, mask, 5, Color::Red(), // 5: width
+                               OPA_OPAQUE);
+
+    EXPECT_EQ(pixels[60 * BUFFER_SIZE + 99].full, Color::ColorTo32(Color::Red()).full); // 60, 99: left of middle
+    for (int16_t y = 0; y < BUFFER_SIZE; y++) {
+        for (int16_t x = mask.GetRight() + 1; x < BUFFER_SIZE; x++) {
+            ASSERT_EQ(pixels[y * BUFFER_SIZE + x].full, Color::ColorTo32(Color::White()).full) << x << ", " << y;
+        }
+    }
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: DrawCurveCubicBezierCost_001
+ * @tc.desc: Verify short and long curves are flattened to far fewer segments than the lines drawn for each of 1024
+ *           steps, the longer curve the more so.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawCurveTest, DrawCurveCubicBezierCost_001, TestSize.Level1)
+{
+    const Point shortCurve[] = {{200, 230}, {200, 200}, {230, 200}, {230, 230}};
+    const Point longCurve[] = {{20, 420}, {20, 20}, {420, 20}, {420, 420}};
+    uint16_t shortSegmentNum = DrawCurve::GetSegmentNum(shortCurve[0], shortCurve[1], shortCurve[2], // 2: control2
+                                                        shortCurve[3]);                             // 3: end
+    uint16_t longSegmentNum = DrawCurve::GetSegmentNum(longCurve[0], longCurve[1], longCurve[2], // 2: control2
+                                                       longCurve[3]);                           // 3: end
+    uint16_t shortLineNum = CountReferenceLines(shortCurve);
+    uint16_t longLineNum = CountReferenceLines(longCurve);
+    EXPECT_GT(shortLineNum, shortSegmentNum * 4); // 4: more than four lines for each segment
+    EXPECT_GT(longLineNum, longSegmentNum * 4);   // 4: more than four lines for each segment
+    EXPECT_GT(longLineNum * shortSegmentNum, shortLineNum * longSegmentNum);
+}
+} // namespace OHOS
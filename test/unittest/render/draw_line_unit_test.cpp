@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/draw_line.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "engines/gfx/gfx_engine_manager.h"
+#include "gfx_utils/graphic_math.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t BUFFER_SIZE = 200;
+constexpr int16_t CENTER = BUFFER_SIZE / 2; // 2: half
+constexpr int16_t LINE_RADIUS = 80;
+constexpr int16_t MAX_WIDTH = 20;
+constexpr int16_t ANGLE_STEP = 7;
+
+void InitBuffer(BufferInfo& buffer, Color32* pixels)
+{
+    buffer.rect = Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+    buffer.mode = ARGB8888;
+    buffer.color = 0;
+    buffer.phyAddr = buffer.virAddr = pixels;
+    buffer.stride = BUFFER_SIZE * sizeof(Color32);
+    buffer.width = BUFFER_SIZE;
+    buffer.height = BUFFER_SIZE;
+    for (int32_t i = 0; i < BUFFER_SIZE * BUFFER_SIZE; i++) {
+        pixels[i].full = Color::ColorTo32(Color::White());
+    }
+}
+
+/* a line from the center of the buffer at angle degrees, clockwise from the top */
+Point GetLineEnd(int16_t angle)
+{
+    return {static_cast<int16_t>(CENTER + LINE_RADIUS * Sin(angle)),
+            static_cast<int16_t>(CENTER - LINE_RADIUS * Sin(angle + QUARTER_IN_DEGREE))};
+}
+
+/* draws a line of width at every ANGLE_STEP degrees */
+void DrawStar(BufferInfo& buffer, const Rect& mask, int16_t width, OpacityType opacity)
+{
+    for (int16_t angle = 0; angle < CIRCLE_IN_DEGREE; angle += ANGLE_STEP) {
+        DrawLine::Draw(buffer, {CENTER, CENTER}, GetLineEnd(angle), mask, width, Color::Red(), opacity);
+    }
+}
+
+/* returns the blends issued for one star */
+uint32_t CountStarBlends(BufferInfo& buffer, int16_t width, bool spanEnable)
+{
+    DrawLine::SetSpanEnable(spanEnable);
+    uint32_t blendCount = DrawLine::GetBlendCount();
+    DrawStar(buffer, buffer.rect, width, OPA_OPAQUE);
+    DrawLine::SetSpanEnable(true);
+    return DrawLine::GetBlendCount() - blendCount;
+}
+} // namespace
+
+class DrawLineTest : public testing::Test {
+public:
+    DrawLineTest() {}
+    virtual ~DrawLineTest() {}
+
+    static void SetUpTestCase()
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            BaseGfxEngine::InitGfxEngine();
+        }
+    }
+};
+
+/**
+ * @tc.name: DrawLineSpan_001
+ * @tc.desc: Verify lines of widths 1 to 20 at every angle draw the same pixels in spans as one pixel at a time,
+ *           opaque, translucent and clipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawLineTest, DrawLineSpan_001, TestSize.Level1)
+{
+    Color32* expectPixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo expect;
+    BufferInfo buffer;
+    const Rect masks[] = {Rect(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1), Rect(53, 61, 141, 133)}; // clipped mask
+    const OpacityType opacities[] = {OPA_OPAQUE, OPA_OPAQUE / 2};                                 // 2: half
+    for (const Rect& mask : masks) {
+        for (OpacityType opacity : opacities) {
+            for (int16_t width = 1; width <= MAX_WIDTH; width++) {
+                InitBuffer(expect, expectPixels);
+                InitBuffer(buffer, pixels);
+                DrawLine::SetSpanEnable(false);
+                DrawStar(expect, mask, width, opacity);
+                DrawLine::SetSpanEnable(true);
+                DrawStar(buffer, mask, width, opacity);
+                ASSERT_EQ(memcmp(pixels, expectPixels, BUFFER_SIZE * BUFFER_SIZE * sizeof(Color32)), 0)
+                    << "width " << width << ", opacity " << static_cast<int32_t>(opacity);
+            }
+        }
+    }
+    delete[] expectPixels;
+    delete[] pixels;
+}
+
+/**
+ * @tc.name: DrawLineSpanCost_001
+ * @tc.desc: Verify lines of widths 1 to 20 at every angle need fewer blends in spans than one pixel at a time, and
+ *           thin lines, whose rows hold two or three pixels, need far fewer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawLineTest, DrawLineSpanCost_001, TestSize.Level1)
+{
+    const int16_t thinWidth = 2;
+    Color32* pixels = new Color32[BUFFER_SIZE * BUFFER_SIZE];
+    BufferInfo buffer;
+    InitBuffer(buffer, pixels);
+    for (int16_t width = 1; width <= MAX_WIDTH; width++) {
+        uint32_t pixelBlends = CountStarBlends(buffer, width, false);
+        uint32_t spanBlends = CountStarBlends(buffer, width, true);
+        EXPECT_LT(spanBlends, pixelBlends) << "width " << width;
+        if (width <= thinWidth) {
+            EXPECT_LT(spanBlends * 3, pixelBlends * 2) << "width " << width; // 3, 2: at least 1.5 pixels a blend
+        }
+    }
+    delete[] pixels;
+}
+} // namespace OHOS
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render/render_blur.h"
+
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "draw/shadow_mask_cache.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr int16_t CARD_WIDTH = 200;
+constexpr int16_t CARD_HEIGHT = 120;
+constexpr uint16_t CARD_RADIUS = 32;
+constexpr uint16_t BLUR_LOOP = 4;
+
+/* blurs with the same rounding as RenderBlur but sums every window again, one pass and axis at a time */
+void ReferenceBoxBlur(uint8_t* mask, int16_t width, int16_t height, uint16_t radius)
+{
+    int32_t boxRadius = (radius + 1) / 2; // 2: half
+    if (boxRadius > 127) {                // 127: largest box radius
+        boxRadius = 127;                  // 127: largest box radius
+    }
+    if (boxRadius == 0) {
+        return;
+    }
+    int32_t window = 2 * boxRadius + 1; // 2: both sides
+    uint32_t reciprocal = (65536 + window / 2) / window; // 65536: 1 << 16, 2: round to nearest
+    uint8_t* tmp = new uint8_t[width * height];
+    for (int32_t axis = 0; axis < 2; axis++) { // 2: vertical and horizontal
+        for (int32_t pass = 0; pass < 3; pass++) { // 3: box blur passes
+            for (int32_t y = 0; y < height; y++) {
+                for (int32_t x = 0; x < width; x++) {
+                    uint32_t sum = 0;
+                    for (int32_t i = -boxRadius; i <= boxRadius; i++) {
+                        int32_t sx = (axis == 1) ? x + i : x;
+                        int32_t sy = (axis == 0) ? y + i : y;
+                        if ((sx >= 0) && (sx < width) && (sy >= 0) && (sy < height)) {
+                            sum += mask[sy * width + sx];
+                        }
+                    }
+                    tmp[y * width + x] = static_cast<uint8_t>(((sum + window / 2) * reciprocal) >> 16); // 2, 16
+                }
+            }
+            memcpy(mask, tmp, width * height);
+        }
+    }
+    delete[] tmp;
+}
+
+void FillPattern(uint8_t* mask, int16_t width, int16_t height)
+{
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            mask[y * width + x] = static_cast<uint8_t>((x * 37 + y * 101 + ((x * y) >> 2)) & 0xFF); // 37, 101, 2
+        }
+    }
+}
+
+uint8_t* NewCardMask(int16_t width, int16_t height, uint16_t extent)
+{
+    uint8_t* mask = new uint8_t[width * height];
+    memset(mask, 0, width * height);
+    for (int32_t y = extent; y < height - extent; y++) {
+        memset(mask + y * width + extent, 0xFF, width - 2 * extent); // 2: both sides
+    }
+    return mask;
+}
+
+ShadowMask NewMask(int16_t width, int16_t height)
+{
+    ShadowMask mask = {new uint8_t[width * height], 0, 0, width, height};
+    return mask;
+}
+} // namespace
+
+class RenderBlurTest : public testing::Test {
+public:
+    RenderBlurTest() {}
+    virtual ~RenderBlurTest() {}
+
+    void TearDown() override
+    {
+        ShadowMaskCache::GetInstance().Clear();
+    }
+};
+
+/**
+ * @tc.name: RenderBlurBoxBlurAlpha_001
+ * @tc.desc: Verify the row kernels blur exactly like summing every window, including the lengths that are not a
+ *           multiple of the vector width and radii above the largest box.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderBlurTest, RenderBlurBoxBlurAlpha_001, TestSize.Level0)
+{
+    const int16_t sizes[][2] = {{1, 1}, {7, 5}, {8, 8}, {33, 17}, {100, 64}}; // 2: width and height
+    const uint16_t radii[] = {1, 2, 5, 16, 300};
+    for (const int16_t* size : sizes) {
+        for (uint16_t radius : radii) {
+            int32_t count = size[0] * size[1];
+            uint8_t* mask = new uint8_t[count];
+            uint8_t* expect = new uint8_t[count];
+            FillPattern(mask, size[0], size[1]);
+            memcpy(expect, mask, count);
+            EXPECT_EQ(RenderBlur::BoxBlurAlpha(mask, size[0], size[1], radius), true);
+            ReferenceBoxBlur(expect, size[0], size[1], radius);
+            EXPECT_EQ(memcmp(mask, expect, count), 0) << size[0] << "x" << size[1] << " radius " << radius;
+            delete[] mask;
+            delete[] expect;
+        }
+    }
+}
+
+/**
+ * @tc.name: RenderBlurBoxBlurAlpha_002
+ * @tc.desc: Verify a blurred dot stays mirror symmetric and inside the blur extent, and invalid parameters are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderBlurTest, RenderBlurBoxBlurAlpha_002, TestSize.Level0)
+{
+    const uint16_t radius = 6;
+    const int16_t extent = RenderBlur::GetBoxBlurExtent(radius);
+    const int16_t size = 2 * extent + 3; // 2: both sides, 3: dot and one spare pixel per side
+    const int16_t center = size / 2;     // 2: half
+    const int32_t count = size * size;
+    uint8_t* mask = new uint8_t[count];
+    memset(mask, 0, count);
+    mask[center * size + center] = 0xFF;
+    EXPECT_EQ(RenderBlur::BoxBlurAlpha(mask, size, size, radius), true);
+
+    EXPECT_GT(mask[center * size + center], 0);
+    for (int16_t y = 0; y < size; y++) {
+        for (int16_t x = 0; x < size; x++) {
+            EXPECT_EQ(mask[y * size + x], mask[(size - 1 - y) * size + x]);
+            EXPECT_EQ(mask[y * size + x], mask[y * size + size - 1 - x]);
+            if ((x == 0) || (y == 0)) {
+                EXPECT_EQ(mask[y * size + x], 0);
+            }
+        }
+    }
+
+    uint8_t* copy = new uint8_t[count];
+    memcpy(copy, mask, count);
+    EXPECT_EQ(RenderBlur::BoxBlurAlpha(mask, size, size, 0), true);
+    EXPECT_EQ(memcmp(copy, mask, count), 0);
+    EXPECT_EQ(RenderBlur::BoxBlurAlpha(nullptr, size, size, radius), false);
+    EXPECT_EQ(RenderBlur::BoxBlurAlpha(mask, 0, size, radius), false);
+    delete[] copy;
+    delete[] mask;
+}
+
+/**
+ * @tc.name: ShadowMaskCache_001
+ * @tc.desc: Verify masks are found by their key, the least recently used mask is dropped first and the cache
+ *           never holds more than its size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderBlurTest, ShadowMaskCache_001, TestSize.Level0)
+{
+    ShadowMaskCache& cache = ShadowMaskCache::GetInstance();
+    const uint8_t maxEntryNum = ShadowMaskCache::MAX_ENTRY_NUM;
+    const uint32_t maxCacheSize = ShadowMaskCache::MAX_CACHE_SIZE;
+    for (uint8_t i = 0; i < maxEntryNum; i++) {
+        EXPECT_EQ(cache.Put({i, 0, 1}, NewMask(10, 10)), true); // 10: mask size
+    }
+    EXPECT_EQ(cache.GetUsedSize(), maxEntryNum * 100u); // 100: bytes of each mask
+    EXPECT_NE(cache.Get({0, 0, 1}), nullptr);
+    EXPECT_EQ(cache.Get({0, 1, 1}), nullptr);
+    EXPECT_EQ(cache.Get({0, 0, 2}), nullptr); // 2: other radius
+
+    /* key 1 is now the oldest */
+    EXPECT_EQ(cache.Put({maxEntryNum, 0, 1}, NewMask(10, 10)), true); // 10: mask size
+    EXPECT_EQ(cache.Get({1, 0, 1}), nullptr);
+    EXPECT_NE(cache.Get({0, 0, 1}), nullptr);
+    EXPECT_NE(cache.Get({maxEntryNum, 0, 1}), nullptr);
+
+    /* a mask of the whole cache size drops everything else */
+    int16_t width = 1024;                            // 1024: mask width
+    int16_t height = maxCacheSize / width;
+    EXPECT_EQ(cache.Put({100, 0, 1}, NewMask(width, height)), true); // 100: key
+    EXPECT_EQ(cache.GetUsedSize(), maxCacheSize);
+    EXPECT_EQ(cache.Get({0, 0, 1}), nullptr);
+    const ShadowMask* mask = cache.Get({100, 0, 1}); // 100: key
+    ASSERT_NE(mask, nullptr);
+    EXPECT_EQ(mask->width, width);
+
+    ShadowMask tooLarge = NewMask(width, height + 1);
+    EXPECT_EQ(cache.Put({101, 0, 1}, tooLarge), false); // 101: key
+    delete[] tooLarge.alpha;
+    EXPECT_EQ(cache.GetUsedSize(), maxCacheSize);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetUsedSize(), 0u);
+    EXPECT_EQ(cache.Get({100, 0, 1}), nullptr); // 100: key
+}
+
+/**
+ * @tc.name: ShadowMaskCache_002
+ * @tc.desc: Verify a mask is not returned for a path whose hashes collide with the cached one but whose vertex count
+ *           or bounds differ.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderBlurTest, ShadowMaskCache_002, TestSize.Level0)
+{
+    ShadowMaskCache& cache = ShadowMaskCache::GetInstance();
+    const ShadowMaskKey key = {1, 2, 3, 4, 0, 0, CARD_WIDTH, CARD_HEIGHT}; // 1, 2: hashes, 3: radius, 4: vertices
+    EXPECT_EQ(cache.Put(key, NewMask(10, 10)), true);                      // 10: mask size
+    EXPECT_NE(cache.Get(key), nullptr);
+
+    ShadowMaskKey other = key;
+    other.vertexNum = 5; // 5: one vertex more
+    EXPECT_EQ(cache.Get(other), nullptr);
+    other = key;
+    other.minX = 1;
+    EXPECT_EQ(cache.Get(other), nullptr);
+    other = key;
+    other.maxY = CARD_HEIGHT + 1;
+    EXPECT_EQ(cache.Get(other), nullptr);
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+    EXPECT_EQ(cache.GetMissCount(), 3u); // 3: the three other paths
+}
+
+/**
+ * @tc.name: RenderBlurBoxBlurAlpha_003
+ * @tc.desc: Verify blurring the shadow mask of a card at a large radius with the sliding windows gives the same mask
+ *           as summing every window, in less time.
+ * @tc.type: PERF
+ */
+HWTEST_F(RenderBlurTest, RenderBlurBoxBlurAlpha_003, TestSize.Level1)
+{
+    uint16_t extent = RenderBlur::GetBoxBlurExtent(CARD_RADIUS);
+    int16_t width = CARD_WIDTH + 2 * extent;   // 2: both sides
+    int16_t height = CARD_HEIGHT + 2 * extent; // 2: both sides
+    uint8_t* mask = NewCardMask(width, height, extent);
+    uint8_t* expect = NewCardMask(width, height, extent);
+
+    /* a sliding window costs the same at every radius, summing every window costs the window size per pixel */
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < BLUR_LOOP; i++) {
+        EXPECT_EQ(RenderBlur::BoxBlurAlpha(mask, width, height, CARD_RADIUS), true);
+    }
+    std::chrono::steady_clock::duration blurTime = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < BLUR_LOOP; i++) {
+        ReferenceBoxBlur(expect, width, height, CARD_RADIUS);
+    }
+    std::chrono::steady_clock::duration referenceTime = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(memcmp(mask, expect, width * height), 0);
+    EXPECT_LT(blurTime.count(), referenceTime.count());
+    delete[] mask;
+    delete[] expect;
+}
+} // namespace OHOS
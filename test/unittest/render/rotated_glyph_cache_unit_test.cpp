@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/rotated_glyph_cache.h"
+
+#include <gtest/gtest.h>
+#include "draw/draw_utils.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+constexpr uint16_t GLYPH_COLS = 5;
+constexpr uint16_t GLYPH_ROWS = 3;
+constexpr int16_t GLYPH_LEFT = 2;
+constexpr int16_t GLYPH_TOP = -7;
+constexpr uint8_t A4_MAX = 0x0F;
+constexpr uint8_t A4_STEP = 17;
+
+/* an A4 glyph with a different coverage in each pixel, and the same glyph in A8 */
+void InitGlyph(uint8_t* a4, uint8_t* a8)
+{
+    const uint16_t rowBytes = 3; // 3: 5 pixels of 4 bits
+    for (uint16_t i = 0; i < GLYPH_COLS * GLYPH_ROWS; i++) {
+        uint16_t row = i / GLYPH_COLS;
+        uint16_t col = i % GLYPH_COLS;
+        uint8_t value = (i * 7) & A4_MAX; // 7: spreads the values over 0 to 15
+        a4[row * rowBytes + col / 2] |= value << ((col % 2) * 4); // 2: pixels per byte, 4: bits per pixel
+        a8[i] = value * A4_STEP;
+    }
+}
+
+uint8_t GetCoverage(const RotatedGlyph& glyph, int16_t x, int16_t y)
+{
+    return glyph.data[(y - glyph.top) * glyph.width + x - glyph.left];
+}
+} // namespace
+
+class RotatedGlyphCacheTest : public testing::Test {
+public:
+    RotatedGlyphCacheTest() {}
+    virtual ~RotatedGlyphCacheTest() {}
+
+    void TearDown() override
+    {
+        RotatedGlyphCache::GetInstance().Clear();
+    }
+};
+
+/**
+ * @tc.name: RotatedGlyphCacheRotate_001
+ * @tc.desc: Verify a glyph turned by right angles keeps its coverage, only moved to the rotated pixels.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RotatedGlyphCacheTest, RotatedGlyphCacheRotate_001, TestSize.Level0)
+{
+    uint8_t a4[9] = {0}; // 9: 3 rows of 3 bytes
+    uint8_t a8[GLYPH_COLS * GLYPH_ROWS] = {0};
+    InitGlyph(a4, a8);
+
+    RotatedGlyph upright = {};
+    ASSERT_TRUE(
+        RotatedGlyphCache::Rotate(a4, FONT_WEIGHT_4, GLYPH_COLS, GLYPH_ROWS, GLYPH_LEFT, GLYPH_TOP, 0, upright));
+    EXPECT_EQ(upright.left, GLYPH_LEFT);
+    EXPECT_EQ(upright.top, GLYPH_TOP);
+    EXPECT_EQ(upright.width, GLYPH_COLS);
+    EXPECT_EQ(upright.height, GLYPH_ROWS);
+
+    RotatedGlyph turned = {};
+    ASSERT_TRUE(RotatedGlyphCache::Rotate(a4, FONT_WEIGHT_4, GLYPH_COLS, GLYPH_ROWS, GLYPH_LEFT, GLYPH_TOP,
+                                          QUARTER_IN_DEGREE, turned));
+    for (uint16_t row = 0; row < GLYPH_ROWS; row++) {
+        for (uint16_t col = 0; col < GLYPH_COLS; col++) {
+            uint8_t expect = a8[row * GLYPH_COLS + col];
+            int16_t x = GLYPH_LEFT + col;
+            int16_t y = GLYPH_TOP + row;
+            EXPECT_NEAR(GetCoverage(upright, x, y), expect, 1);
+            /* clockwise around the pivot, (x, y) goes to (-y, x) and the pixel to the one left of it */
+            EXPECT_NEAR(GetCoverage(turned, -y - 1, x), expect, 1);
+        }
+    }
+    delete[] upright.data;
+    delete[] turned.data;
+}
+
+/**
+ * @tc.name: RotatedGlyphCachePut_001
+ * @tc.desc: Verify glyphs are found by letter, font and angle, and the least recently used ones are dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RotatedGlyphCacheTest, RotatedGlyphCachePut_001, TestSize.Level0)
+{
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    const uint16_t size = 10;
+    RotatedGlyphKey first = {'a', 0, 24, RotatedGlyphCache::NormalizeAngle(-90)}; // 24: font height, -90: angle
+    EXPECT_EQ(first.angle, 270);                                                    // 270: -90 normalized
+    RotatedGlyph glyph = {new uint8_t[size * size], 0, 0, size, size};
+    ASSERT_NE(cache.Put(first, glyph), nullptr);
+    EXPECT_NE(cache.Get(first), nullptr);
+
+    RotatedGlyphKey other = first;
+    other.fontHeight++;
+    EXPECT_EQ(cache.Get(other), nullptr);
+    EXPECT_EQ(cache.GetHitCount(), 1U);
+    EXPECT_EQ(cache.GetMissCount(), 1U);
+
+    RotatedGlyph tooLarge = {new uint8_t[1], 0, 0, UINT16_MAX, UINT16_MAX};
+    EXPECT_EQ(cache.Put(other, tooLarge), nullptr);
+
+    for (int16_t angle = 0; angle < RotatedGlyphCache::MAX_ENTRY_NUM; angle++) {
+        RotatedGlyphKey key = {'b', 0, 24, angle}; // 24: font height
+        RotatedGlyph next = {new uint8_t[size * size], 0, 0, size, size};
+        ASSERT_NE(cache.Put(key, next), nullptr);
+    }
+    EXPECT_EQ(cache.GetEntryNum(), RotatedGlyphCache::MAX_ENTRY_NUM);
+    EXPECT_EQ(cache.GetUsedSize(), RotatedGlyphCache::MAX_ENTRY_NUM * size * size);
+    EXPECT_EQ(cache.Get(first), nullptr);
+
+    cache.SetEnable(false);
+    EXPECT_EQ(cache.GetEntryNum(), 0);
+    cache.SetEnable(true);
+}
+} // namespace OHOS
@@ -57,6 +57,7 @@ SOURCES += \
     ../../../../frameworks/animator/animator.cpp \
     ../../../../frameworks/animator/animator_manager.cpp \
     ../../../../frameworks/animator/easing_equation.cpp \
+    ../../../../frameworks/animator/easing_table.cpp \
     ../../../../frameworks/animator/interpolation.cpp \
     ../../../../frameworks/common/graphic_startup.cpp \
     ../../../../frameworks/common/image_decode_ability.cpp \
@@ -66,6 +67,7 @@ SOURCES += \
     ../../../../frameworks/common/task.cpp \
     ../../../../frameworks/common/text.cpp \
     ../../../../frameworks/common/spannable_string.cpp \
+    ../../../../frameworks/common/style_pool.cpp \
     ../../../../frameworks/common/typed_text.cpp \
     ../../../../frameworks/components/root_view.cpp \
     ../../../../frameworks/components/text_adapter.cpp \
@@ -108,11 +110,15 @@ SOURCES += \
     ../../../../frameworks/core/render_manager.cpp \
     ../../../../frameworks/core/task_manager.cpp \
     ../../../../frameworks/default_resource/check_box_res.cpp \
+    ../../../../frameworks/dfx/dump_dom_writer.cpp \
     ../../../../frameworks/dfx/event_injector.cpp \
     ../../../../frameworks/dfx/key_event_injector.cpp \
     ../../../../frameworks/dfx/performance_task.cpp \
     ../../../../frameworks/dfx/point_event_injector.cpp \
     ../../../../frameworks/dfx/ui_dump_dom_tree.cpp \
+    ../../../../frameworks/dfx/ui_frame_timeline.cpp \
+    ../../../../frameworks/dfx/ui_input_latency.cpp \
+    ../../../../frameworks/dfx/ui_render_profiler.cpp \
     ../../../../frameworks/dfx/ui_view_bounds.cpp \
     ../../../../frameworks/dock/input_device.cpp \
     ../../../../frameworks/dock/key_input_device.cpp \
@@ -121,6 +127,7 @@ SOURCES += \
     ../../../../frameworks/dock/screen_device_proxy.cpp \
     ../../../../frameworks/dock/vibrator_manager.cpp \
     ../../../../frameworks/dock/virtual_input_device.cpp \
+    ../../../../frameworks/engines/gfx/draw_command_queue.cpp \
     ../../../../frameworks/engines/gfx/gfx_engine_manager.cpp \
     ../../../../frameworks/draw/clip_utils.cpp \
     ../../../../frameworks/draw/draw_arc.cpp \
@@ -131,6 +138,9 @@ SOURCES += \
     ../../../../frameworks/draw/draw_rect.cpp \
     ../../../../frameworks/draw/draw_triangle.cpp \
     ../../../../frameworks/draw/draw_utils.cpp \
+    ../../../../frameworks/draw/rotated_glyph_cache.cpp \
+    ../../../../frameworks/draw/shadow_mask_cache.cpp \
+    ../../../../frameworks/draw/state_sprite_cache.cpp \
     ../../../../frameworks/events/event.cpp \
     ../../../../frameworks/font/base_font.cpp \
     ../../../../frameworks/font/glyphs_manager.cpp \
@@ -140,6 +150,7 @@ SOURCES += \
     ../../../../frameworks/font/ui_font_bitmap.cpp \
     ../../../../frameworks/font/ui_font_builder.cpp \
     ../../../../frameworks/font/ui_font_cache.cpp \
+    ../../../../frameworks/font/ui_font_coverage.cpp \
     ../../../../frameworks/font/ui_font_vector.cpp \
     ../../../../frameworks/font/ui_line_break.cpp \
     ../../../../frameworks/font/ui_multi_font_manager.cpp \
@@ -147,10 +158,12 @@ SOURCES += \
     ../../../../frameworks/imgdecode/cache_manager.cpp \
     ../../../../frameworks/imgdecode/file_img_decoder.cpp \
     ../../../../frameworks/imgdecode/image_load.cpp \
+    ../../../../frameworks/imgdecode/row_rle_image.cpp \
     ../../../../frameworks/layout/flex_layout.cpp \
     ../../../../frameworks/layout/grid_layout.cpp \
     ../../../../frameworks/layout/list_layout.cpp \
     ../../../../frameworks/render/render_base.cpp \
+    ../../../../frameworks/render/render_blur.cpp \
     ../../../../frameworks/render/render_pixfmt_rgba_blend.cpp \
     ../../../../frameworks/themes/theme.cpp \
     ../../../../frameworks/themes/theme_manager.cpp \
@@ -205,9 +218,11 @@ HEADERS += \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_range_adapter.h \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_shorten_path.h \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_vertex_sequence.h \
+    ../../../../frameworks/common/style_pool.h \
     ../../../../frameworks/common/typed_text.h \
     ../../../../frameworks/core/render_manager.h \
     ../../../../frameworks/default_resource/check_box_res.h \
+    ../../../../frameworks/dfx/dump_dom_writer.h \
     ../../../../frameworks/dfx/key_event_injector.h \
     ../../../../frameworks/dfx/point_event_injector.h \
     ../../../../frameworks/dfx/ui_view_bounds.h \
@@ -223,12 +238,19 @@ HEADERS += \
     ../../../../frameworks/draw/draw_rect.h \
     ../../../../frameworks/draw/draw_triangle.h \
     ../../../../frameworks/draw/draw_utils.h \
+    ../../../../frameworks/draw/rotated_glyph_cache.h \
+    ../../../../frameworks/draw/shadow_mask_cache.h \
+    ../../../../frameworks/draw/state_sprite_cache.h \
+    ../../../../frameworks/engines/gfx/draw_command_queue.h \
     ../../../../frameworks/font/ui_font_adaptor.h \
+    ../../../../frameworks/font/ui_font_coverage.h \
     ../../../../frameworks/font/ui_multi_font_manager.h \
     ../../../../frameworks/imgdecode/cache_manager.h \
     ../../../../frameworks/imgdecode/file_img_decoder.h \
     ../../../../frameworks/imgdecode/image_load.h \
+    ../../../../frameworks/imgdecode/row_rle_image.h \
     ../../../../frameworks/render/render_base.h \
+    ../../../../frameworks/render/render_blur.h \
     ../../../../frameworks/render/render_buffer.h \
     ../../../../frameworks/render/render_pixfmt_rgba_blend.h \
     ../../../../frameworks/render/render_scanline.h \
@@ -243,6 +265,7 @@ HEADERS += \
     ../../../../interfaces/innerkits/engines/gfx/gfx_engine_manager.h \
     ../../../../interfaces/kits/animator/animator.h \
     ../../../../interfaces/kits/animator/easing_equation.h \
+    ../../../../interfaces/kits/animator/easing_table.h \
     ../../../../interfaces/kits/animator/interpolation.h \
     ../../../../interfaces/kits/common/image.h \
     ../../../../interfaces/kits/common/screen.h \
@@ -286,6 +309,9 @@ HEADERS += \
     ../../../../interfaces/kits/components/ui_extend_image_view.h \
     ../../../../interfaces/kits/dfx/event_injector.h \
     ../../../../interfaces/kits/dfx/ui_dump_dom_tree.h \
+    ../../../../interfaces/kits/dfx/ui_frame_timeline.h \
+    ../../../../interfaces/kits/dfx/ui_input_latency.h \
+    ../../../../interfaces/kits/dfx/ui_render_profiler.h \
     ../../../../interfaces/kits/events/aod_callback.h \
     ../../../../interfaces/kits/events/cancel_event.h \
     ../../../../interfaces/kits/events/click_event.h \